@@ -0,0 +1,67 @@
+#pragma once
+#include <benchmark/benchmark.h>
+
+#include <Eigen/Dense>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "gncpy/dynamics/ILinearDynamics.h"
+#include "gncpy/dynamics/Parameters.h"
+
+namespace lager::gncpy::bench {
+
+/// @brief Constant velocity model in any number of axes, used to scale the
+/// state size of the linear filter benchmarks
+class NDIntegrator final : public dynamics::ILinearDynamics {
+   public:
+    NDIntegrator(Eigen::Index numAxes, double dt)
+        : m_numAxes(numAxes), m_dt(dt) {}
+
+    inline std::vector<std::string> stateNames() const override {
+        return std::vector<std::string>(2 * m_numAxes, "");
+    }
+
+    Eigen::MatrixXd getStateMat(
+        [[maybe_unused]] double timestep,
+        [[maybe_unused]] const dynamics::StateTransParams* const
+            stateTransParams = nullptr) const override {
+        Eigen::MatrixXd out =
+            Eigen::MatrixXd::Identity(2 * m_numAxes, 2 * m_numAxes);
+        out.topRightCorner(m_numAxes, m_numAxes).diagonal().setConstant(m_dt);
+        return out;
+    }
+
+    std::optional<double> fixedStep() const override { return m_dt; }
+    bool setFixedStep(double dt) override {
+        m_dt = dt;
+        return true;
+    }
+
+   private:
+    Eigen::Index m_numAxes;
+    double m_dt;
+};
+
+/// @brief Sets range(0) to the state size and range(1) to the number of
+/// inputs processed per iteration
+inline void stateAndBatchArgs(benchmark::internal::Benchmark* b) {
+    for (int64_t n : {4, 8, 16, 32, 64}) {
+        for (int64_t batch : {1, 64}) {
+            b->Args({n, batch});
+        }
+    }
+    b->ArgNames({"state", "batch"});
+}
+
+/// @brief Position indices of an NDIntegrator state
+inline std::vector<uint8_t> positionInds(Eigen::Index numAxes) {
+    std::vector<uint8_t> inds;
+    for (Eigen::Index ii = 0; ii < numAxes; ii++) {
+        inds.push_back(static_cast<uint8_t>(ii));
+    }
+    return inds;
+}
+
+}  // namespace lager::gncpy::bench
@@ -0,0 +1,126 @@
+#include <benchmark/benchmark.h>
+
+#include <Eigen/Dense>
+#include <memory>
+#include <vector>
+
+#include "BenchModels.h"
+#include "gncpy/dynamics/CurvilinearMotion.h"
+#include "gncpy/filters/ExtendedKalman.h"
+#include "gncpy/filters/Kalman.h"
+#include "gncpy/filters/Parameters.h"
+#include "gncpy/measurements/RangeAndBearing.h"
+#include "gncpy/measurements/StateObservation.h"
+
+namespace {
+
+using namespace lager::gncpy;
+using bench::stateAndBatchArgs;
+
+filters::Kalman makeKalman(Eigen::Index numAxes) {
+    const Eigen::Index n = 2 * numAxes;
+    filters::Kalman filt;
+    filt.setStateModel(std::make_shared<bench::NDIntegrator>(numAxes, 0.1),
+                       0.01 * Eigen::MatrixXd::Identity(n, n));
+    filt.setMeasurementModel(
+        std::make_shared<measurements::StateObservation>(),
+        0.1 * Eigen::MatrixXd::Identity(numAxes, numAxes));
+    filt.getCov() = Eigen::MatrixXd::Identity(n, n);
+    return filt;
+}
+
+void BM_KalmanPredict(benchmark::State& state) {
+    const Eigen::Index numAxes = state.range(0) / 2;
+    const int64_t batch = state.range(1);
+    std::vector<filters::Kalman> filts(batch, makeKalman(numAxes));
+    std::vector<Eigen::VectorXd> states(
+        batch, Eigen::VectorXd::Ones(2 * numAxes));
+    filters::BayesPredictParams params;
+
+    for (auto _ : state) {
+        // the covariance grows without bound, reset it off the clock
+        state.PauseTiming();
+        for (filters::Kalman& filt : filts) {
+            filt.getCov().setIdentity();
+        }
+        state.ResumeTiming();
+        for (int64_t ii = 0; ii < batch; ii++) {
+            states[ii] =
+                filts[ii].predict(0.0, states[ii], std::nullopt, &params);
+        }
+        benchmark::DoNotOptimize(states.data());
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(BM_KalmanPredict)->Apply(stateAndBatchArgs);
+
+void BM_KalmanCorrect(benchmark::State& state) {
+    const Eigen::Index numAxes = state.range(0) / 2;
+    const int64_t batch = state.range(1);
+    std::vector<filters::Kalman> filts(batch, makeKalman(numAxes));
+    Eigen::VectorXd x0 = Eigen::VectorXd::Ones(2 * numAxes);
+    Eigen::VectorXd meas = Eigen::VectorXd::Constant(numAxes, 1.1);
+    filters::BayesCorrectParams params;
+    params.measParams = std::make_shared<measurements::StateObservationParams>(
+        bench::positionInds(numAxes));
+
+    double prob;
+    for (auto _ : state) {
+        // every correct starts from the same prior, reset off the clock
+        state.PauseTiming();
+        for (filters::Kalman& filt : filts) {
+            filt.getCov().setIdentity();
+        }
+        state.ResumeTiming();
+        for (int64_t ii = 0; ii < batch; ii++) {
+            auto out = filts[ii].correct(0.0, meas, x0, prob, &params);
+            benchmark::DoNotOptimize(out.data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(BM_KalmanCorrect)->Apply(stateAndBatchArgs);
+
+filters::ExtendedKalman makeEKF() {
+    filters::ExtendedKalman filt;
+    filt.setStateModel(std::make_shared<dynamics::CurvilinearMotion>(0.1),
+                       0.01 * Eigen::Matrix4d::Identity());
+    filt.setMeasurementModel(std::make_shared<measurements::RangeAndBearing>(),
+                             Eigen::Vector2d(0.1, 0.001).asDiagonal());
+    filt.getCov() = Eigen::Matrix4d::Identity();
+    return filt;
+}
+
+void BM_EKFCurvilinearRangeBearing(benchmark::State& state) {
+    const int64_t batch = state.range(0);
+    std::vector<filters::ExtendedKalman> filts(batch, makeEKF());
+    std::vector<Eigen::VectorXd> states(batch,
+                                        Eigen::Vector4d(10.0, 5.0, 1.0, 0.3));
+    filters::BayesPredictParams predParams;
+    filters::BayesCorrectParams corrParams;
+    corrParams.measParams =
+        std::make_shared<measurements::RangeAndBearingParams>(0, 1);
+    Eigen::Vector2d meas(11.3, 0.47);
+
+    double prob;
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (filters::ExtendedKalman& filt : filts) {
+            filt.getCov().setIdentity();
+        }
+        state.ResumeTiming();
+        for (int64_t ii = 0; ii < batch; ii++) {
+            Eigen::VectorXd pred =
+                filts[ii].predict(0.0, states[ii], std::nullopt, &predParams);
+            auto out = filts[ii].correct(0.1, meas, pred, prob, &corrParams);
+            benchmark::DoNotOptimize(out.data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(BM_EKFCurvilinearRangeBearing)
+    ->ArgName("batch")
+    ->Arg(1)
+    ->Arg(64);
+
+}  // namespace
@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.h>
+
+#include <Eigen/Dense>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+#include "BenchModels.h"
+#include "gncpy/math/Math.h"
+
+namespace {
+
+using namespace lager::gncpy;
+using bench::stateAndBatchArgs;
+
+// one input per column, each a small perturbation of the first
+Eigen::MatrixXd batchInputs(Eigen::Index n, int64_t batch, double start,
+                            double end) {
+    Eigen::MatrixXd out(n, batch);
+    for (int64_t ii = 0; ii < batch; ii++) {
+        out.col(ii) = Eigen::VectorXd::LinSpaced(n, start, end).array() +
+                      1e-3 * static_cast<double>(ii);
+    }
+    return out;
+}
+
+void BM_GetJacobian(benchmark::State& state) {
+    const Eigen::Index n = state.range(0);
+    const int64_t batch = state.range(1);
+    std::vector<std::function<double(const Eigen::VectorXd&)>> fncs;
+    for (Eigen::Index ii = 0; ii < n; ii++) {
+        fncs.emplace_back([ii](const Eigen::VectorXd& x) {
+            return std::sin(x(ii)) * x.squaredNorm();
+        });
+    }
+    const Eigen::MatrixXd xs = batchInputs(n, batch, 0.1, 1.0);
+    Eigen::VectorXd x(n);
+
+    for (auto _ : state) {
+        for (int64_t ii = 0; ii < batch; ii++) {
+            x = xs.col(ii);
+            auto jac = math::getJacobian(x, fncs);
+            benchmark::DoNotOptimize(jac.data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(BM_GetJacobian)->Apply(stateAndBatchArgs);
+
+void BM_RungeKutta4(benchmark::State& state) {
+    const Eigen::Index n = state.range(0);
+    const int64_t batch = state.range(1);
+    Eigen::MatrixXd stateMat = -0.1 * Eigen::MatrixXd::Identity(n, n);
+    stateMat.diagonal(1).setConstant(1.0);
+    std::function<Eigen::VectorXd(double, const Eigen::VectorXd&)> fnc =
+        [&stateMat](double, const Eigen::VectorXd& x) -> Eigen::VectorXd {
+        return stateMat * x;
+    };
+    const Eigen::MatrixXd xs = batchInputs(n, batch, 1.0, 1.0);
+    Eigen::VectorXd x(n);
+
+    for (auto _ : state) {
+        for (int64_t ii = 0; ii < batch; ii++) {
+            x = xs.col(ii);
+            auto out = math::rungeKutta4(0.0, x, 0.01, fnc);
+            benchmark::DoNotOptimize(out.data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(BM_RungeKutta4)->Apply(stateAndBatchArgs);
+
+void BM_CalcGaussianPDF(benchmark::State& state) {
+    const Eigen::Index n = state.range(0);
+    const int64_t batch = state.range(1);
+    Eigen::MatrixXd tmp = Eigen::MatrixXd::Random(n, n);
+    Eigen::MatrixXd cov =
+        tmp * tmp.transpose() + Eigen::MatrixXd::Identity(n, n);
+    Eigen::VectorXd mean = Eigen::VectorXd::Zero(n);
+    const Eigen::MatrixXd xs = batchInputs(n, batch, 0.1, 0.1);
+    Eigen::VectorXd x(n);
+
+    for (auto _ : state) {
+        for (int64_t ii = 0; ii < batch; ii++) {
+            x = xs.col(ii);
+            benchmark::DoNotOptimize(math::calcGaussianPDF(x, mean, cov));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(BM_CalcGaussianPDF)->Apply(stateAndBatchArgs);
+
+}  // namespace
@@ -0,0 +1,60 @@
+#include <benchmark/benchmark.h>
+
+#include <Eigen/Dense>
+#include <memory>
+#include <sstream>
+
+#include "gncpy/dynamics/DoubleIntegrator.h"
+#include "gncpy/filters/GaussianMixture.h"
+#include "gncpy/filters/Kalman.h"
+#include "gncpy/measurements/StateObservation.h"
+
+namespace {
+
+using namespace lager::gncpy;
+
+// the dynamics must be a registered serializable type, so the state size is
+// fixed by DoubleIntegrator and only the number of filters varies
+void BM_KalmanSaveLoad(benchmark::State& state) {
+    const int64_t batch = state.range(0);
+    filters::Kalman filt;
+    filt.setStateModel(std::make_shared<dynamics::DoubleIntegrator>(0.1),
+                       Eigen::Matrix4d::Identity());
+    filt.setMeasurementModel(std::make_shared<measurements::StateObservation>(),
+                             Eigen::Matrix2d::Identity());
+    filt.getCov() = Eigen::Matrix4d::Identity();
+
+    for (auto _ : state) {
+        for (int64_t ii = 0; ii < batch; ii++) {
+            std::stringstream ss = filt.saveClassState();
+            auto out = filters::Kalman::loadClass(ss);
+            benchmark::DoNotOptimize(out.viewCov().data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(BM_KalmanSaveLoad)->ArgName("batch")->Arg(1)->Arg(16)->Arg(64);
+
+void BM_GaussianMixtureSaveLoad(benchmark::State& state) {
+    const Eigen::Index n = state.range(0);
+    const int64_t batch = state.range(1);
+    filters::GaussianMixture mix(n);
+    for (int64_t ii = 0; ii < batch; ii++) {
+        mix.add(1.0, Eigen::VectorXd::Constant(n, ii),
+                Eigen::MatrixXd::Identity(n, n));
+    }
+
+    for (auto _ : state) {
+        std::stringstream ss = mix.saveClassState();
+        auto out = filters::GaussianMixture::loadClass(ss);
+        benchmark::DoNotOptimize(out.size());
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(BM_GaussianMixtureSaveLoad)
+    ->ArgNames({"state", "batch"})
+    ->Args({4, 1})
+    ->Args({4, 100})
+    ->Args({16, 100});
+
+}  // namespace
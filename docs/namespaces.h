@@ -57,6 +57,13 @@ namespace math {}
  */
 namespace measurements {}
 
+/**
+ * @namespace lager::gncpy::simulation
+ * @brief Contains Monte Carlo simulation and filter evaluation tools
+ *
+ */
+namespace simulation {}
+
 /**
  * @namespace lager::gncpy::utilities
  * @brief Contains utility functions for all GNCPy
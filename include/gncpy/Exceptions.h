@@ -15,4 +15,16 @@ class TypeError final : public std::runtime_error {
     explicit TypeError(char const* const message) noexcept;
 };
 
+/// @brief General exception for when reading or writing a file fails
+class IOError final : public std::runtime_error {
+   public:
+    explicit IOError(char const* const message) noexcept;
+};
+
+/// @brief General exception for an optional feature a class does not provide
+class NotImplemented final : public std::runtime_error {
+   public:
+    explicit NotImplemented(char const* const message) noexcept;
+};
+
 }  // namespace lager::gncpy::exceptions
\ No newline at end of file
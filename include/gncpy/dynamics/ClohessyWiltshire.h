@@ -30,6 +30,25 @@ class ClohessyWiltshire : public ClohessyWiltshire2D {
                                     [[maybe_unused]] const StateTransParams* const 
                                     stateTransParams=nullptr) const override;
 
+        /**
+         * @brief Propagate many deputies in place, each by its own step
+         *
+         * Evaluates the closed form transition of getStateMat with array
+         * sin and cos across deputies, so a formation at mixed timestamps
+         * needs one call and one model. State constraints are applied to
+         * each deputy after the step.
+         *
+         * @param timestep current time
+         * @param states one deputy per row, 6 columns
+         * @param dts time step of each deputy
+         */
+        void propagateBatch(double timestep, Eigen::Ref<Eigen::MatrixXd> states,
+                            const Eigen::Ref<const Eigen::VectorXd>& dts) const;
+
+        /// @brief Propagate many deputies in place by dt
+        void propagateBatch(double timestep,
+                            Eigen::Ref<Eigen::MatrixXd> states) const;
+
     private:
         template <class Archive>
         void serialize(Archive& ar);
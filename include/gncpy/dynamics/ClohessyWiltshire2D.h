@@ -1,6 +1,7 @@
 #pragma once
 #include <math.h>
 #include <Eigen/Dense>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -38,6 +39,12 @@ class ClohessyWiltshire2D : public ILinearDynamics {
         inline double mean_motion() const {return m_mean_motion;}
         inline void setDt(double dt) {m_dt = dt;} 
         inline void setMeanMotion(double mean_motion) {m_mean_motion = mean_motion;}
+
+        std::optional<double> fixedStep() const override { return m_dt; }
+        bool setFixedStep(double dt) override {
+            m_dt = dt;
+            return true;
+        }
         
         
     protected:
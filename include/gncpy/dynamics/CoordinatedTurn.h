@@ -0,0 +1,92 @@
+#pragma once
+#include <Eigen/Dense>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "gncpy/SerializeMacros.h"
+#include "gncpy/dynamics/INonLinearDynamics.h"
+#include "gncpy/dynamics/Parameters.h"
+
+namespace lager::gncpy::dynamics {
+
+/**
+ * @brief Implements a constant turn rate (coordinated turn) motion model
+ *
+ * The state is \f$[x, y, v_x, v_y, \omega]\f$ and follows
+ *
+ * \f{align}{
+ *      \dot{x} &= v_x \\
+ *      \dot{y} &= v_y \\
+ *      \dot{v}_x &= -\omega v_y \\
+ *      \dot{v}_y &= \omega v_x \\
+ *      \dot{\omega} &= 0
+ * \f}
+ *
+ * The state is propagated with the exact discrete time solution and
+ * getStateMat returns the analytic Jacobian of that solution. Below a small
+ * turn angle the \f$\sin(\omega T) / \omega\f$ style terms are replaced by
+ * their Taylor series so the model is smooth through straight line motion. See
+ * \cite Li2000_SurveyofManeuveringTargetTrackingDynamicModels for details.
+ *
+ */
+class CoordinatedTurn final : public INonLinearDynamics {
+    friend class cereal::access;
+
+    GNCPY_SERIALIZE_CLASS(CoordinatedTurn)
+
+   public:
+    CoordinatedTurn() = default;
+    explicit CoordinatedTurn(double dt) { setDt(dt); }
+
+    std::vector<std::string> stateNames() const override {
+        return std::vector<std::string>{"x pos", "y pos", "x vel", "y vel",
+                                        "turn rate"};
+    }
+
+    Eigen::VectorXd continuousDynamics(
+        [[maybe_unused]] double timestep, const Eigen::VectorXd& state,
+        [[maybe_unused]] const StateTransParams* stateTransParams =
+            nullptr) const override;
+
+    using INonLinearDynamics::propagateState;
+
+    /**
+     * @brief Propagate the state forward one dt with the exact solution
+     *
+     * @param timestep current time
+     * @param state current state
+     * @param stateTransParams unused
+     * @return Eigen::VectorXd Next state
+     */
+    Eigen::VectorXd propagateState(
+        double timestep, const Eigen::VectorXd& state,
+        [[maybe_unused]] const StateTransParams* stateTransParams =
+            nullptr) const override;
+
+   protected:
+    std::optional<Eigen::MatrixXd> analyticStateMat(
+        [[maybe_unused]] double timestep, const Eigen::VectorXd& state,
+        [[maybe_unused]] const StateTransParams* stateTransParams)
+        const override;
+
+    /// @brief Jacobian of the exact discrete transition
+    std::optional<Eigen::MatrixXd> analyticDiscreteStateMat(
+        [[maybe_unused]] double timestep, const Eigen::VectorXd& state,
+        [[maybe_unused]] const StateTransParams* stateTransParams)
+        const override;
+
+   private:
+    template <class Archive>
+    void serialize(Archive& ar);
+};
+
+template <class Archive>
+void CoordinatedTurn::serialize(Archive& ar) {
+    ar(cereal::make_nvp("INonLinearDynamics",
+                        cereal::virtual_base_class<INonLinearDynamics>(this)));
+}
+
+}  // namespace lager::gncpy::dynamics
+
+CEREAL_REGISTER_TYPE(lager::gncpy::dynamics::CoordinatedTurn)
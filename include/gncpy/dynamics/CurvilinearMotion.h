@@ -2,6 +2,7 @@
 #include <Eigen/Dense>
 #include <cmath>
 #include <iostream>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -54,6 +55,12 @@ class CurvilinearMotion final : public INonLinearDynamics {
     //                      bool continuousModel) override ;
     void clearControlModel() override;
 
+   protected:
+    std::optional<Eigen::MatrixXd> analyticStateMat(
+        [[maybe_unused]] double timestep, const Eigen::VectorXd& state,
+        [[maybe_unused]] const StateTransParams* stateTransParams)
+        const override;
+
    private:
     template <class Archive>
     void serialize(Archive& ar);
@@ -1,5 +1,6 @@
 #pragma once
 #include <Eigen/Dense>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -30,6 +31,12 @@ class DoubleIntegrator final : public ILinearDynamics {
     inline double dt() const { return m_dt; }
     inline void setDt(double dt) { m_dt = dt; }
 
+    std::optional<double> fixedStep() const override { return m_dt; }
+    bool setFixedStep(double dt) override {
+        m_dt = dt;
+        return true;
+    }
+
    private:
     template <class Archive>
     void serialize(Archive& ar);
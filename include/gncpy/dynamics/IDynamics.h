@@ -7,6 +7,7 @@
 #include <cereal/types/base_class.hpp>
 #include <cereal/types/polymorphic.hpp>
 #include <functional>
+#include <optional>
 
 #include "gncpy/SerializeMacros.h"
 #include "gncpy/dynamics/Exceptions.h"
@@ -77,6 +78,21 @@ class IDynamics {
     /// @brief Gives a list of the state names, in order
     virtual std::vector<std::string> stateNames() const = 0;
 
+    /**
+     * @brief Step of a model that always propagates by a stored dt
+     *
+     * @return std::optional<double> the stored dt, empty if the model has none
+     */
+    virtual std::optional<double> fixedStep() const { return std::nullopt; }
+
+    /**
+     * @brief Sets the step of a model that propagates by a stored dt
+     *
+     * @param dt new step
+     * @return true if the model has a stored dt, otherwise it is unchanged
+     */
+    virtual bool setFixedStep([[maybe_unused]] double dt) { return false; }
+
     /**
      * @brief Set the State Constraints object
      *
@@ -93,6 +109,10 @@ class IDynamics {
         double timestep, Eigen::VectorXd& state,
         const ConstraintParams* const constraintParams = nullptr) const;
 
+    /// @brief Applies the state constraint to every row of a batch, if set
+    void applyStateConstraintRows(double timestep,
+                                  Eigen::Ref<Eigen::MatrixXd> states) const;
+
    private:
     template <class Archive>
     void serialize(Archive& ar);
@@ -1,6 +1,7 @@
 #pragma once
 #include <Eigen/Dense>
 #include <functional>
+#include <optional>
 
 #include "gncpy/SerializeMacros.h"
 #include "gncpy/dynamics/IDynamics.h"
@@ -41,14 +42,90 @@ class INonLinearDynamics : public IDynamics {
     void clearControlModel() override { m_hasControlModel = false; }
     bool hasControlModel() const override { return m_hasControlModel; }
 
+    /**
+     * @brief Discrete state transition matrix used by the filters
+     *
+     * Returns the analytic discrete Jacobian if the model provides one,
+     * otherwise a finite difference Jacobian of propagateState. Models with
+     * only a continuous closed form get the discrete one from the default
+     * analyticDiscreteStateMat. Use getContinuousStateMat for the Jacobian of
+     * continuousDynamics.
+     *
+     * @param timestep current time
+     * @param state state to linearize about
+     * @param stateTransParams Parameters needed by the transition model
+     * @return Eigen::MatrixXd state matrix
+     */
     Eigen::MatrixXd getStateMat(
         double timestep, const Eigen::VectorXd& state,
         const StateTransParams* stateTransParams = nullptr) const;
 
+    /**
+     * @brief Jacobian of continuousDynamics
+     *
+     * Uses the analytic Jacobian if the model provides one, otherwise finite
+     * differences.
+     *
+     * @param timestep current time
+     * @param state state to linearize about
+     * @param stateTransParams Parameters needed by the transition model
+     * @return Eigen::MatrixXd continuous time Jacobian
+     */
+    Eigen::MatrixXd getContinuousStateMat(
+        double timestep, const Eigen::VectorXd& state,
+        const StateTransParams* stateTransParams = nullptr) const;
+
+    /// @brief Finite difference Jacobian of continuousDynamics
+    Eigen::MatrixXd getNumericalStateMat(
+        double timestep, const Eigen::VectorXd& state,
+        const StateTransParams* stateTransParams = nullptr) const;
+
+    /// @brief Finite difference Jacobian of propagateState
+    Eigen::MatrixXd getNumericalDiscreteStateMat(
+        double timestep, const Eigen::VectorXd& state,
+        const StateTransParams* stateTransParams = nullptr) const;
+
     double dt() const { return m_dt; }
     void setDt(double dt) { m_dt = dt; }
 
+    std::optional<double> fixedStep() const override { return m_dt; }
+    bool setFixedStep(double dt) override {
+        m_dt = dt;
+        return true;
+    }
+
    protected:
+    /**
+     * @brief Closed form Jacobian of continuousDynamics
+     *
+     * Models with a closed form override this, the default has none.
+     * Configuring with GNCPY_CHECK_JACOBIANS checks the result against
+     * finite differences.
+     *
+     * @return std::optional<Eigen::MatrixXd> Jacobian or std::nullopt
+     */
+    virtual std::optional<Eigen::MatrixXd> analyticStateMat(
+        [[maybe_unused]] double timestep,
+        [[maybe_unused]] const Eigen::VectorXd& state,
+        [[maybe_unused]] const StateTransParams* stateTransParams) const {
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Closed form Jacobian of the discrete transition propagateState
+     *
+     * The default differentiates the Runge-Kutta step of propagateState stage
+     * by stage with analyticStateMat, which is exact for the integrator and
+     * costs three evaluations of continuousDynamics. It gives std::nullopt
+     * without a continuous closed form or with a state constraint set. Models
+     * that override propagateState must override this as well.
+     *
+     * @return std::optional<Eigen::MatrixXd> Jacobian or std::nullopt
+     */
+    virtual std::optional<Eigen::MatrixXd> analyticDiscreteStateMat(
+        double timestep, const Eigen::VectorXd& state,
+        const StateTransParams* stateTransParams) const;
+
     std::shared_ptr<control::IControlModel> m_controlModel;
 
    private:
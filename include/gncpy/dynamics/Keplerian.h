@@ -0,0 +1,172 @@
+#pragma once
+#include <Eigen/Dense>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "gncpy/SerializeMacros.h"
+#include "gncpy/dynamics/INonLinearDynamics.h"
+#include "gncpy/dynamics/Parameters.h"
+#include "gncpy/dynamics/TwoBodyJ2.h"
+
+namespace lager::gncpy::dynamics {
+
+/// @brief Classical orbital elements of an elliptic orbit, angles in radians
+struct OrbitalElements {
+    double semiMajorAxis = 0.0;
+    double eccentricity = 0.0;
+    double inclination = 0.0;
+    /// @brief Right ascension of the ascending node, 0 for equatorial orbits
+    double raan = 0.0;
+    /// @brief Argument of periapsis, 0 for circular orbits
+    double argPeriapsis = 0.0;
+    /// @brief True anomaly, measured from the node for circular orbits
+    double trueAnomaly = 0.0;
+};
+
+/**
+ * @brief Convert an inertial position and velocity to orbital elements
+ *
+ * @param state \f$[x, y, z, v_x, v_y, v_z]\f$
+ * @param mu gravitational parameter
+ * @return OrbitalElements elements of the osculating orbit
+ */
+OrbitalElements cartesianToElements(const Eigen::VectorXd& state,
+                                    double mu = TwoBodyJ2::EARTH_MU);
+
+/**
+ * @brief Convert orbital elements to an inertial position and velocity
+ *
+ * @param elements orbital elements
+ * @param mu gravitational parameter
+ * @return Eigen::VectorXd \f$[x, y, z, v_x, v_y, v_z]\f$
+ */
+Eigen::VectorXd elementsToCartesian(const OrbitalElements& elements,
+                                    double mu = TwoBodyJ2::EARTH_MU);
+
+/**
+ * @brief Solve Kepler's equation \f$M = E - e \sin E\f$ for many objects
+ *
+ * Uses Halley iterations evaluated as array expressions, so every object is
+ * updated together and the loop stops once all have converged.
+ *
+ * @throws exceptions::BadParams if an object has not converged after the
+ * iteration limit
+ *
+ * @param meanAnomaly mean anomaly of each object
+ * @param eccentricity eccentricity of each object, in [0, 1)
+ * @return Eigen::ArrayXd eccentric anomaly of each object
+ */
+Eigen::ArrayXd solveKepler(const Eigen::ArrayXd& meanAnomaly,
+                           const Eigen::ArrayXd& eccentricity);
+
+/// @brief Solve Kepler's equation for a single object
+double solveKepler(double meanAnomaly, double eccentricity);
+
+/**
+ * @brief Closed form propagation of unperturbed elliptic orbits
+ *
+ * The state is the inertial position and velocity
+ * \f$[x, y, z, v_x, v_y, v_z]\f$. propagateState solves Kepler's equation for
+ * the change in eccentric anomaly and applies the Lagrange f and g
+ * coefficients, following
+ * \cite Vallado2013_FundamentalsofAstrodynamicsandApplications, so the cost of
+ * a step does not depend on dt and circular or equatorial orbits need no
+ * special handling. The continuous dynamics and Jacobian are those of
+ * TwoBodyJ2 with no J2 term. getStateMat returns the partials of the f and g
+ * solution, so filters propagate the covariance correctly across long gaps.
+ *
+ * propagateBatch uses the same solution for many objects stored one per
+ * row, optionally with a different time step for every object.
+ *
+ */
+class Keplerian final : public INonLinearDynamics {
+    friend class cereal::access;
+
+    GNCPY_SERIALIZE_CLASS(Keplerian)
+
+   public:
+    Keplerian() = default;
+
+    /**
+     * @brief Construct a new Keplerian object
+     *
+     * @param dt time step, any length
+     * @param mu gravitational parameter
+     */
+    explicit Keplerian(double dt, double mu = TwoBodyJ2::EARTH_MU);
+
+    std::vector<std::string> stateNames() const override {
+        return std::vector<std::string>{"x pos", "y pos", "z pos",
+                                        "x vel", "y vel", "z vel"};
+    }
+
+    Eigen::VectorXd continuousDynamics(
+        [[maybe_unused]] double timestep, const Eigen::VectorXd& state,
+        [[maybe_unused]] const StateTransParams* stateTransParams =
+            nullptr) const override;
+
+    using INonLinearDynamics::propagateState;
+
+    /**
+     * @brief Propagate the state forward one dt with the closed form solution
+     *
+     * @param timestep current time
+     * @param state current state, must be on an elliptic orbit
+     * @param stateTransParams unused
+     * @return Eigen::VectorXd Next state
+     */
+    Eigen::VectorXd propagateState(
+        double timestep, const Eigen::VectorXd& state,
+        [[maybe_unused]] const StateTransParams* stateTransParams =
+            nullptr) const override;
+
+    /**
+     * @brief Propagate a batch of states forward one dt in place
+     *
+     * @param timestep current time
+     * @param states one object per row, 6 columns
+     */
+    void propagateBatch(double timestep,
+                        Eigen::Ref<Eigen::MatrixXd> states) const;
+
+    /**
+     * @brief Propagate a batch of states in place, each by its own step
+     *
+     * @param timestep current time
+     * @param states one object per row, 6 columns
+     * @param dts time step of each object
+     */
+    void propagateBatch(double timestep, Eigen::Ref<Eigen::MatrixXd> states,
+                        const Eigen::Ref<const Eigen::VectorXd>& dts) const;
+
+    inline double mu() const { return m_mu; }
+
+   protected:
+    std::optional<Eigen::MatrixXd> analyticStateMat(
+        [[maybe_unused]] double timestep, const Eigen::VectorXd& state,
+        [[maybe_unused]] const StateTransParams* stateTransParams)
+        const override;
+
+    std::optional<Eigen::MatrixXd> analyticDiscreteStateMat(
+        [[maybe_unused]] double timestep, const Eigen::VectorXd& state,
+        [[maybe_unused]] const StateTransParams* stateTransParams)
+        const override;
+
+   private:
+    template <class Archive>
+    void serialize(Archive& ar);
+
+    double m_mu = TwoBodyJ2::EARTH_MU;
+};
+
+template <class Archive>
+void Keplerian::serialize(Archive& ar) {
+    ar(cereal::make_nvp("INonLinearDynamics",
+                        cereal::virtual_base_class<INonLinearDynamics>(this)),
+       CEREAL_NVP(m_mu));
+}
+
+}  // namespace lager::gncpy::dynamics
+
+CEREAL_REGISTER_TYPE(lager::gncpy::dynamics::Keplerian)
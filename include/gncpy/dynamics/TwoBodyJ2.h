@@ -0,0 +1,119 @@
+#pragma once
+#include <Eigen/Dense>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "gncpy/SerializeMacros.h"
+#include "gncpy/dynamics/INonLinearDynamics.h"
+#include "gncpy/dynamics/Parameters.h"
+
+namespace lager::gncpy::dynamics {
+
+/**
+ * @brief Implements two body orbital motion with the J2 perturbation
+ *
+ * The state is the inertial position and velocity
+ * \f$[x, y, z, v_x, v_y, v_z]\f$ and the acceleration is
+ *
+ * \f{align}{
+ *      \ddot{x} &= -\frac{\mu x}{r^3} \left(1 - \frac{3}{2} J_2
+ *          \frac{R^2}{r^2} \left(5 \frac{z^2}{r^2} - 1\right)\right) \\
+ *      \ddot{y} &= -\frac{\mu y}{r^3} \left(1 - \frac{3}{2} J_2
+ *          \frac{R^2}{r^2} \left(5 \frac{z^2}{r^2} - 1\right)\right) \\
+ *      \ddot{z} &= -\frac{\mu z}{r^3} \left(1 - \frac{3}{2} J_2
+ *          \frac{R^2}{r^2} \left(5 \frac{z^2}{r^2} - 3\right)\right)
+ * \f}
+ *
+ * following \cite Vallado2013_FundamentalsofAstrodynamicsandApplications. The
+ * defaults are the WGS-84 Earth values in meters and seconds. Setting
+ * \f$J_2\f$ to zero gives pure two body motion.
+ *
+ * The closed form gradient of the acceleration lets getStateMat
+ * differentiate the Runge-Kutta step of propagateState stage by stage, so
+ * filters propagate the covariance with the exact transition of the
+ * integrator rather than the continuous Jacobian.
+ *
+ * Besides the single state interface, propagateBatch integrates many objects
+ * at once. The batch is stored one object per row, so each state element is
+ * a contiguous column and the Runge-Kutta stages vectorize across objects.
+ * simulation::CatalogPropagator splits a batch over a thread pool.
+ *
+ */
+class TwoBodyJ2 final : public INonLinearDynamics {
+    friend class cereal::access;
+
+    GNCPY_SERIALIZE_CLASS(TwoBodyJ2)
+
+   public:
+    /// @brief Earth gravitational parameter in m^3/s^2
+    static constexpr double EARTH_MU = 3.986004418e14;
+    /// @brief Earth equatorial radius in m
+    static constexpr double EARTH_RADIUS = 6378137.0;
+    /// @brief Earth second zonal harmonic
+    static constexpr double EARTH_J2 = 1.08262668e-3;
+
+    TwoBodyJ2() = default;
+
+    /**
+     * @brief Construct a new Two Body J2 object
+     *
+     * @param dt integration step
+     * @param mu gravitational parameter
+     * @param radius equatorial radius of the central body
+     * @param j2 second zonal harmonic of the central body
+     */
+    explicit TwoBodyJ2(double dt, double mu = EARTH_MU,
+                       double radius = EARTH_RADIUS, double j2 = EARTH_J2);
+
+    std::vector<std::string> stateNames() const override {
+        return std::vector<std::string>{"x pos", "y pos", "z pos",
+                                        "x vel", "y vel", "z vel"};
+    }
+
+    Eigen::VectorXd continuousDynamics(
+        [[maybe_unused]] double timestep, const Eigen::VectorXd& state,
+        [[maybe_unused]] const StateTransParams* stateTransParams =
+            nullptr) const override;
+
+    /**
+     * @brief Propagate a batch of states forward one dt in place
+     *
+     * Uses the same fourth order Runge-Kutta step as propagateState. State
+     * constraints are applied to each object after the step.
+     *
+     * @param timestep current time
+     * @param states one object per row, 6 columns
+     */
+    void propagateBatch(double timestep,
+                        Eigen::Ref<Eigen::MatrixXd> states) const;
+
+    inline double mu() const { return m_mu; }
+    inline double radius() const { return m_radius; }
+    inline double j2() const { return m_j2; }
+
+   protected:
+    std::optional<Eigen::MatrixXd> analyticStateMat(
+        [[maybe_unused]] double timestep, const Eigen::VectorXd& state,
+        [[maybe_unused]] const StateTransParams* stateTransParams)
+        const override;
+
+   private:
+    template <class Archive>
+    void serialize(Archive& ar);
+
+    double m_mu = EARTH_MU;
+    double m_radius = EARTH_RADIUS;
+    double m_j2 = EARTH_J2;
+};
+
+template <class Archive>
+void TwoBodyJ2::serialize(Archive& ar) {
+    ar(cereal::make_nvp("INonLinearDynamics",
+                        cereal::virtual_base_class<INonLinearDynamics>(this)),
+       CEREAL_NVP(m_mu), CEREAL_NVP(m_radius), CEREAL_NVP(m_j2));
+}
+
+}  // namespace lager::gncpy::dynamics
+
+CEREAL_REGISTER_TYPE(lager::gncpy::dynamics::TwoBodyJ2)
@@ -0,0 +1,51 @@
+#pragma once
+#include <Eigen/Dense>
+#include <memory>
+
+#include "gncpy/dynamics/IDynamics.h"
+#include "gncpy/dynamics/ILinearDynamics.h"
+#include "gncpy/dynamics/INonLinearDynamics.h"
+#include "gncpy/dynamics/Parameters.h"
+
+namespace lager::gncpy::filters::detail {
+
+/**
+ * @brief Typed view of the dynamics model of an extended filter
+ *
+ * The filters accept either linear or non-linear dynamics. The binding
+ * resolves the type once so the prediction step does no casting or
+ * reference counting. Exactly one of the views is set once bound.
+ *
+ */
+struct DynamicsBinding {
+    /**
+     * @brief Binds the model, does nothing if it is already bound
+     *
+     * The bound model is compared by ownership rather than address, so a
+     * model loaded or allocated where a freed one lived is still rebound.
+     *
+     * @param dynObj model owned by the filter
+     * @throws TypeError if the model is unset or of unknown type
+     */
+    void bind(const std::shared_ptr<dynamics::IDynamics>& dynObj);
+
+    /**
+     * @brief Discrete state matrix of the bound model
+     *
+     * @param timestep current time
+     * @param state state to linearize about, unused by linear models
+     * @param stateTransParams Parameters needed by the transition model
+     * @return Eigen::MatrixXd state matrix
+     */
+    Eigen::MatrixXd getStateMat(
+        double timestep, const Eigen::VectorXd& state,
+        const dynamics::StateTransParams* stateTransParams) const;
+
+    // the weak pointer keeps the old control block alive, so a different
+    // model can not match even if it reuses the old address
+    std::weak_ptr<const dynamics::IDynamics> bound;
+    const dynamics::INonLinearDynamics* nonLin = nullptr;
+    const dynamics::ILinearDynamics* lin = nullptr;
+};
+
+}  // namespace lager::gncpy::filters::detail
@@ -1,9 +1,14 @@
 #pragma once
 #include <Eigen/Dense>
 #include <cereal/access.hpp>
+#include <cstdint>
+#include <memory>
 
 #include "gncpy/SerializeMacros.h"
 #include "gncpy/dynamics/IDynamics.h"
+#include "gncpy/dynamics/ILinearDynamics.h"
+#include "gncpy/dynamics/INonLinearDynamics.h"
+#include "gncpy/filters/DynamicsBinding.h"
 #include "gncpy/filters/Kalman.h"
 #include "gncpy/filters/Parameters.h"
 #include "gncpy/measurements/ILinearMeasModel.h"
@@ -23,6 +28,46 @@ class ExtendedKalman final : public Kalman {
         const std::optional<Eigen::VectorXd> controlInput,
         const BayesPredictParams* params = nullptr) override;
 
+    /**
+     * @brief Implements the (optionally iterated) correction step
+     *
+     * With more than one iteration the measurement model is relinearized about
+     * the updated estimate until the step between iterates falls below the
+     * convergence tolerance, see @cite Bell1993_TheIteratedKalmanFilterUpdateasaGaussNewtonMethod
+     * The Jacobian from the previous iterate is reused when the step is below
+     * the reuse tolerance. A single iteration is the standard EKF update.
+     *
+     * @param timestep current timestep
+     * @param meas current measurement
+     * @param curState current state estimate
+     * @param measFitProb ouptut measurement fit probability, evaluated at the
+     * predicted state
+     * @param params correction step parameters
+     * @return Eigen::VectorXd corrected state estimate
+     */
+    Eigen::VectorXd correct(
+        double timestep, const Eigen::VectorXd& meas,
+        const Eigen::VectorXd& curState, double& measFitProb,
+        const BayesCorrectParams* params = nullptr) override;
+
+    /**
+     * @brief Set the iteration settings of the correction step
+     *
+     * @param maxIterations maximum number of linearizations, 1 disables
+     * iterating
+     * @param tolerance stop once the norm of the step between iterates is
+     * below this
+     * @param jacobianReuseTolerance reuse the previous Jacobian when the step
+     * is below this, reuse is opt-in and the default 0 always relinearizes
+     */
+    void setIterations(unsigned int maxIterations, double tolerance = 1e-6,
+                       double jacobianReuseTolerance = 0.0);
+
+    inline unsigned int maxIterations() const { return m_maxIterations; }
+
+    /// @brief Number of iterations used by the last correction step
+    inline unsigned int lastIterations() const { return m_lastIterations; }
+
     void setStateModel(std::shared_ptr<dynamics::IDynamics> dynObj,
                        Eigen::MatrixXd procNoise) override;
 
@@ -32,23 +77,50 @@ class ExtendedKalman final : public Kalman {
     std::shared_ptr<dynamics::IDynamics> dynamicsModel() const override;
     std::shared_ptr<measurements::IMeasModel> measurementModel() const override;
 
+    Eigen::MatrixXd measurementNoise() const override { return m_measNoise; }
+
+   protected:
+    const measurements::IMeasModel& viewMeasurementModel() const override;
+
    private:
     template <class Archive>
-    void serialize(Archive& ar);
+    void serialize(Archive& ar, const std::uint32_t version);
 
     bool m_continuousCov = false;
 
+    unsigned int m_maxIterations = 1;
+    double m_iterTol = 1e-6;
+    // 0 disables Jacobian reuse, set through setIterations
+    double m_jacReuseTol = 0.0;
+    unsigned int m_lastIterations = 0;
+
     Eigen::MatrixXd m_measNoise;
     std::shared_ptr<dynamics::IDynamics> m_dynObj;
     std::shared_ptr<measurements::IMeasModel> m_measObj;
+
+    // bound when the model is set and before every prediction, so a loaded
+    // model is picked up
+    detail::DynamicsBinding m_dyn;
 };
 
 template <class Archive>
-void ExtendedKalman::serialize(Archive& ar) {
+void ExtendedKalman::serialize(Archive& ar, const std::uint32_t version) {
     ar(cereal::make_nvp("Kalman", cereal::virtual_base_class<Kalman>(this)),
        CEREAL_NVP(m_dynObj), CEREAL_NVP(m_continuousCov));
+
+    // version 0 archives predate the iteration settings, loading one gives the
+    // standard single iteration update
+    if (version >= 1) {
+        ar(CEREAL_NVP(m_maxIterations), CEREAL_NVP(m_iterTol),
+           CEREAL_NVP(m_jacReuseTol));
+    } else {
+        m_maxIterations = 1;
+        m_iterTol = 1e-6;
+        m_jacReuseTol = 0.0;
+    }
 }
 
 }  // namespace lager::gncpy::filters
 
+CEREAL_CLASS_VERSION(lager::gncpy::filters::ExtendedKalman, 1)
 CEREAL_REGISTER_TYPE(lager::gncpy::filters::ExtendedKalman)
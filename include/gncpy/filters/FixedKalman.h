@@ -0,0 +1,119 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+
+#include "gncpy/math/Matrix.h"
+#include "gncpy/math/Vector.h"
+
+namespace lager::gncpy::filters {
+
+/**
+ * @brief Kalman Filter with sizes fixed at compile time
+ *
+ * Discrete time linear KF for embedded targets built on the heap free
+ * matrix::Matrix types. The models are plain matrices instead of the
+ * dynamics and measurement classes, nothing allocates or throws, and the
+ * work per step is fixed, so the filter runs deterministically. A
+ * measurement whose innovation covariance can not be Cholesky factorized is
+ * reported by the return value of correct rather than an exception.
+ *
+ * @tparam T scalar type
+ * @tparam N state dimension
+ * @tparam M measurement dimension
+ */
+template <typename T, std::size_t N, std::size_t M>
+class FixedKalman {
+   public:
+    using StateVec = matrix::Vector<T, N>;
+    using StateMat = matrix::Matrix<T, N, N>;
+    using MeasVec = matrix::Vector<T, M>;
+    using MeasMat = matrix::Matrix<T, M, N>;
+    using MeasCov = matrix::Matrix<T, M, M>;
+
+    /**
+     * @brief Sets the state model of the form \f$x_{k+1} = F x_k\f$
+     *
+     * @param stateMat state transition matrix
+     * @param procNoise process noise matrix
+     */
+    void setStateModel(const StateMat& stateMat,
+                       const StateMat& procNoise) noexcept {
+        m_stateMat = stateMat;
+        m_procNoise = procNoise;
+    }
+
+    /**
+     * @brief Sets the measurement model of the form \f$y_k = H x_k\f$
+     *
+     * @param measMat measurement matrix
+     * @param measNoise measurement noise matrix
+     */
+    void setMeasurementModel(const MeasMat& measMat,
+                             const MeasCov& measNoise) noexcept {
+        m_measMat = measMat;
+        m_measNoise = measNoise;
+    }
+
+    /**
+     * @brief Implements a discrete time prediction step
+     *
+     * @param curState current state estimate
+     * @return StateVec predicted state estimate
+     */
+    StateVec predict(const StateVec& curState) noexcept {
+        m_cov = matrix::symmetricProduct(m_stateMat, m_cov) + m_procNoise;
+        return m_stateMat * curState;
+    }
+
+    /**
+     * @brief Implements a discrete time correction step
+     *
+     * @param meas current measurement
+     * @param state current state estimate, replaced by the corrected
+     * estimate
+     * @param measFitProb output measurement fit probability
+     * @return true if the innovation covariance is positive definite,
+     * otherwise the state and covariance are left unchanged
+     */
+    bool correct(const MeasVec& meas, StateVec& state,
+                 T& measFitProb) noexcept {
+        const MeasCov inovCov =
+            matrix::symmetricProduct(m_measMat, m_cov) + m_measNoise;
+        const matrix::Cholesky<T, M> chol(inovCov);
+        if (!chol.ok()) {
+            measFitProb = T(0);
+            return false;
+        }
+
+        // K = P H^T S^-1, the products only need solves against S
+        const matrix::Matrix<T, N, M> covMeasT = m_cov * m_measMat.transpose();
+        const MeasVec inov = meas - m_measMat * state;
+        const MeasVec weighted = chol.solve(inov);
+        state += covMeasT * weighted;
+        m_cov -= covMeasT * chol.solve(covMeasT.transpose());
+
+        measFitProb = std::exp(T(-0.5) * inov.dot(weighted)) /
+                      std::sqrt(std::pow(T(2.0 * M_PI), T(M)) *
+                                chol.determinant());
+        return true;
+    }
+
+    inline StateMat& getCov() noexcept { return m_cov; }
+    inline const StateMat& viewCov() const noexcept { return m_cov; }
+
+    inline const StateMat& stateMat() const noexcept { return m_stateMat; }
+    inline const StateMat& processNoise() const noexcept {
+        return m_procNoise;
+    }
+    inline const MeasMat& measMat() const noexcept { return m_measMat; }
+    inline const MeasCov& measNoise() const noexcept { return m_measNoise; }
+
+   private:
+    StateMat m_stateMat = StateMat::identity();
+    StateMat m_procNoise;
+    MeasMat m_measMat;
+    MeasCov m_measNoise;
+    StateMat m_cov = StateMat::identity();
+};
+
+}  // namespace lager::gncpy::filters
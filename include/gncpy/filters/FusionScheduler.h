@@ -0,0 +1,177 @@
+#pragma once
+#include <Eigen/Dense>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "gncpy/dynamics/IDynamics.h"
+#include "gncpy/filters/IBayesFilter.h"
+#include "gncpy/filters/Parameters.h"
+#include "gncpy/utilities/ThreadPool.h"
+
+namespace lager::gncpy::filters {
+
+/**
+ * @brief Schedules measurements from multiple sensors onto independent tracks
+ *
+ * Producers may submit timestamped measurements from any thread. On each call
+ * to process the pending measurements of a track are ordered by time (ties
+ * keep their submission order), predictions to the same timestamp are
+ * coalesced into one, and each track with work is handed to a work stealing
+ * thread pool. Tracks are processed in parallel but a single track is only
+ * ever touched by one worker at a time.
+ *
+ * Every track must own its filter, the filters store the covariance. The
+ * filter is predicted once from the track time to the next measurement time.
+ * Since the models step by a stored dt, a track given a step hook has it
+ * called with the gap before every prediction, setModelStep does this for
+ * the library models. The dynamics model of such a track is modified and
+ * must be owned by the track. Without a hook every gap must equal the step
+ * of the model, a measurement at a different gap is rejected and the rest of
+ * the batch is still fused. Models and parameters of tracks without a hook
+ * may be shared between tracks.
+ *
+ * The track accessors wait for a track being processed to finish.
+ *
+ */
+class FusionScheduler {
+   public:
+    using TrackId = uint64_t;
+
+    /// @brief Sets the step of a dynamics model to the gap before a predict
+    using StepHook = std::function<void(dynamics::IDynamics&, double)>;
+
+    /**
+     * @brief Construct a new Fusion Scheduler object
+     *
+     * @param numThreads number of worker threads, 0 uses the hardware
+     * concurrency
+     */
+    explicit FusionScheduler(size_t numThreads = 0);
+
+    /**
+     * @brief Add a new track
+     *
+     * @param filter filter owned by the track, its dynamics model must be set
+     * and its covariance initialized. The model is looked up once here and
+     * must not be replaced afterwards.
+     * @param time time of the initial estimate
+     * @param state initial state estimate
+     * @param predParams parameters used for every prediction of the track
+     * @param setStep sets the step of the dynamics model to each gap between
+     * measurements, see setModelStep
+     * @return TrackId id used to submit measurements to the track
+     * @throws TypeError if the filter has no dynamics model
+     */
+    TrackId addTrack(std::shared_ptr<IBayesFilter> filter, double time,
+                     const Eigen::VectorXd& state,
+                     std::shared_ptr<const BayesPredictParams> predParams =
+                         nullptr,
+                     StepHook setStep = nullptr);
+
+    /**
+     * @brief Step hook for any model with a stored dt
+     *
+     * Uses IDynamics::setFixedStep.
+     *
+     * @throws BadParams if the model does not step by a stored dt
+     */
+    static void setModelStep(dynamics::IDynamics& dynObj, double dt);
+
+    /**
+     * @brief Queue a measurement for a track, safe to call from any thread
+     *
+     * @param id track the measurement belongs to
+     * @param time time the measurement was taken
+     * @param meas measurement vector
+     * @param params correction parameters for the measurement
+     */
+    void submit(TrackId id, double time, Eigen::VectorXd meas,
+                std::shared_ptr<const BayesCorrectParams> params = nullptr);
+
+    /**
+     * @brief Fuse all queued measurements up to a time
+     *
+     * Measurements after the horizon stay queued so slower sensors can still
+     * deliver earlier data. Measurements older than their track are dropped.
+     * Blocks until all tracks are processed, submit may still be called
+     * concurrently.
+     *
+     * @param horizon latest measurement time to fuse
+     * @return size_t number of measurements fused
+     */
+    size_t process(double horizon = std::numeric_limits<double>::infinity());
+
+    double trackTime(TrackId id) const;
+    Eigen::VectorXd trackState(TrackId id) const;
+    Eigen::MatrixXd trackCov(TrackId id) const;
+
+    inline size_t numTracks() const {
+        std::shared_lock<std::shared_mutex> lk(m_tracksMut);
+        return m_tracks.size();
+    }
+    inline size_t numThreads() const { return m_pool.size(); }
+
+    /// @brief Number of prediction steps run over all tracks
+    inline size_t numPredicts() const { return m_numPredicts; }
+    /// @brief Number of measurements fused over all tracks
+    inline size_t numCorrects() const { return m_numCorrects; }
+    /// @brief Number of measurements dropped for being older than their track
+    inline size_t numDropped() const { return m_numDropped; }
+    /// @brief Number of measurements rejected for a gap that does not match
+    /// the step of a track without a step hook
+    inline size_t numRejected() const { return m_numRejected; }
+
+    /// @brief Tolerance when deciding if two times are the same
+    double timeTolerance = 1e-9;
+
+   private:
+    struct Measurement {
+        double time;
+        uint64_t seq;
+        Eigen::VectorXd meas;
+        std::shared_ptr<const BayesCorrectParams> params;
+    };
+
+    struct Track {
+        std::shared_ptr<IBayesFilter> filter;
+        // looked up once, the filter's model must not be replaced
+        std::shared_ptr<dynamics::IDynamics> dynObj;
+        std::shared_ptr<const BayesPredictParams> predParams;
+        StepHook setStep;
+
+        // held while the track is processed and by the accessors
+        std::mutex stateMut;
+        double time;
+        Eigen::VectorXd state;
+
+        std::mutex pendingMut;
+        std::vector<Measurement> pending;
+    };
+
+    Track& track(TrackId id) const;
+    size_t processTrack(Track& trk, double horizon);
+
+    mutable std::shared_mutex m_tracksMut;
+    std::unordered_map<TrackId, std::unique_ptr<Track>> m_tracks;
+    TrackId m_nextId = 0;
+
+    std::atomic<uint64_t> m_nextSeq = 0;
+    std::atomic<size_t> m_numPredicts = 0;
+    std::atomic<size_t> m_numCorrects = 0;
+    std::atomic<size_t> m_numDropped = 0;
+    std::atomic<size_t> m_numRejected = 0;
+
+    // serializes calls to process
+    std::mutex m_processMut;
+    utilities::ThreadPool m_pool;
+};
+
+}  // namespace lager::gncpy::filters
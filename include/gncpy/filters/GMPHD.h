@@ -0,0 +1,168 @@
+#pragma once
+#include <Eigen/Dense>
+#include <cereal/access.hpp>
+#include <cereal/types/memory.hpp>
+#include <cereal/types/vector.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "gncpy/SerializeMacros.h"
+#include "gncpy/dynamics/IDynamics.h"
+#include "gncpy/dynamics/ILinearDynamics.h"
+#include "gncpy/filters/GaussianMixture.h"
+#include "gncpy/filters/Parameters.h"
+#include "gncpy/math/SerializeEigen.h"
+#include "gncpy/measurements/ILinearMeasModel.h"
+#include "gncpy/measurements/IMeasModel.h"
+
+namespace lager::gncpy::filters {
+
+/**
+ * @brief Implements a Gaussian Mixture Probability Hypothesis Density filter
+ *
+ * This is a multi-target filter that propagates the first order moment of the
+ * multi-target posterior as a Gaussian mixture, see
+ * @cite Vo2006_GaussianMixtureProbabilityHypothesisDensityFilter. The
+ * dynamics and measurement models must be linear and the per component
+ * prediction and correction follow the Kalman filter equations.
+ *
+ * The correction step is evaluated for all components and all measurements at
+ * once. Merging uses a uniform grid over a subset of the state (set by
+ * setMergeIndices) to find candidate components so the cost grows roughly
+ * linearly with the number of components instead of quadratically.
+ *
+ */
+class GMPHD {
+    friend class cereal::access;
+
+    GNCPY_SERIALIZE_CLASS(GMPHD)
+
+   public:
+    GMPHD() = default;
+
+    /**
+     * @brief Implements the prediction step
+     *
+     * Every surviving component is propagated through the dynamics model and
+     * the birth components are appended.
+     *
+     * @param timestep current timestep
+     * @param params prediction parameters
+     */
+    void predict(double timestep, const BayesPredictParams* params = nullptr);
+
+    /**
+     * @brief Implements the correction step
+     *
+     * @param timestep current timestep
+     * @param meas measurements for this scan, one measurement per column
+     * @param params correction parameters
+     */
+    void correct([[maybe_unused]] double timestep, const Eigen::MatrixXd& meas,
+                 const BayesCorrectParams* params = nullptr);
+
+    /// @brief Removes components with weights below the prune threshold
+    void prune();
+
+    /**
+     * @brief Merges components that are within the merge threshold
+     *
+     * Components are visited in order of decreasing weight and every remaining
+     * component within the squared Mahalanobis distance of the current one is
+     * merged into it.
+     *
+     * @throws BadParams if a mean is not finite along the merge indices
+     */
+    void merge();
+
+    /// @brief Keeps only the highest weighted components, up to the maximum
+    void cap();
+
+    /// @brief Runs prune, merge, and cap in order
+    void cleanup();
+
+    /**
+     * @brief Get the state estimates
+     *
+     * Every component with a weight above the extraction threshold contributes
+     * round(weight) copies of its mean.
+     *
+     * @return std::vector<Eigen::VectorXd> state estimates
+     */
+    std::vector<Eigen::VectorXd> extractStates() const;
+
+    /// @brief Expected number of targets (sum of the weights)
+    inline double expectedCardinality() const {
+        return m_mixture.totalWeight();
+    }
+
+    /**
+     * @brief Sets the state model equation for the filter.
+     *
+     * @param dynObj Linear dynamics of type dynamics::ILinearDynamics
+     * @param procNoise Process noise matrix for the filter
+     */
+    void setStateModel(std::shared_ptr<dynamics::IDynamics> dynObj,
+                       Eigen::MatrixXd procNoise);
+
+    /**
+     * @brief Sets the measurement model for the filter.
+     *
+     * @param measObj linear measurement model of type
+     * measurements::ILinearMeasModel
+     * @param measNoise measurement noise matrix for the filter
+     */
+    void setMeasurementModel(std::shared_ptr<measurements::IMeasModel> measObj,
+                             Eigen::MatrixXd measNoise);
+
+    /// @brief Set the mixture appended during each prediction step
+    inline void setBirthModel(const GaussianMixture& birth) {
+        m_birth = birth;
+    }
+
+    /**
+     * @brief Set the state indices used to build the merge grid
+     *
+     * These are typically the position states. At most 3 indices are used.
+     *
+     * @param inds state indices
+     */
+    void setMergeIndices(const std::vector<uint8_t>& inds);
+
+    inline GaussianMixture& mixture() { return m_mixture; }
+    inline const GaussianMixture& viewMixture() const { return m_mixture; }
+
+    double probDetection = 0.98;
+    double probSurvival = 0.99;
+    double clutterDensity = 1e-6;
+    double pruneThreshold = 1e-5;
+    double mergeThreshold = 4.0;
+    double extractThreshold = 0.5;
+    Eigen::Index maxComponents = 100;
+
+   private:
+    template <class Archive>
+    void serialize(Archive& ar);
+
+    GaussianMixture m_mixture;
+    GaussianMixture m_birth;
+    std::vector<uint8_t> m_mergeInds{0, 1};
+
+    Eigen::MatrixXd m_procNoise;
+    Eigen::MatrixXd m_measNoise;
+    std::shared_ptr<dynamics::ILinearDynamics> m_dynObj;
+    std::shared_ptr<measurements::ILinearMeasModel> m_measObj;
+};
+
+template <class Archive>
+void GMPHD::serialize(Archive& ar) {
+    ar(CEREAL_NVP(probDetection), CEREAL_NVP(probSurvival),
+       CEREAL_NVP(clutterDensity), CEREAL_NVP(pruneThreshold),
+       CEREAL_NVP(mergeThreshold), CEREAL_NVP(extractThreshold),
+       CEREAL_NVP(maxComponents), CEREAL_NVP(m_mixture), CEREAL_NVP(m_birth),
+       CEREAL_NVP(m_mergeInds), CEREAL_NVP(m_procNoise),
+       CEREAL_NVP(m_measNoise), CEREAL_NVP(m_dynObj), CEREAL_NVP(m_measObj));
+}
+
+}  // namespace lager::gncpy::filters
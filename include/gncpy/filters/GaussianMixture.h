@@ -0,0 +1,114 @@
+#pragma once
+#include <Eigen/Dense>
+#include <cereal/access.hpp>
+#include <cstddef>
+
+#include "gncpy/SerializeMacros.h"
+#include "gncpy/math/SerializeEigen.h"
+
+namespace lager::gncpy::filters {
+
+/**
+ * @brief Contiguous storage for a weighted mixture of Gaussians
+ *
+ * All components share the same state dimension \f$n\f$. The means are stored
+ * as the columns of an \f$n \times J\f$ matrix and the covariances are stored
+ * side by side in an \f$n \times nJ\f$ matrix so batched operations can be
+ * applied to every component with a single matrix product. Storage grows
+ * geometrically so adding components is amortized constant time.
+ *
+ */
+class GaussianMixture {
+    friend class cereal::access;
+
+    GNCPY_SERIALIZE_CLASS(GaussianMixture)
+
+   public:
+    GaussianMixture() = default;
+    explicit GaussianMixture(Eigen::Index stateDim) : m_stateDim(stateDim) {}
+
+    inline Eigen::Index size() const { return m_size; }
+    inline Eigen::Index stateDim() const { return m_stateDim; }
+    inline bool empty() const { return m_size == 0; }
+
+    /**
+     * @brief Reserve storage for at least the given number of components
+     *
+     * Existing components are kept.
+     *
+     * @param capacity number of components to allocate space for
+     */
+    void reserve(Eigen::Index capacity);
+
+    /**
+     * @brief Change the number of components
+     *
+     * New components are uninitialized, existing components up to the new size
+     * are kept.
+     *
+     * @param numComponents new number of components
+     */
+    void resize(Eigen::Index numComponents);
+
+    /// @brief Remove all components, capacity is kept
+    inline void clear() { m_size = 0; }
+
+    /**
+     * @brief Add a component to the end of the mixture
+     *
+     * @param weight component weight
+     * @param mean component mean
+     * @param cov component covariance
+     */
+    void add(double weight, const Eigen::VectorXd& mean,
+             const Eigen::MatrixXd& cov);
+
+    /// @brief Add all components of another mixture to the end of this one
+    void append(const GaussianMixture& other);
+
+    inline double& weight(Eigen::Index ind) { return m_weights(ind); }
+    inline double weight(Eigen::Index ind) const { return m_weights(ind); }
+
+    inline auto mean(Eigen::Index ind) { return m_means.col(ind); }
+    inline auto mean(Eigen::Index ind) const { return m_means.col(ind); }
+
+    inline auto cov(Eigen::Index ind) {
+        return m_covs.middleCols(ind * m_stateDim, m_stateDim);
+    }
+    inline auto cov(Eigen::Index ind) const {
+        return m_covs.middleCols(ind * m_stateDim, m_stateDim);
+    }
+
+    /// @brief View of all the active weights
+    inline auto weights() { return m_weights.head(m_size); }
+    inline auto weights() const { return m_weights.head(m_size); }
+
+    /// @brief View of all the active means, one component per column
+    inline auto means() { return m_means.leftCols(m_size); }
+    inline auto means() const { return m_means.leftCols(m_size); }
+
+    /// @brief View of all the active covariances, stacked horizontally
+    inline auto covs() { return m_covs.leftCols(m_size * m_stateDim); }
+    inline auto covs() const { return m_covs.leftCols(m_size * m_stateDim); }
+
+    /// @brief Sum of all component weights
+    inline double totalWeight() const { return weights().sum(); }
+
+   private:
+    template <class Archive>
+    void serialize(Archive& ar);
+
+    Eigen::Index m_stateDim = 0;
+    Eigen::Index m_size = 0;
+    Eigen::VectorXd m_weights;
+    Eigen::MatrixXd m_means;
+    Eigen::MatrixXd m_covs;
+};
+
+template <class Archive>
+void GaussianMixture::serialize(Archive& ar) {
+    ar(CEREAL_NVP(m_stateDim), CEREAL_NVP(m_size), CEREAL_NVP(m_weights),
+       CEREAL_NVP(m_means), CEREAL_NVP(m_covs));
+}
+
+}  // namespace lager::gncpy::filters
@@ -9,6 +9,7 @@
 #include <memory>
 #include <optional>
 
+#include "gncpy/Exceptions.h"
 #include "gncpy/dynamics/IDynamics.h"
 #include "gncpy/filters/Parameters.h"
 #include "gncpy/math/SerializeEigen.h"
@@ -75,6 +76,16 @@ class IBayesFilter {
     virtual std::shared_ptr<measurements::IMeasModel> measurementModel()
         const = 0;
 
+    /**
+     * @brief Measurement noise matrix given to setMeasurementModel
+     *
+     * @throws NotImplemented unless the filter overrides it
+     */
+    inline virtual Eigen::MatrixXd measurementNoise() const {
+        throw exceptions::NotImplemented(
+            "Filter does not provide its measurement noise");
+    }
+
     inline virtual Eigen::MatrixXd& getCov() { return m_cov; }
     inline virtual const Eigen::MatrixXd& viewCov() { return m_cov; }
 
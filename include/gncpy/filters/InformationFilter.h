@@ -0,0 +1,204 @@
+#pragma once
+#include <Eigen/Dense>
+#include <cereal/types/memory.hpp>
+#include <memory>
+#include <optional>
+
+#include "gncpy/SerializeMacros.h"
+#include "gncpy/dynamics/IDynamics.h"
+#include "gncpy/filters/IBayesFilter.h"
+#include "gncpy/filters/Parameters.h"
+#include "gncpy/math/SerializeEigen.h"
+#include "gncpy/measurements/IMeasModel.h"
+
+namespace lager::gncpy::filters {
+
+/**
+ * @brief Information space contribution of one or more measurements
+ *
+ * Contributions are additive, so measurements from any number of sensors can
+ * be converted independently (and in parallel) and summed in any order before
+ * a single call to InformationFilter::fuse.
+ *
+ */
+struct InfoContribution {
+    /// @brief Information matrix increment \f$H^T R^{-1} H\f$
+    Eigen::MatrixXd info;
+    /// @brief Information vector increment \f$H^T R^{-1} (z - h(\bar{x}) +
+    /// H \bar{x})\f$
+    Eigen::VectorXd vec;
+
+    InfoContribution& operator+=(const InfoContribution& other);
+};
+
+/**
+ * @brief Implements a discrete time information filter
+ *
+ * The estimate is carried as the information matrix \f$Y = P^{-1}\f$ and
+ * measurement updates are additive in information space, see
+ * @cite Mutambara1998_DecentralizedEstimationandControlforMultisensorSystems
+ * The covariance and information matrix are converted lazily, a full
+ * predict and correct cycle costs two inversions no matter how many
+ * measurements are fused. Every contribution is weighted by \f$R^{-1}\f$,
+ * which is inverted once when the measurement model is set.
+ *
+ */
+class InformationFilter : public IBayesFilter {
+    friend class cereal::access;
+
+    GNCPY_SERIALIZE_CLASS(InformationFilter)
+
+   public:
+    /**
+     * @brief Implements a discrete time prediction step
+     *
+     * @param timestep current timestep
+     * @param curState current state estmiate
+     * @param controlInput optional control input
+     * @param params prediction parameters
+     * @return Eigen::VectorXd predicted state estimate
+     */
+    Eigen::VectorXd predict(
+        double timestep, const Eigen::VectorXd& curState,
+        [[maybe_unused]] const std::optional<Eigen::VectorXd> controlInput,
+        const BayesPredictParams* params = nullptr) override;
+
+    /**
+     * @brief Fuses a single measurement
+     *
+     * Equivalent to fuse with the measurement contribution, but also computes
+     * the measurement fit probability which needs the innovation covariance.
+     *
+     * @param timestep current timestep
+     * @param meas current measurement
+     * @param curState current state estimate
+     * @param measFitProb ouptut measurement fit probability
+     * @param params correction step parameters
+     * @return Eigen::VectorXd corrected state estimate
+     */
+    Eigen::VectorXd correct(
+        [[maybe_unused]] double timestep, const Eigen::VectorXd& meas,
+        const Eigen::VectorXd& curState, double& measFitProb,
+        const BayesCorrectParams* params = nullptr) override;
+
+    /**
+     * @brief Converts a measurement to its information space contribution
+     *
+     * Does not modify the filter so it may be called concurrently.
+     *
+     * @param meas measurement vector
+     * @param curState state estimate the model is linearized about
+     * @param params correction step parameters
+     * @return InfoContribution contribution of the measurement
+     */
+    InfoContribution contribution(
+        const Eigen::VectorXd& meas, const Eigen::VectorXd& curState,
+        const BayesCorrectParams* params = nullptr) const;
+
+    /**
+     * @brief Applies the sum of measurement contributions
+     *
+     * @param curState state estimate the contributions were linearized about
+     * @param total summed contributions
+     * @return Eigen::VectorXd corrected state estimate
+     */
+    Eigen::VectorXd fuse(const Eigen::VectorXd& curState,
+                         const InfoContribution& total);
+
+    /**
+     * @brief Sets the state model equation for the filter.
+     *
+     * @param dynObj Linear dynamics of type dynamics::ILinearDynamics
+     * @param procNoise Process noise matrix for the filter
+     */
+    void setStateModel(std::shared_ptr<dynamics::IDynamics> dynObj,
+                       Eigen::MatrixXd procNoise) override;
+
+    /**
+     * @brief Sets the measurement model for the filter.
+     *
+     * @param measObj linear measurement model of type
+     * measurements::ILinearMeasModel
+     * @param measNoise positive definite measurement noise matrix
+     */
+    void setMeasurementModel(std::shared_ptr<measurements::IMeasModel> measObj,
+                             Eigen::MatrixXd measNoise) override;
+
+    std::shared_ptr<dynamics::IDynamics> dynamicsModel() const override;
+    std::shared_ptr<measurements::IMeasModel> measurementModel() const override;
+
+    Eigen::MatrixXd measurementNoise() const override { return m_measNoise; }
+
+    Eigen::MatrixXd& getCov() override;
+    const Eigen::MatrixXd& viewCov() override;
+
+    /// @brief Mutable information matrix, invalidates the covariance
+    Eigen::MatrixXd& getInfo();
+    /// @brief Information matrix, converted from the covariance if needed
+    const Eigen::MatrixXd& viewInfo();
+
+   protected:
+    /**
+     * @brief Discrete state matrix used to propagate the covariance
+     *
+     * @param timestep current timestep
+     * @param curState current state estimate
+     * @param params prediction parameters
+     * @return Eigen::MatrixXd state matrix
+     */
+    virtual Eigen::MatrixXd getStateMat(
+        double timestep, const Eigen::VectorXd& curState,
+        const BayesPredictParams* params) const;
+
+    /**
+     * @brief Measurement model used by the correction step
+     *
+     * Unlike measurementModel this does no reference counting per call.
+     *
+     * @return const measurements::IMeasModel& measurement model
+     */
+    const measurements::IMeasModel& viewMeasurementModel() const;
+
+    void setModels(std::shared_ptr<dynamics::IDynamics> dynObj,
+                   Eigen::MatrixXd procNoise);
+    /// @brief Dynamics model without copying the pointer, empty if unset
+    inline const std::shared_ptr<dynamics::IDynamics>& dynamicsHandle() const {
+        return m_dynObj;
+    }
+    void setMeasModel(std::shared_ptr<measurements::IMeasModel> measObj,
+                      Eigen::MatrixXd measNoise);
+
+   private:
+    template <class Archive>
+    void serialize(Archive& ar);
+
+    // contribution of a measurement already linearized about curState
+    InfoContribution contribution(const Eigen::VectorXd& meas,
+                                  const Eigen::VectorXd& curState,
+                                  const Eigen::VectorXd& estMeas,
+                                  const Eigen::MatrixXd& measMat) const;
+
+    Eigen::MatrixXd m_procNoise;
+    Eigen::MatrixXd m_measNoise;
+    Eigen::MatrixXd m_measNoiseInv;
+
+    Eigen::MatrixXd m_info;
+    bool m_covValid = true;
+    bool m_infoValid = false;
+
+    std::shared_ptr<dynamics::IDynamics> m_dynObj;
+    std::shared_ptr<measurements::IMeasModel> m_measObj;
+};
+
+template <class Archive>
+void InformationFilter::serialize(Archive& ar) {
+    ar(cereal::make_nvp("IBayesFilter",
+                        cereal::virtual_base_class<IBayesFilter>(this)),
+       CEREAL_NVP(m_procNoise), CEREAL_NVP(m_measNoise),
+       CEREAL_NVP(m_measNoiseInv), CEREAL_NVP(m_info), CEREAL_NVP(m_covValid),
+       CEREAL_NVP(m_infoValid), CEREAL_NVP(m_dynObj), CEREAL_NVP(m_measObj));
+}
+
+}  // namespace lager::gncpy::filters
+
+CEREAL_REGISTER_TYPE(lager::gncpy::filters::InformationFilter)
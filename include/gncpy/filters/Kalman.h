@@ -94,10 +94,38 @@ class Kalman : public IBayesFilter {
     std::shared_ptr<dynamics::IDynamics> dynamicsModel() const override;
     std::shared_ptr<measurements::IMeasModel> measurementModel() const override;
 
+    /// @brief Process noise matrix used by the prediction step
+    inline const Eigen::MatrixXd& processNoise() const { return m_procNoise; }
+
+    Eigen::MatrixXd measurementNoise() const override { return m_measNoise; }
+
+    /**
+     * @brief Calculates the innovation covariance used by the correction step
+     *
+     * @param measMat measurement matrix
+     * @param cov state covariance the measurement is applied to
+     * @return Eigen::MatrixXd innovation covariance
+     */
+    Eigen::MatrixXd calcInovCov(const Eigen::MatrixXd& measMat,
+                                const Eigen::MatrixXd& cov) const;
+
    protected:
+    /**
+     * @brief Measurement model used by the correction step
+     *
+     * The model type is validated when it is set, so unlike
+     * measurementModel this does no casting or reference counting per call.
+     *
+     * @return const measurements::IMeasModel& measurement model
+     */
+    virtual const measurements::IMeasModel& viewMeasurementModel() const;
+
     Eigen::MatrixXd m_procNoise;
 
    private:
+    /// @brief Linear dynamics used by the prediction step
+    const dynamics::ILinearDynamics& viewDynamicsModel() const;
+
     template <class Archive>
     void serialize(Archive& ar);
 
@@ -0,0 +1,137 @@
+#pragma once
+#include <Eigen/Dense>
+#include <memory>
+
+#include "gncpy/dynamics/IDynamics.h"
+#include "gncpy/dynamics/ILinearDynamics.h"
+#include "gncpy/dynamics/Parameters.h"
+#include "gncpy/measurements/ILinearMeasModel.h"
+#include "gncpy/measurements/IMeasModel.h"
+#include "gncpy/measurements/Parameters.h"
+
+namespace lager::gncpy::filters {
+
+/**
+ * @brief Bank of linear Kalman filters sharing one model, in any precision
+ *
+ * Every track uses the same linear dynamics and measurement models, so the
+ * model matrices are evaluated once per step in double precision and cast to
+ * the scalar type of the bank. States are stored one track per column and
+ * covariances side by side in a single matrix, which turns the prediction
+ * into two large products instead of one small product per track. With a
+ * float bank the storage is halved and twice as many values fit in a SIMD
+ * register.
+ *
+ * Each track solves against a Cholesky factor of its own innovation
+ * covariance \f$H P_i H^T + R\f$. Every factor is computed before any track
+ * is updated, so if one fails correct throws BadParams and leaves the whole
+ * bank unchanged. Float and double instantiations are compiled
+ * into the library.
+ *
+ * @tparam T scalar type of the states and covariances
+ */
+template <typename T>
+class KalmanBank {
+   public:
+    using Scalar = T;
+    using Vector = Eigen::Matrix<T, Eigen::Dynamic, 1>;
+    using Matrix = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>;
+
+    /**
+     * @brief Sets the state model shared by every track
+     *
+     * @param dynObj Linear dynamics of type dynamics::ILinearDynamics
+     * @param procNoise Process noise matrix for the filter
+     */
+    void setStateModel(std::shared_ptr<dynamics::IDynamics> dynObj,
+                       const Eigen::MatrixXd& procNoise);
+
+    /**
+     * @brief Sets the measurement model shared by every track
+     *
+     * @param measObj linear measurement model of type
+     * measurements::ILinearMeasModel
+     * @param measNoise measurement noise matrix for the filter
+     */
+    void setMeasurementModel(std::shared_ptr<measurements::IMeasModel> measObj,
+                             const Eigen::MatrixXd& measNoise);
+
+    /**
+     * @brief Replaces the tracks in the bank
+     *
+     * @param states one state per column
+     * @param covs covariances side by side, the covariance of column i of
+     * states is the i-th square block
+     */
+    void setTracks(const Eigen::Ref<const Matrix>& states,
+                   const Eigen::Ref<const Matrix>& covs);
+
+    /**
+     * @brief Predicts every track forward one step
+     *
+     * The states are propagated with the state matrix only, state
+     * constraints and control inputs are not applied.
+     *
+     * @param timestep current timestep
+     * @param params state transition parameters
+     */
+    void predict(double timestep,
+                 const dynamics::StateTransParams* params = nullptr);
+
+    /**
+     * @brief Corrects every track with its own measurement
+     *
+     * @param timestep current timestep
+     * @param meas one measurement per column, in the order of the tracks
+     * @param params measurement parameters
+     */
+    void correct(double timestep, const Eigen::Ref<const Matrix>& meas,
+                 const measurements::MeasParams* params = nullptr);
+
+    inline Eigen::Index numTracks() const { return m_states.cols(); }
+    inline Eigen::Index stateDim() const { return m_states.rows(); }
+
+    /// @brief Current states, one track per column
+    inline const Matrix& states() const { return m_states; }
+
+    /// @brief Current covariances side by side
+    inline const Matrix& covs() const { return m_covs; }
+
+    /// @brief Covariance of a single track
+    inline auto cov(Eigen::Index track) const {
+        return m_covs.middleCols(track * stateDim(), stateDim());
+    }
+
+   private:
+    const dynamics::ILinearDynamics& viewDynamicsModel() const;
+    const measurements::ILinearMeasModel& viewMeasurementModel() const;
+
+    std::shared_ptr<dynamics::ILinearDynamics> m_dynObj;
+    std::shared_ptr<measurements::ILinearMeasModel> m_measObj;
+    Matrix m_procNoise;
+    Matrix m_measNoise;
+
+    Matrix m_states;
+    Matrix m_covs;
+
+    // workspace kept between steps, once the number of tracks settles only
+    // the model calls allocate since they return their matrices by value
+    Matrix m_stateMat;
+    Matrix m_measMat;
+    Eigen::VectorXd m_modelState;
+    Matrix m_nextStates;
+    Matrix m_work;
+    Matrix m_measCovs;
+    Matrix m_inov;
+    Matrix m_inovCov;
+    Eigen::LLT<Matrix> m_llt;
+    // lower Cholesky factor of each innovation covariance, side by side
+    Matrix m_inovFactors;
+    Vector m_weightedInov;
+    Matrix m_weightedMeasCov;
+};
+
+extern template class KalmanBank<float>;
+extern template class KalmanBank<double>;
+
+}  // namespace lager::gncpy::filters
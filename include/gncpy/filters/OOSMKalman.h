@@ -0,0 +1,132 @@
+#pragma once
+#include <Eigen/Dense>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "gncpy/filters/Kalman.h"
+#include "gncpy/filters/Parameters.h"
+
+namespace lager::gncpy::filters {
+
+/**
+ * @brief Out of sequence measurement handling for Kalman filters
+ *
+ * Wraps a Kalman filter (or any child class) and keeps a bounded history of
+ * the estimate at each filter step. Measurements may be given for the current
+ * step or for any step still in the history. Late measurements for the
+ * previous step of a linear model are fused directly with the one step lag
+ * retrodiction of @cite BarShalom2002_UpdatewithOutofSequenceMeasurementsinTracking
+ * (algorithm A1). All other late measurements roll the estimate back to the
+ * step they belong to and only the steps after it are replayed.
+ *
+ * Covariances in the history are immutable and shared between snapshots, a
+ * new matrix is only allocated when a step actually changes the covariance.
+ *
+ */
+class OOSMKalman {
+   public:
+    OOSMKalman() = default;
+
+    /**
+     * @brief Construct a new OOSMKalman object
+     *
+     * @param filter filter used for every predict and correct step, its state
+     * and measurement models must already be set
+     * @param maxHistory maximum number of steps kept for late measurements
+     */
+    explicit OOSMKalman(std::shared_ptr<Kalman> filter, size_t maxHistory = 10);
+
+    /**
+     * @brief Reset the history to a single step
+     *
+     * The covariance is taken from the wrapped filter.
+     *
+     * @param time time of the initial estimate
+     * @param state initial state estimate
+     */
+    void initialize(double time, const Eigen::VectorXd& state);
+
+    /**
+     * @brief Propagate the estimate to a new filter step
+     *
+     * The wrapped filter is called with the time of the previous step, so the
+     * dynamics model must propagate from that time to the given one.
+     *
+     * @param timestep time of the new step
+     * @param params prediction parameters, kept for replaying the step
+     * @return const Eigen::VectorXd& predicted state estimate
+     */
+    const Eigen::VectorXd& predict(
+        double timestep,
+        std::shared_ptr<const BayesPredictParams> params = nullptr);
+
+    /**
+     * @brief Fuse a measurement taken at the current or a previous step
+     *
+     * @param timestep time of the measurement, must match a stored step
+     * @param meas measurement vector
+     * @param measFitProb output measurement fit probability
+     * @param params correction parameters, kept for replaying the step
+     * @return const Eigen::VectorXd& corrected state estimate at the current
+     * step
+     */
+    const Eigen::VectorXd& correct(
+        double timestep, const Eigen::VectorXd& meas, double& measFitProb,
+        std::shared_ptr<const BayesCorrectParams> params = nullptr);
+
+    inline double time() const { return m_history.back().time; }
+    inline const Eigen::VectorXd& state() const {
+        return m_history.back().state;
+    }
+    inline const Eigen::MatrixXd& viewCov() const {
+        return *m_history.back().cov;
+    }
+    inline size_t historySize() const { return m_history.size(); }
+
+    /// @brief Number of late measurements fused by retrodiction
+    inline size_t numRetrodictions() const { return m_numRetrodictions; }
+    /// @brief Number of late measurements fused by rolling back
+    inline size_t numRollbacks() const { return m_numRollbacks; }
+
+    /// @brief Use retrodiction for one step lags instead of rolling back
+    bool useRetrodiction = true;
+
+    /// @brief Tolerance when matching measurement times to step times
+    double timeTolerance = 1e-9;
+
+   private:
+    struct Measurement {
+        Eigen::VectorXd meas;
+        std::shared_ptr<const BayesCorrectParams> params;
+    };
+
+    struct Step {
+        double time;
+        std::shared_ptr<const BayesPredictParams> predParams;
+        Eigen::VectorXd predState;
+        std::shared_ptr<const Eigen::MatrixXd> predCov;
+        std::vector<Measurement> meas;
+        Eigen::VectorXd state;
+        std::shared_ptr<const Eigen::MatrixXd> cov;
+
+        // false when a measurement was fused into a later step without
+        // updating this snapshot
+        bool complete = true;
+    };
+
+    bool retrodict(size_t stepInd, const Measurement& lateMeas,
+                   double& measFitProb);
+    void replay(size_t stepInd, double& measFitProb);
+    void applyMeas(Step& step, const Measurement& m, double& measFitProb);
+
+    std::shared_ptr<Kalman> m_filter;
+    size_t m_maxHistory = 10;
+    std::deque<Step> m_history;
+
+    size_t m_numRetrodictions = 0;
+    size_t m_numRollbacks = 0;
+};
+
+}  // namespace lager::gncpy::filters
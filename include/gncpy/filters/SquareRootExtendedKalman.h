@@ -0,0 +1,83 @@
+#pragma once
+#include <Eigen/Dense>
+#include <cereal/access.hpp>
+#include <memory>
+#include <optional>
+
+#include "gncpy/SerializeMacros.h"
+#include "gncpy/dynamics/IDynamics.h"
+#include "gncpy/filters/DynamicsBinding.h"
+#include "gncpy/filters/SquareRootKalman.h"
+#include "gncpy/filters/Parameters.h"
+#include "gncpy/measurements/IMeasModel.h"
+
+namespace lager::gncpy::filters {
+
+/**
+ * @brief Implements a square root extended Kalman filter
+ *
+ * Linearizes the dynamics and measurement models about the current estimate
+ * and propagates the covariance factor the same way as SquareRootKalman.
+ *
+ */
+class SquareRootExtendedKalman final : public SquareRootKalman {
+    friend class cereal::access;
+
+    GNCPY_SERIALIZE_CLASS(SquareRootExtendedKalman)
+
+   public:
+    /**
+     * @brief Implements a discrete time prediction step
+     *
+     * @param timestep current timestep
+     * @param curState current state estmiate
+     * @param controlInput optional control input
+     * @param params prediction parameters
+     * @return Eigen::VectorXd predicted state estimate
+     */
+    Eigen::VectorXd predict(
+        double timestep, const Eigen::VectorXd& curState,
+        [[maybe_unused]] const std::optional<Eigen::VectorXd> controlInput,
+        const BayesPredictParams* params = nullptr) override;
+
+    /**
+     * @brief Sets the state model equation for the filter.
+     *
+     * @param dynObj linear or non-linear dynamics
+     * @param procNoise Process noise matrix for the filter
+     */
+    void setStateModel(std::shared_ptr<dynamics::IDynamics> dynObj,
+                       Eigen::MatrixXd procNoise) override;
+
+    /**
+     * @brief Sets the measurement model for the filter.
+     *
+     * @param measObj linear or non-linear measurement model
+     * @param measNoise positive definite measurement noise matrix
+     */
+    void setMeasurementModel(std::shared_ptr<measurements::IMeasModel> measObj,
+                             Eigen::MatrixXd measNoise) override;
+
+   protected:
+    Eigen::MatrixXd getStateMat(
+        double timestep, const Eigen::VectorXd& curState,
+        const BayesPredictParams* params) const override;
+
+   private:
+    template <class Archive>
+    void serialize(Archive& ar);
+
+    // bound when the model is set and before every prediction, so a loaded
+    // model is picked up
+    detail::DynamicsBinding m_dyn;
+};
+
+template <class Archive>
+void SquareRootExtendedKalman::serialize(Archive& ar) {
+    ar(cereal::make_nvp("SquareRootKalman",
+                        cereal::virtual_base_class<SquareRootKalman>(this)));
+}
+
+}  // namespace lager::gncpy::filters
+
+CEREAL_REGISTER_TYPE(lager::gncpy::filters::SquareRootExtendedKalman)
@@ -0,0 +1,152 @@
+#pragma once
+#include <Eigen/Dense>
+#include <cereal/types/memory.hpp>
+#include <memory>
+#include <optional>
+
+#include "gncpy/SerializeMacros.h"
+#include "gncpy/dynamics/IDynamics.h"
+#include "gncpy/filters/IBayesFilter.h"
+#include "gncpy/filters/Parameters.h"
+#include "gncpy/math/SerializeEigen.h"
+#include "gncpy/measurements/IMeasModel.h"
+
+namespace lager::gncpy::filters {
+
+/**
+ * @brief Implements a square root Kalman Filter
+ *
+ * The covariance is carried as a lower triangular factor \f$P = S S^T\f$.
+ * Both the prediction and correction steps are done by triangularizing an
+ * array of factors with a QR decomposition, see
+ * @cite Kaminski1971_DiscreteSquareRootFilteringASurveyofCurrentTechniques
+ * so the covariance stays positive definite and never needs to be
+ * re-factorized. The full covariance is only formed when it is requested.
+ * The Cholesky factor of the measurement noise is stacked into the
+ * correction array, so setMeasurementModel rejects noise that can not be
+ * factorized.
+ *
+ */
+class SquareRootKalman : public IBayesFilter {
+    friend class cereal::access;
+
+    GNCPY_SERIALIZE_CLASS(SquareRootKalman)
+
+   public:
+    /**
+     * @brief Implements a discrete time prediction step
+     *
+     * @param timestep current timestep
+     * @param curState current state estmiate
+     * @param controlInput optional control input
+     * @param params prediction parameters
+     * @return Eigen::VectorXd predicted state estimate
+     */
+    Eigen::VectorXd predict(
+        double timestep, const Eigen::VectorXd& curState,
+        [[maybe_unused]] const std::optional<Eigen::VectorXd> controlInput,
+        const BayesPredictParams* params = nullptr) override;
+
+    /**
+     * @brief Implements a discrete time correction step
+     *
+     * The measurement fit probability is computed from the triangular factor
+     * of the innovation covariance produced by the update.
+     *
+     * @param timestep current timestep
+     * @param meas current measurement
+     * @param curState current state estimate
+     * @param measFitProb ouptut measurement fit probability
+     * @param params correction step parameters
+     * @return Eigen::VectorXd corrected state estimate
+     */
+    Eigen::VectorXd correct(
+        [[maybe_unused]] double timestep, const Eigen::VectorXd& meas,
+        const Eigen::VectorXd& curState, double& measFitProb,
+        const BayesCorrectParams* params = nullptr) override;
+
+    /**
+     * @brief Sets the state model equation for the filter.
+     *
+     * @param dynObj Linear dynamics of type dynamics::ILinearDynamics
+     * @param procNoise positive semi-definite process noise matrix
+     */
+    void setStateModel(std::shared_ptr<dynamics::IDynamics> dynObj,
+                       Eigen::MatrixXd procNoise) override;
+
+    /**
+     * @brief Sets the measurement model for the filter.
+     *
+     * @param measObj linear measurement model of type
+     * measurements::ILinearMeasModel
+     * @param measNoise positive definite measurement noise matrix
+     */
+    void setMeasurementModel(std::shared_ptr<measurements::IMeasModel> measObj,
+                             Eigen::MatrixXd measNoise) override;
+
+    std::shared_ptr<dynamics::IDynamics> dynamicsModel() const override;
+    std::shared_ptr<measurements::IMeasModel> measurementModel() const override;
+
+    /// @brief Measurement noise rebuilt from its stored factor
+    Eigen::MatrixXd measurementNoise() const override {
+        return m_sqrtMeasNoise * m_sqrtMeasNoise.transpose();
+    }
+
+    Eigen::MatrixXd& getCov() override;
+    const Eigen::MatrixXd& viewCov() override;
+
+    /// @brief Mutable lower triangular covariance factor, invalidates the
+    /// covariance
+    Eigen::MatrixXd& getSqrtCov();
+    /// @brief Lower triangular covariance factor, factorized if needed
+    const Eigen::MatrixXd& viewSqrtCov();
+
+   protected:
+    /**
+     * @brief Discrete state matrix used to propagate the covariance factor
+     *
+     * @param timestep current timestep
+     * @param curState current state estimate
+     * @param params prediction parameters
+     * @return Eigen::MatrixXd state matrix
+     */
+    virtual Eigen::MatrixXd getStateMat(
+        double timestep, const Eigen::VectorXd& curState,
+        const BayesPredictParams* params) const;
+
+    void setModels(std::shared_ptr<dynamics::IDynamics> dynObj,
+                   Eigen::MatrixXd procNoise);
+    /// @brief Dynamics model without copying the pointer, empty if unset
+    inline const std::shared_ptr<dynamics::IDynamics>& dynamicsHandle() const {
+        return m_dynObj;
+    }
+    void setMeasModel(std::shared_ptr<measurements::IMeasModel> measObj,
+                      Eigen::MatrixXd measNoise);
+
+   private:
+    template <class Archive>
+    void serialize(Archive& ar);
+
+    Eigen::MatrixXd m_sqrtProcNoise;
+    Eigen::MatrixXd m_sqrtMeasNoise;
+
+    Eigen::MatrixXd m_sqrtCov;
+    bool m_covValid = true;
+    bool m_sqrtCovValid = false;
+
+    std::shared_ptr<dynamics::IDynamics> m_dynObj;
+    std::shared_ptr<measurements::IMeasModel> m_measObj;
+};
+
+template <class Archive>
+void SquareRootKalman::serialize(Archive& ar) {
+    ar(cereal::make_nvp("IBayesFilter",
+                        cereal::virtual_base_class<IBayesFilter>(this)),
+       CEREAL_NVP(m_sqrtProcNoise), CEREAL_NVP(m_sqrtMeasNoise),
+       CEREAL_NVP(m_sqrtCov), CEREAL_NVP(m_covValid),
+       CEREAL_NVP(m_sqrtCovValid), CEREAL_NVP(m_dynObj), CEREAL_NVP(m_measObj));
+}
+
+}  // namespace lager::gncpy::filters
+
+CEREAL_REGISTER_TYPE(lager::gncpy::filters::SquareRootKalman)
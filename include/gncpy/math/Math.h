@@ -83,6 +83,22 @@ extern Eigen::MatrixXd getJacobian(
     std::function<Eigen::VectorXd(const Eigen::VectorXd&)> const& fnc,
     size_t numFunOutputs);
 
+/**
+ * @brief Check an analytic Jacobian against a numerical one
+ *
+ * Every entry must agree to within the tolerance times the larger of one and
+ * the largest numerical entry.
+ *
+ * @param analytic Closed form Jacobian
+ * @param numerical Finite difference Jacobian
+ * @param name Name of the model, used in the error message
+ * @param tol Relative tolerance
+ * @throws exceptions::BadParams if the Jacobians do not match
+ */
+extern void checkJacobian(const Eigen::MatrixXd& analytic,
+                          const Eigen::MatrixXd& numerical, const char* name,
+                          double tol = 1e-4);
+
 /**
  * @brief Calculate the value of a multi-variate Gaussian PDF
  *
@@ -95,6 +111,24 @@ extern double calcGaussianPDF(const Eigen::VectorXd& x,
                               const Eigen::VectorXd& m,
                               const Eigen::MatrixXd& cov);
 
+/**
+ * @brief Cumulative distribution function of the chi-square distribution
+ *
+ * @param x Value to evaluate the CDF at
+ * @param dof Degrees of freedom
+ * @return double Probability of a sample being at most x
+ */
+extern double chiSquareCDF(double x, double dof);
+
+/**
+ * @brief Quantile (inverse CDF) of the chi-square distribution
+ *
+ * @param prob Probability in [0, 1]
+ * @param dof Degrees of freedom
+ * @return double Value the CDF equals prob at
+ */
+extern double chiSquareQuantile(double prob, double dof);
+
 /**
  * @brief Numerical integration using a basic Runge-Kutta method.
  *
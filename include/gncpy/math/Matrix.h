@@ -0,0 +1,475 @@
+#pragma once
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>
+#include <utility>
+
+#include "gncpy/math/Exceptions.h"
+
+namespace lager::gncpy::matrix {
+
+/**
+ * @brief Matrix with its size fixed at compile time
+ *
+ * The elements live inside the object in row major order, nothing is ever
+ * allocated on the heap and every loop has a compile time trip count, so the
+ * cost of each operation is fixed. This is meant for embedded targets where
+ * Eigen's dynamic matrices cannot be used; elsewhere prefer Eigen.
+ *
+ * Only at and the initializer list constructors check their arguments, they
+ * throw BadIndex and BadDimension respectively.
+ *
+ * @tparam T scalar type
+ * @tparam Rows number of rows
+ * @tparam Cols number of columns
+ */
+template <typename T, std::size_t Rows, std::size_t Cols>
+class Matrix {
+    static_assert(Rows > 0 && Cols > 0, "Matrix dimensions must be positive");
+
+   public:
+    using Scalar = T;
+
+    /// @brief Construct a matrix of zeros
+    constexpr Matrix() noexcept = default;
+
+    /**
+     * @brief Construct a matrix from a list of rows
+     *
+     * @param rows one list per row
+     * @throws BadDimension if the shape does not match
+     */
+    Matrix(std::initializer_list<std::initializer_list<T>> rows) {
+        if (rows.size() != Rows) {
+            throw BadDimension("Number of rows does not match the matrix");
+        }
+        std::size_t r = 0;
+        for (const std::initializer_list<T>& row : rows) {
+            if (row.size() != Cols) {
+                throw BadDimension(
+                    "Number of columns does not match the matrix");
+            }
+            std::size_t c = 0;
+            for (const T& val : row) {
+                (*this)(r, c++) = val;
+            }
+            r++;
+        }
+    }
+
+    static constexpr Matrix zeros() noexcept { return Matrix(); }
+
+    static constexpr Matrix constant(T val) noexcept {
+        Matrix out;
+        out.m_data.fill(val);
+        return out;
+    }
+
+    static constexpr Matrix identity() noexcept
+        requires(Rows == Cols)
+    {
+        Matrix out;
+        for (std::size_t ii = 0; ii < Rows; ii++) {
+            out(ii, ii) = T(1);
+        }
+        return out;
+    }
+
+    static constexpr std::size_t rows() noexcept { return Rows; }
+    static constexpr std::size_t cols() noexcept { return Cols; }
+    static constexpr std::size_t size() noexcept { return Rows * Cols; }
+
+    inline T* data() noexcept { return m_data.data(); }
+    inline const T* data() const noexcept { return m_data.data(); }
+
+    /// @brief Unchecked element access
+    constexpr T& operator()(std::size_t row, std::size_t col) noexcept {
+        return m_data[row * Cols + col];
+    }
+    constexpr const T& operator()(std::size_t row,
+                                  std::size_t col) const noexcept {
+        return m_data[row * Cols + col];
+    }
+
+    /**
+     * @brief Checked element access
+     *
+     * @throws BadIndex if the element is outside the matrix
+     */
+    T& at(std::size_t row, std::size_t col) {
+        checkIndex(row, col);
+        return (*this)(row, col);
+    }
+    const T& at(std::size_t row, std::size_t col) const {
+        checkIndex(row, col);
+        return (*this)(row, col);
+    }
+
+    constexpr Matrix& operator+=(const Matrix& rhs) noexcept {
+        for (std::size_t ii = 0; ii < size(); ii++) {
+            m_data[ii] += rhs.m_data[ii];
+        }
+        return *this;
+    }
+
+    constexpr Matrix& operator-=(const Matrix& rhs) noexcept {
+        for (std::size_t ii = 0; ii < size(); ii++) {
+            m_data[ii] -= rhs.m_data[ii];
+        }
+        return *this;
+    }
+
+    constexpr Matrix& operator*=(T scale) noexcept {
+        for (T& val : m_data) {
+            val *= scale;
+        }
+        return *this;
+    }
+
+    constexpr Matrix& operator/=(T scale) noexcept {
+        for (T& val : m_data) {
+            val /= scale;
+        }
+        return *this;
+    }
+
+    friend constexpr Matrix operator+(Matrix lhs, const Matrix& rhs) noexcept {
+        return lhs += rhs;
+    }
+    friend constexpr Matrix operator-(Matrix lhs, const Matrix& rhs) noexcept {
+        return lhs -= rhs;
+    }
+    friend constexpr Matrix operator-(Matrix mat) noexcept {
+        return mat *= T(-1);
+    }
+    friend constexpr Matrix operator*(Matrix mat, T scale) noexcept {
+        return mat *= scale;
+    }
+    friend constexpr Matrix operator*(T scale, Matrix mat) noexcept {
+        return mat *= scale;
+    }
+    friend constexpr Matrix operator/(Matrix mat, T scale) noexcept {
+        return mat /= scale;
+    }
+
+    friend constexpr bool operator==(const Matrix& lhs,
+                                     const Matrix& rhs) noexcept {
+        return lhs.m_data == rhs.m_data;
+    }
+
+    /// @brief Matrix product
+    template <std::size_t K>
+    constexpr Matrix<T, Rows, K> operator*(
+        const Matrix<T, Cols, K>& rhs) const noexcept {
+        Matrix<T, Rows, K> out;
+        for (std::size_t r = 0; r < Rows; r++) {
+            for (std::size_t k = 0; k < Cols; k++) {
+                const T val = (*this)(r, k);
+                for (std::size_t c = 0; c < K; c++) {
+                    out(r, c) += val * rhs(k, c);
+                }
+            }
+        }
+        return out;
+    }
+
+    constexpr Matrix<T, Cols, Rows> transpose() const noexcept {
+        Matrix<T, Cols, Rows> out;
+        for (std::size_t r = 0; r < Rows; r++) {
+            for (std::size_t c = 0; c < Cols; c++) {
+                out(c, r) = (*this)(r, c);
+            }
+        }
+        return out;
+    }
+
+    /**
+     * @brief Copy of a sub matrix
+     *
+     * @throws BadIndex if the block does not fit in the matrix
+     */
+    template <std::size_t BlockRows, std::size_t BlockCols>
+    Matrix<T, BlockRows, BlockCols> block(std::size_t row,
+                                          std::size_t col) const {
+        checkBlock(row, col, BlockRows, BlockCols);
+        Matrix<T, BlockRows, BlockCols> out;
+        for (std::size_t r = 0; r < BlockRows; r++) {
+            for (std::size_t c = 0; c < BlockCols; c++) {
+                out(r, c) = (*this)(row + r, col + c);
+            }
+        }
+        return out;
+    }
+
+    /**
+     * @brief Overwrite a sub matrix
+     *
+     * @throws BadIndex if the block does not fit in the matrix
+     */
+    template <std::size_t BlockRows, std::size_t BlockCols>
+    void setBlock(std::size_t row, std::size_t col,
+                  const Matrix<T, BlockRows, BlockCols>& val) {
+        checkBlock(row, col, BlockRows, BlockCols);
+        for (std::size_t r = 0; r < BlockRows; r++) {
+            for (std::size_t c = 0; c < BlockCols; c++) {
+                (*this)(row + r, col + c) = val(r, c);
+            }
+        }
+    }
+
+    constexpr T trace() const noexcept
+        requires(Rows == Cols)
+    {
+        T out = T(0);
+        for (std::size_t ii = 0; ii < Rows; ii++) {
+            out += (*this)(ii, ii);
+        }
+        return out;
+    }
+
+    /// @brief Sum of the squared elements
+    constexpr T squaredNorm() const noexcept {
+        T out = T(0);
+        for (const T& val : m_data) {
+            out += val * val;
+        }
+        return out;
+    }
+
+    /// @brief Frobenius norm, the 2-norm for vectors
+    T norm() const noexcept { return std::sqrt(squaredNorm()); }
+
+   private:
+    void checkIndex(std::size_t row, std::size_t col) const {
+        if (row >= Rows || col >= Cols) {
+            throw BadIndex("Index is outside the matrix");
+        }
+    }
+
+    static void checkBlock(std::size_t row, std::size_t col,
+                           std::size_t numRows, std::size_t numCols) {
+        if (row + numRows > Rows || col + numCols > Cols) {
+            throw BadIndex("Block does not fit in the matrix");
+        }
+    }
+
+    std::array<T, Rows * Cols> m_data{};
+};
+
+/**
+ * @brief Computes \f$A P A^T\f$ for a symmetric \f$P\f$
+ *
+ * Only the upper triangle is calculated, the result is exactly symmetric.
+ *
+ */
+template <typename T, std::size_t Rows, std::size_t Cols>
+constexpr Matrix<T, Rows, Rows> symmetricProduct(
+    const Matrix<T, Rows, Cols>& a, const Matrix<T, Cols, Cols>& p) noexcept {
+    const Matrix<T, Rows, Cols> ap = a * p;
+    Matrix<T, Rows, Rows> out;
+    for (std::size_t r = 0; r < Rows; r++) {
+        for (std::size_t c = r; c < Rows; c++) {
+            T val = T(0);
+            for (std::size_t k = 0; k < Cols; k++) {
+                val += ap(r, k) * a(c, k);
+            }
+            out(r, c) = val;
+            out(c, r) = val;
+        }
+    }
+    return out;
+}
+
+/// @brief Averages a matrix with its transpose
+template <typename T, std::size_t N>
+constexpr Matrix<T, N, N> symmetrize(const Matrix<T, N, N>& mat) noexcept {
+    Matrix<T, N, N> out;
+    for (std::size_t r = 0; r < N; r++) {
+        out(r, r) = mat(r, r);
+        for (std::size_t c = r + 1; c < N; c++) {
+            out(r, c) = T(0.5) * (mat(r, c) + mat(c, r));
+            out(c, r) = out(r, c);
+        }
+    }
+    return out;
+}
+
+/**
+ * @brief Cholesky factorization \f$A = L L^T\f$ of a symmetric positive
+ * definite matrix
+ *
+ * Only the lower triangle of the input is read. Failure is reported by ok
+ * instead of an exception so the factorization can be used where exceptions
+ * are disabled.
+ *
+ * @tparam T scalar type
+ * @tparam N size of the matrix
+ */
+template <typename T, std::size_t N>
+class Cholesky {
+   public:
+    constexpr explicit Cholesky(const Matrix<T, N, N>& mat) noexcept {
+        compute(mat);
+    }
+
+    /**
+     * @brief Factorize a new matrix
+     *
+     * @param mat symmetric positive definite matrix
+     * @return true if the matrix is positive definite
+     */
+    constexpr bool compute(const Matrix<T, N, N>& mat) noexcept {
+        m_lower = Matrix<T, N, N>();
+        m_ok = true;
+        for (std::size_t c = 0; c < N; c++) {
+            T diag = mat(c, c);
+            for (std::size_t k = 0; k < c; k++) {
+                diag -= m_lower(c, k) * m_lower(c, k);
+            }
+            // also rejects NaN
+            if (!(diag > T(0))) {
+                m_ok = false;
+                return false;
+            }
+            const T lcc = std::sqrt(diag);
+            m_lower(c, c) = lcc;
+            for (std::size_t r = c + 1; r < N; r++) {
+                T val = mat(r, c);
+                for (std::size_t k = 0; k < c; k++) {
+                    val -= m_lower(r, k) * m_lower(c, k);
+                }
+                m_lower(r, c) = val / lcc;
+            }
+        }
+        return true;
+    }
+
+    /// @brief True if the last factorization succeeded
+    inline bool ok() const noexcept { return m_ok; }
+
+    /// @brief Lower triangular factor
+    inline const Matrix<T, N, N>& lower() const noexcept { return m_lower; }
+
+    /// @brief Determinant of the factorized matrix
+    constexpr T determinant() const noexcept {
+        T out = T(1);
+        for (std::size_t ii = 0; ii < N; ii++) {
+            out *= m_lower(ii, ii);
+        }
+        return out * out;
+    }
+
+    /**
+     * @brief Solves \f$A X = B\f$ by forward and back substitution
+     *
+     * The result is meaningless if ok is false.
+     *
+     */
+    template <std::size_t K>
+    constexpr Matrix<T, N, K> solve(const Matrix<T, N, K>& rhs) const noexcept {
+        Matrix<T, N, K> out = rhs;
+        for (std::size_t c = 0; c < K; c++) {
+            for (std::size_t r = 0; r < N; r++) {
+                T val = out(r, c);
+                for (std::size_t k = 0; k < r; k++) {
+                    val -= m_lower(r, k) * out(k, c);
+                }
+                out(r, c) = val / m_lower(r, r);
+            }
+            for (std::size_t r = N; r-- > 0;) {
+                T val = out(r, c);
+                for (std::size_t k = r + 1; k < N; k++) {
+                    val -= m_lower(k, r) * out(k, c);
+                }
+                out(r, c) = val / m_lower(r, r);
+            }
+        }
+        return out;
+    }
+
+   private:
+    Matrix<T, N, N> m_lower;
+    bool m_ok = false;
+};
+
+/**
+ * @brief Solves \f$A X = B\f$ for a general square matrix
+ *
+ * Uses Gaussian elimination with partial pivoting. For symmetric positive
+ * definite matrices Cholesky is faster.
+ *
+ * @param a square system matrix
+ * @param b right hand side
+ * @param x output solution, untouched if a is singular
+ * @return true if a is not singular
+ */
+template <typename T, std::size_t N, std::size_t K>
+constexpr bool solve(const Matrix<T, N, N>& a, const Matrix<T, N, K>& b,
+                     Matrix<T, N, K>& x) noexcept {
+    Matrix<T, N, N> lu = a;
+    Matrix<T, N, K> out = b;
+    for (std::size_t c = 0; c < N; c++) {
+        std::size_t pivot = c;
+        for (std::size_t r = c + 1; r < N; r++) {
+            if (std::abs(lu(r, c)) > std::abs(lu(pivot, c))) {
+                pivot = r;
+            }
+        }
+        if (!(lu(pivot, c) != T(0))) {
+            return false;
+        }
+        if (pivot != c) {
+            for (std::size_t k = 0; k < N; k++) {
+                std::swap(lu(c, k), lu(pivot, k));
+            }
+            for (std::size_t k = 0; k < K; k++) {
+                std::swap(out(c, k), out(pivot, k));
+            }
+        }
+        for (std::size_t r = c + 1; r < N; r++) {
+            const T factor = lu(r, c) / lu(c, c);
+            for (std::size_t k = c; k < N; k++) {
+                lu(r, k) -= factor * lu(c, k);
+            }
+            for (std::size_t k = 0; k < K; k++) {
+                out(r, k) -= factor * out(c, k);
+            }
+        }
+    }
+    for (std::size_t r = N; r-- > 0;) {
+        for (std::size_t k = 0; k < K; k++) {
+            T val = out(r, k);
+            for (std::size_t j = r + 1; j < N; j++) {
+                val -= lu(r, j) * out(j, k);
+            }
+            out(r, k) = val / lu(r, r);
+        }
+    }
+    x = out;
+    return true;
+}
+
+/**
+ * @brief Inverse of a general square matrix
+ *
+ * @param a square matrix
+ * @param out output inverse, untouched if a is singular
+ * @return true if a is not singular
+ */
+template <typename T, std::size_t N>
+constexpr bool inverse(const Matrix<T, N, N>& a,
+                       Matrix<T, N, N>& out) noexcept {
+    return solve(a, Matrix<T, N, N>::identity(), out);
+}
+
+extern template class Matrix<float, 2, 2>;
+extern template class Matrix<float, 3, 3>;
+extern template class Matrix<float, 4, 4>;
+extern template class Matrix<float, 6, 6>;
+extern template class Matrix<double, 2, 2>;
+extern template class Matrix<double, 3, 3>;
+extern template class Matrix<double, 4, 4>;
+extern template class Matrix<double, 6, 6>;
+
+}  // namespace lager::gncpy::matrix
@@ -4,8 +4,12 @@
 #include <cereal/archives/json.hpp>
 #include <cereal/archives/portable_binary.hpp>
 #include <cereal/cereal.hpp>
+#include <charconv>
+#include <cstring>
 #include <map>
 #include <sstream>
+#include <stdexcept>
+#include <utility>
 
 namespace cereal {
 
@@ -54,6 +58,62 @@ load(Archive& ar,
 // For text archive
 // ---------------------------------------------------------
 
+// Matrices are written as
+//     {"rows": r, "cols": c, "data": [m(0, 0), m(0, 1), ...]}
+// with the data in row major order so it reads like the matrix. The loader
+// also accepts the older format with one "r,c" node per element.
+
+namespace eigen_detail {
+
+// row major view of a matrix, saved as a flat array
+template <class Matrix_t>
+struct RowMajorData {
+    Matrix_t& mat;
+};
+
+template <class Archive, class Matrix_t>
+inline void save(Archive& ar, const RowMajorData<Matrix_t>& d) {
+    ar(make_size_tag(static_cast<size_type>(d.mat.size())));
+    for (Eigen::Index r = 0; r < d.mat.rows(); r++) {
+        for (Eigen::Index c = 0; c < d.mat.cols(); c++) {
+            ar(d.mat(r, c));
+        }
+    }
+}
+
+template <class Archive, class Matrix_t>
+inline void load(Archive& ar, RowMajorData<Matrix_t>& d) {
+    size_type size;
+    ar(make_size_tag(size));
+    if (size != static_cast<size_type>(d.mat.size())) {
+        throw std::runtime_error(
+            "Matrix data size does not match its rows and columns");
+    }
+    for (Eigen::Index r = 0; r < d.mat.rows(); r++) {
+        for (Eigen::Index c = 0; c < d.mat.cols(); c++) {
+            ar(d.mat(r, c));
+        }
+    }
+}
+
+// parses an old style "r,c" element name without allocating
+inline bool parseIndex(const char* name, int32_t& r, int32_t& c) {
+    const char* end = name + std::strlen(name);
+    auto [sep, ec] = std::from_chars(name, end, r);
+    if (ec != std::errc() || sep == end || *sep != ',') {
+        return false;
+    }
+    return std::from_chars(sep + 1, end, c).ec == std::errc();
+}
+
+inline void checkIndex(int32_t r, int32_t c, int32_t rows, int32_t cols) {
+    if (r < 0 || r >= rows || c < 0 || c >= cols) {
+        throw std::runtime_error("Matrix element index out of range");
+    }
+}
+
+}  // namespace eigen_detail
+
 template <class Archive, class _Scalar, int _Rows, int _Cols, int _Options,
           int _MaxRows, int _MaxCols>
 inline
@@ -64,14 +124,9 @@ inline
     int32_t cols = m.cols();
     ar(cereal::make_nvp("rows", rows));
     ar(cereal::make_nvp("cols", cols));
-
-    for (int32_t r = 0; r < rows; r++) {
-        for (int32_t c = 0; c < cols; c++) {
-            std::stringstream name;
-            name << r << "," << c;
-            ar(cereal::make_nvp(name.str(), m(r, c)));
-        }
-    }
+    ar(cereal::make_nvp("data", eigen_detail::RowMajorData<const Eigen::Matrix<
+                                    _Scalar, _Rows, _Cols, _Options, _MaxRows,
+                                    _MaxCols>>{m}));
 }
 
 template <class Archive, class _Scalar, int _Rows, int _Cols, int _Options,
@@ -81,35 +136,61 @@ inline
     load(
         Archive& ar,
         Eigen::Matrix<_Scalar, _Rows, _Cols, _Options, _MaxRows, _MaxCols>& m) {
+    using Matrix_t =
+        Eigen::Matrix<_Scalar, _Rows, _Cols, _Options, _MaxRows, _MaxCols>;
     int32_t rows = -1;
     int32_t cols = -1;
-    std::map<std::string, double> data;
+    bool sized = false;
+    // only used by old style archives that list elements before the size
+    std::map<std::pair<int32_t, int32_t>, double> early;
     while (true) {
         const auto namePtr = ar.getNodeName();
 
         if (!namePtr) break;
 
-        std::string key = namePtr;
-        if (key == "rows") {
+        if (std::strcmp(namePtr, "rows") == 0) {
             ar(rows);
-        } else if (key == "cols") {
+        } else if (std::strcmp(namePtr, "cols") == 0) {
             ar(cols);
+        } else if (std::strcmp(namePtr, "data") == 0) {
+            if (rows < 0 || cols < 0) {
+                throw std::runtime_error(
+                    "Matrix rows and columns must come before the data");
+            }
+            m.resize(rows, cols);
+            sized = true;
+            eigen_detail::RowMajorData<Matrix_t> data{m};
+            ar(data);
         } else {
-            ar(data[key]);
+            int32_t r;
+            int32_t c;
+            if (!eigen_detail::parseIndex(namePtr, r, c)) {
+                throw std::runtime_error("Unknown matrix element name");
+            }
+            if (!sized && rows >= 0 && cols >= 0) {
+                m.resize(rows, cols);
+                sized = true;
+            }
+            if (sized) {
+                eigen_detail::checkIndex(r, c, rows, cols);
+                ar(m(r, c));
+            } else {
+                ar(early[{r, c}]);
+            }
         }
     }
     if (rows >= 0 && cols >= 0) {
-        m.resize(rows, cols);
-        for (auto& [key, val] : data) {
-            size_t pos = key.find(',');
-            int32_t r = std::stoi(key.substr(0, pos));
-            int32_t c = std::stoi(key.substr(pos + 1));
-            m(r, c) = val;
+        if (!sized) {
+            m.resize(rows, cols);
+        }
+        for (auto& [key, val] : early) {
+            eigen_detail::checkIndex(key.first, key.second, rows, cols);
+            m(key.first, key.second) = val;
         }
     } else {
-        std::runtime_error(
+        throw std::runtime_error(
             "Failed to find rows and columns when deserializing data");
     }
 }
 
-}  // namespace cereal
\ No newline at end of file
+}  // namespace cereal
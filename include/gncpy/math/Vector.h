@@ -0,0 +1,103 @@
+#pragma once
+#include <cstddef>
+#include <initializer_list>
+
+#include "gncpy/math/Exceptions.h"
+#include "gncpy/math/Matrix.h"
+
+namespace lager::gncpy::matrix {
+
+/**
+ * @brief Column vector with its size fixed at compile time
+ *
+ * A single column Matrix with single index access and the usual vector
+ * products. Matrix results convert back implicitly, so expressions such as
+ * x + dt * v can be assigned to a Vector.
+ *
+ * @tparam T scalar type
+ * @tparam N number of elements
+ */
+template <typename T, std::size_t N>
+class Vector : public Matrix<T, N, 1> {
+   public:
+    using Matrix<T, N, 1>::operator();
+    using Matrix<T, N, 1>::at;
+
+    /// @brief Construct a vector of zeros
+    constexpr Vector() noexcept = default;
+
+    // implicit so matrix expressions convert back to vectors
+    constexpr Vector(const Matrix<T, N, 1>& mat) noexcept
+        : Matrix<T, N, 1>(mat) {}
+
+    /**
+     * @brief Construct a vector from its elements
+     *
+     * @throws BadDimension if the number of elements does not match
+     */
+    Vector(std::initializer_list<T> vals) {
+        if (vals.size() != N) {
+            throw BadDimension("Number of elements does not match the vector");
+        }
+        std::size_t ii = 0;
+        for (const T& val : vals) {
+            (*this)(ii++) = val;
+        }
+    }
+
+    /// @brief Unchecked element access
+    constexpr T& operator()(std::size_t ii) noexcept { return (*this)(ii, 0); }
+    constexpr const T& operator()(std::size_t ii) const noexcept {
+        return (*this)(ii, 0);
+    }
+
+    /**
+     * @brief Checked element access
+     *
+     * @throws BadIndex if the element is outside the vector
+     */
+    T& at(std::size_t ii) { return this->at(ii, 0); }
+    const T& at(std::size_t ii) const { return this->at(ii, 0); }
+
+    constexpr T dot(const Vector& rhs) const noexcept {
+        T out = T(0);
+        for (std::size_t ii = 0; ii < N; ii++) {
+            out += (*this)(ii) * rhs(ii);
+        }
+        return out;
+    }
+
+    constexpr Vector cross(const Vector& rhs) const noexcept
+        requires(N == 3)
+    {
+        const Vector& lhs = *this;
+        Vector out;
+        out(0) = lhs(1) * rhs(2) - lhs(2) * rhs(1);
+        out(1) = lhs(2) * rhs(0) - lhs(0) * rhs(2);
+        out(2) = lhs(0) * rhs(1) - lhs(1) * rhs(0);
+        return out;
+    }
+
+    /// @brief Outer product \f$a b^T\f$
+    template <std::size_t M>
+    constexpr Matrix<T, N, M> outer(const Vector<T, M>& rhs) const noexcept {
+        Matrix<T, N, M> out;
+        for (std::size_t r = 0; r < N; r++) {
+            for (std::size_t c = 0; c < M; c++) {
+                out(r, c) = (*this)(r) * rhs(c);
+            }
+        }
+        return out;
+    }
+};
+
+extern template class Vector<float, 2>;
+extern template class Vector<float, 3>;
+extern template class Vector<float, 4>;
+extern template class Vector<float, 6>;
+extern template class Vector<double, 2>;
+extern template class Vector<double, 3>;
+extern template class Vector<double, 4>;
+extern template class Vector<double, 6>;
+
+}  // namespace lager::gncpy::matrix
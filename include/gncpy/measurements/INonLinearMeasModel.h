@@ -1,6 +1,7 @@
 #pragma once
 #include <Eigen/Dense>
 #include <functional>
+#include <optional>
 #include <vector>
 
 #include "gncpy/SerializeMacros.h"
@@ -15,11 +16,42 @@ class INonLinearMeasModel : public IMeasModel {
    public:
     Eigen::VectorXd measure(const Eigen::VectorXd& state,
                             const MeasParams* params = nullptr) const override;
+
+    /**
+     * @brief Jacobian of the measurement function
+     *
+     * Uses the analytic Jacobian if the model provides one, otherwise finite
+     * differences.
+     *
+     * @param state state to linearize about
+     * @param params measurement parameters
+     * @return Eigen::MatrixXd measurement matrix
+     */
     Eigen::MatrixXd getMeasMat(
         const Eigen::VectorXd& state,
         const MeasParams* params = nullptr) const override;
 
+    /// @brief Finite difference Jacobian of the measurement function
+    Eigen::MatrixXd getNumericalMeasMat(
+        const Eigen::VectorXd& state,
+        const MeasParams* params = nullptr) const;
+
    protected:
+    /**
+     * @brief Closed form Jacobian of the measurement function
+     *
+     * Models with a closed form override this, the default has none.
+     * Configuring with GNCPY_CHECK_JACOBIANS checks the result against
+     * finite differences.
+     *
+     * @return std::optional<Eigen::MatrixXd> Jacobian or std::nullopt
+     */
+    virtual std::optional<Eigen::MatrixXd> analyticMeasMat(
+        [[maybe_unused]] const Eigen::VectorXd& state,
+        [[maybe_unused]] const MeasParams* params) const {
+        return std::nullopt;
+    }
+
     virtual std::vector<std::function<double(const Eigen::VectorXd&)>>
     getMeasFuncLst(const MeasParams* params = nullptr) const = 0;
 
@@ -3,6 +3,7 @@
 
 #include <Eigen/Dense>
 #include <functional>
+#include <optional>
 #include <vector>
 
 #include "gncpy/SerializeMacros.h"
@@ -41,18 +42,35 @@ class RangeAndBearing final : public INonLinearMeasModel {
    public:
     RangeAndBearing() = default;
 
+    /**
+     * @brief Range and bearing of the state
+     *
+     * Evaluated directly, the parameters are checked once per call.
+     *
+     * @param state current state
+     * @param params RangeAndBearingParams giving the position indices
+     * @return Eigen::VectorXd range and bearing
+     */
+    Eigen::VectorXd measure(const Eigen::VectorXd& state,
+                            const MeasParams* params = nullptr) const override;
+
    protected:
     std::vector<std::function<double(const Eigen::VectorXd&)>> getMeasFuncLst(
         const MeasParams* params) const override;
 
+    /// @brief Closed form Jacobian, none at the origin
+    std::optional<Eigen::MatrixXd> analyticMeasMat(
+        const Eigen::VectorXd& state, const MeasParams* params) const override;
+
    private:
     template <class Archive>
     void serialize(Archive& ar);
 
-    double range(const Eigen::VectorXd& state,
-                 const MeasParams* params = nullptr) const;
-    double bearing(const Eigen::VectorXd& state,
-                   const MeasParams* params = nullptr) const;
+    static const RangeAndBearingParams& castParams(const MeasParams* params);
+    static double range(const Eigen::VectorXd& state,
+                        const RangeAndBearingParams& params);
+    static double bearing(const Eigen::VectorXd& state,
+                          const RangeAndBearingParams& params);
 };
 
 template <class Archive>
@@ -0,0 +1,58 @@
+#pragma once
+#include <Eigen/Dense>
+#include <cstddef>
+
+#include "gncpy/dynamics/Keplerian.h"
+#include "gncpy/dynamics/TwoBodyJ2.h"
+#include "gncpy/utilities/ThreadPool.h"
+
+namespace lager::gncpy::simulation {
+
+/**
+ * @brief Propagates a catalog of objects in parallel
+ *
+ * The catalog is stored one object per row. Rows are split into contiguous
+ * chunks that are handed to a thread pool, and each chunk is propagated with
+ * the batch path of the dynamics model for every step, so a worker keeps its
+ * objects in cache for the whole call.
+ *
+ */
+class CatalogPropagator {
+   public:
+    /**
+     * @brief Construct a new Catalog Propagator object
+     *
+     * @param numThreads number of worker threads, 0 uses the hardware
+     * concurrency
+     */
+    explicit CatalogPropagator(size_t numThreads = 0);
+
+    /**
+     * @brief Propagate every object in place
+     *
+     * @param dynObj orbit dynamics, each step advances dynObj.dt()
+     * @param timestep time of the current states
+     * @param states one object per row
+     * @param numSteps number of steps to take
+     */
+    void propagate(const dynamics::TwoBodyJ2& dynObj, double timestep,
+                   Eigen::Ref<Eigen::MatrixXd> states, size_t numSteps = 1);
+
+    /**
+     * @brief Propagate every object in place with the closed form solution
+     *
+     * @param dynObj Keplerian dynamics, each step advances dynObj.dt()
+     * @param timestep time of the current states
+     * @param states one object per row
+     * @param numSteps number of steps to take
+     */
+    void propagate(const dynamics::Keplerian& dynObj, double timestep,
+                   Eigen::Ref<Eigen::MatrixXd> states, size_t numSteps = 1);
+
+    inline size_t numThreads() const { return m_pool.size(); }
+
+   private:
+    utilities::ThreadPool m_pool;
+};
+
+}  // namespace lager::gncpy::simulation
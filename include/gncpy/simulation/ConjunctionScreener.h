@@ -0,0 +1,111 @@
+#pragma once
+#include <Eigen/Dense>
+#include <cstddef>
+#include <vector>
+
+#include "gncpy/dynamics/IDynamics.h"
+#include "gncpy/utilities/ThreadPool.h"
+
+namespace lager::gncpy::simulation {
+
+/// @brief Close approach between two objects found by ConjunctionScreener
+struct Conjunction {
+    /// @brief Row of the first object, always less than second
+    Eigen::Index first = 0;
+    /// @brief Row of the second object
+    Eigen::Index second = 0;
+    /// @brief Time of closest approach
+    double time = 0.0;
+    /// @brief Distance at the time of closest approach
+    double distance = 0.0;
+    /// @brief Relative speed at the time of closest approach
+    double relativeSpeed = 0.0;
+};
+
+/**
+ * @brief Screens a set of objects for close approaches over a time window
+ *
+ * The objects are propagated with a dynamics model through a series of time
+ * slices. Every slice is handled by its own task: each object's reach, the
+ * largest distance its interpolated path strays from its start in the slice,
+ * puts it in a class whose reach doubles the class below. Positions at the
+ * start of the slice are bucketed into one spatial hash per class, with cells
+ * the threshold padded by the reach of the class, and a pair is compared only
+ * if it shares a neighbourhood in the grid of its faster object and starts
+ * within the threshold plus both reaches. Each candidate pair is refined by
+ * finding the root of the range rate on a cubic Hermite interpolation of the
+ * relative motion, and kept if the miss distance is within the threshold.
+ *
+ * States are \f$[x, y, z, v_x, v_y, v_z]\f$, one object per row. A pair with
+ * more than one close approach inside a single slice reports at most one, and
+ * the screening is only as good as the interpolation, so slices should be
+ * short compared to the relative orbital period.
+ *
+ */
+class ConjunctionScreener {
+   public:
+    /**
+     * @brief Construct a new Conjunction Screener object
+     *
+     * @param threshold largest miss distance reported
+     * @param numThreads number of worker threads, 0 uses the hardware
+     * concurrency
+     */
+    explicit ConjunctionScreener(double threshold, size_t numThreads = 0);
+
+    /**
+     * @brief Propagate the objects and screen every slice
+     *
+     * TwoBodyJ2 and Keplerian models use their batch paths, any other model
+     * propagates one object at a time. Slices are propagated and screened
+     * in blocks of one slice per worker, so only that many states of each
+     * object are held at once however long the window.
+     *
+     * @param dynObj dynamics model, one call to propagateState is one slice
+     * @param startTime time of the states
+     * @param sliceDt length of a slice, must match the step of dynObj
+     * @throws BadParams if dynObj steps by a stored dt that is not sliceDt
+     * @param states initial states, one object per row
+     * @param numSlices number of slices in the window
+     * @return std::vector<Conjunction> close approaches ordered by time
+     */
+    std::vector<Conjunction> screen(const dynamics::IDynamics& dynObj,
+                                    double startTime, double sliceDt,
+                                    const Eigen::MatrixXd& states,
+                                    size_t numSlices);
+
+    /**
+     * @brief Screen a precomputed ephemeris
+     *
+     * @param ephemeris states of every object at each slice boundary
+     * @param startTime time of the first entry
+     * @param sliceDt time between entries
+     * @return std::vector<Conjunction> close approaches ordered by time
+     */
+    std::vector<Conjunction> screenEphemeris(
+        const std::vector<Eigen::MatrixXd>& ephemeris, double startTime,
+        double sliceDt);
+
+    inline double threshold() const { return m_threshold; }
+    void setThreshold(double threshold);
+
+    inline size_t numThreads() const { return m_pool.size(); }
+
+   private:
+    // fills entries 1 to count of the block from entry 0, firstSlice is the
+    // index of the first slice in the window
+    void propagateBlock(const dynamics::IDynamics& dynObj, double startTime,
+                        double sliceDt, size_t firstSlice, size_t count,
+                        std::vector<Eigen::MatrixXd>& block);
+
+    // screens the count slices bounded by consecutive entries of the block,
+    // appending what it finds to out unsorted
+    void screenBlock(const std::vector<Eigen::MatrixXd>& block, size_t count,
+                     size_t firstSlice, size_t numSlices, double startTime,
+                     double sliceDt, std::vector<Conjunction>& out);
+
+    double m_threshold = 0.0;
+    utilities::ThreadPool m_pool;
+};
+
+}  // namespace lager::gncpy::simulation
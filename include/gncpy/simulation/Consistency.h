@@ -0,0 +1,97 @@
+#pragma once
+#include <Eigen/Dense>
+#include <cstddef>
+
+#include "gncpy/utilities/ThreadPool.h"
+
+namespace lager::gncpy::simulation {
+
+/// @brief Chi-square test of a normalized squared statistic (NEES or NIS)
+struct ConsistencyStats {
+    /// @brief Mean over runs of every step
+    Eigen::VectorXd mean;
+    /// @brief Lower bound of the per step mean at the confidence level
+    double lower = 0.0;
+    /// @brief Upper bound of the per step mean at the confidence level
+    double upper = 0.0;
+    /// @brief Fraction of steps whose mean lies within the bounds
+    double fractionInside = 0.0;
+
+    /// @brief Mean over every run and step
+    double timeAverage = 0.0;
+    /// @brief Lower bound of the time average at the confidence level
+    double timeLower = 0.0;
+    /// @brief Upper bound of the time average at the confidence level
+    double timeUpper = 0.0;
+
+    /// @brief Indicates if the time average lies within its bounds
+    inline bool consistent() const {
+        return timeAverage >= timeLower && timeAverage <= timeUpper;
+    }
+};
+
+/**
+ * @brief Batched NEES and NIS evaluation for filter consistency checks
+ *
+ * Samples are stored one per column, run major, so column
+ * run * numSteps + step holds a step of a run (the layout of
+ * MonteCarloResult::errors). Covariances are stacked side by side, sample i
+ * uses columns [i * dim, (i + 1) * dim). Every sample is solved with its own
+ * Cholesky factorization, split over a thread pool, and the normalized
+ * squares are tested against chi-square bounds following
+ * @cite BarShalom2001_EstimationwithApplicationstoTrackingandNavigation
+ *
+ */
+class Consistency {
+   public:
+    /**
+     * @brief Construct a new Consistency object
+     *
+     * @param numThreads number of worker threads, 0 uses the hardware
+     * concurrency
+     */
+    explicit Consistency(size_t numThreads = 0);
+
+    /**
+     * @brief Normalized squares \f$v_i^T P_i^{-1} v_i\f$ of a batch
+     *
+     * @param vecs errors or innovations, one column per sample
+     * @param covs matching covariances stacked side by side
+     * @param numSteps number of steps per run
+     * @return Eigen::MatrixXd values with one row per step and one column per
+     * run
+     */
+    Eigen::MatrixXd normalizedSquares(const Eigen::MatrixXd& vecs,
+                                      const Eigen::MatrixXd& covs,
+                                      size_t numSteps);
+
+    /// @brief NEES of estimation errors and state covariances
+    inline Eigen::MatrixXd nees(const Eigen::MatrixXd& errors,
+                                const Eigen::MatrixXd& covs, size_t numSteps) {
+        return normalizedSquares(errors, covs, numSteps);
+    }
+
+    /// @brief NIS of innovations and innovation covariances
+    inline Eigen::MatrixXd nis(const Eigen::MatrixXd& inovs,
+                               const Eigen::MatrixXd& inovCovs,
+                               size_t numSteps) {
+        return normalizedSquares(inovs, inovCovs, numSteps);
+    }
+
+    /**
+     * @brief Test normalized squares against two sided chi-square bounds
+     *
+     * @param values normalized squares, one row per step and one column per
+     * run
+     * @param dim dimension of the errors or innovations
+     * @param confidence probability mass between the bounds
+     * @return ConsistencyStats per step and time averaged statistics
+     */
+    static ConsistencyStats evaluate(const Eigen::MatrixXd& values, size_t dim,
+                                     double confidence = 0.95);
+
+   private:
+    utilities::ThreadPool m_pool;
+};
+
+}  // namespace lager::gncpy::simulation
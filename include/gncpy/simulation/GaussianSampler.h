@@ -0,0 +1,78 @@
+#pragma once
+#include <Eigen/Dense>
+#include <cstddef>
+
+#include "gncpy/simulation/Random.h"
+
+namespace lager::gncpy::simulation {
+
+/**
+ * @brief Draws samples from a multivariate normal distribution
+ *
+ * The square root of the covariance is computed once, by Cholesky
+ * factorization or by an LDLT factorization if the covariance is only
+ * positive semi definite, so each draw is a single matrix product. Sampling
+ * does not modify the sampler, one sampler may be shared between threads
+ * that each own their random number generator.
+ *
+ */
+class GaussianSampler {
+   public:
+    GaussianSampler() = default;
+
+    /**
+     * @brief Construct a zero mean sampler
+     *
+     * @param cov covariance of the distribution
+     */
+    explicit GaussianSampler(const Eigen::MatrixXd& cov);
+
+    /**
+     * @brief Construct a new Gaussian Sampler object
+     *
+     * @param mean mean of the distribution
+     * @param cov covariance of the distribution
+     */
+    GaussianSampler(Eigen::VectorXd mean, const Eigen::MatrixXd& cov);
+
+    /// @brief Set the covariance and recompute its square root
+    void setCovariance(const Eigen::MatrixXd& cov);
+
+    /// @brief Set the mean, must match the covariance size
+    void setMean(Eigen::VectorXd mean);
+
+    inline Eigen::Index dim() const { return m_factor.rows(); }
+    inline const Eigen::VectorXd& mean() const { return m_mean; }
+
+    /// @brief Square root S of the covariance, S * S^T = cov
+    inline const Eigen::MatrixXd& factor() const { return m_factor; }
+
+    /// @brief Draw one sample
+    Eigen::VectorXd sample(Philox& rng) const;
+
+    /**
+     * @brief Draw many samples at once
+     *
+     * @param rng random number generator
+     * @param num number of samples
+     * @return Eigen::MatrixXd one sample per column
+     */
+    Eigen::MatrixXd sample(Philox& rng, Eigen::Index num) const;
+
+    /**
+     * @brief Add a sample to every column of a matrix in place
+     *
+     * Adds noise to a batch of states or measurements, a vector is treated
+     * as a single column.
+     *
+     * @param rng random number generator
+     * @param vals values to perturb, one per column
+     */
+    void addNoise(Philox& rng, Eigen::Ref<Eigen::MatrixXd> vals) const;
+
+   private:
+    Eigen::VectorXd m_mean;
+    Eigen::MatrixXd m_factor;
+};
+
+}  // namespace lager::gncpy::simulation
@@ -0,0 +1,176 @@
+#pragma once
+#include <Eigen/Dense>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "gncpy/dynamics/IDynamics.h"
+#include "gncpy/filters/IBayesFilter.h"
+#include "gncpy/filters/Parameters.h"
+#include "gncpy/measurements/IMeasModel.h"
+#include "gncpy/measurements/Parameters.h"
+#include "gncpy/utilities/ThreadPool.h"
+
+namespace lager::gncpy::simulation {
+
+/**
+ * @brief Per run and per step metrics of a Monte Carlo experiment
+ *
+ * Every run owns a contiguous slice of each array so runs can be written in
+ * parallel without synchronization.
+ *
+ */
+class MonteCarloResult {
+    friend class MonteCarlo;
+
+   public:
+    inline size_t numRuns() const { return m_numRuns; }
+    inline size_t numSteps() const { return m_numSteps; }
+
+    /// @brief Time of each step, after the measurement update
+    inline const std::vector<double>& times() const { return m_times; }
+
+    /// @brief Estimation error (truth minus estimate) of a run at a step
+    inline Eigen::Ref<const Eigen::VectorXd> error(size_t run,
+                                                   size_t step) const {
+        return m_errors.col(run * m_numSteps + step);
+    }
+
+    /// @brief Estimation errors, one column per run and step (run major)
+    inline const Eigen::MatrixXd& errors() const { return m_errors; }
+
+    /// @brief Normalized estimation error squared, one column per run
+    inline const Eigen::MatrixXd& nees() const { return m_nees; }
+
+    /// @brief Normalized innovation squared, one column per run
+    inline const Eigen::MatrixXd& nis() const { return m_nis; }
+
+    /// @brief Root mean square error of each state at a step
+    Eigen::VectorXd rmse(size_t step) const;
+
+    /// @brief Mean NEES over all runs, one entry per step
+    inline Eigen::VectorXd meanNees() const { return m_nees.rowwise().mean(); }
+
+    /// @brief Mean NIS over all runs, one entry per step
+    inline Eigen::VectorXd meanNis() const { return m_nis.rowwise().mean(); }
+
+   private:
+    size_t m_numRuns = 0;
+    size_t m_numSteps = 0;
+    std::vector<double> m_times;
+    Eigen::MatrixXd m_errors;
+    Eigen::MatrixXd m_nees;
+    Eigen::MatrixXd m_nis;
+};
+
+/**
+ * @brief Runs Monte Carlo simulations of a filter on a thread pool
+ *
+ * Each run samples an initial truth, then every step propagates the truth
+ * with the dynamics model plus process noise, generates a noisy measurement,
+ * and runs the prediction and correction steps of its own filter. Each run
+ * draws from its own Philox stream keyed by the experiment seed, so the
+ * results are bit identical for any number of threads.
+ *
+ * The NIS uses the predicted estimate with the filter's own measurement model
+ * and noise, so it describes the filter under test even when the factory
+ * builds a filter that does not match the truth models. The filter must
+ * override IBayesFilter::measurementNoise, run throws NotImplemented
+ * otherwise.
+ *
+ * The truth and measurement models are shared by every run and must not be
+ * modified during a call to run.
+ *
+ */
+class MonteCarlo {
+   public:
+    /// @brief Creates a fully configured filter, called once per run
+    using FilterFactory =
+        std::function<std::unique_ptr<filters::IBayesFilter>()>;
+
+    /**
+     * @brief Construct a new Monte Carlo object
+     *
+     * @param numThreads number of worker threads, 0 uses the hardware
+     * concurrency
+     */
+    explicit MonteCarlo(size_t numThreads = 0);
+
+    /**
+     * @brief Set the model used to propagate the truth
+     *
+     * @param dynObj truth dynamics
+     * @param procNoise covariance of the additive process noise
+     */
+    void setTruthModel(std::shared_ptr<dynamics::IDynamics> dynObj,
+                       Eigen::MatrixXd procNoise);
+
+    /**
+     * @brief Set the model used to generate measurements of the truth
+     *
+     * @param measObj measurement model
+     * @param measNoise covariance of the additive measurement noise
+     */
+    void setMeasurementModel(std::shared_ptr<measurements::IMeasModel> measObj,
+                             Eigen::MatrixXd measNoise);
+
+    /**
+     * @brief Set the filter factory
+     *
+     * May be called from several threads at once, each call must return a
+     * new filter with its models set.
+     *
+     * @param factory filter factory
+     */
+    void setFilterFactory(FilterFactory factory);
+
+    /**
+     * @brief Set the initial estimate and covariance
+     *
+     * The initial truth of every run is sampled around the estimate with the
+     * covariance, which also initializes each filter.
+     *
+     * @param state initial state estimate
+     * @param cov initial state covariance
+     */
+    void setInitialConditions(Eigen::VectorXd state, Eigen::MatrixXd cov);
+
+    /// @brief Parameters passed to the truth model and filter prediction
+    void setPredictParams(std::shared_ptr<filters::BayesPredictParams> params);
+
+    /// @brief Parameters passed to the measurement model and filter correction
+    void setCorrectParams(std::shared_ptr<filters::BayesCorrectParams> params);
+
+    /**
+     * @brief Run the experiment
+     *
+     * @param numRuns number of independent runs
+     * @param numSteps number of filter steps per run
+     * @param dt time between steps, the models are given the time of the
+     * step they start from
+     * @param seed experiment seed
+     * @param startTime time of the initial conditions
+     * @return MonteCarloResult metrics of every run
+     */
+    MonteCarloResult run(size_t numRuns, size_t numSteps, double dt,
+                         uint64_t seed, double startTime = 0.0);
+
+    inline size_t numThreads() const { return m_pool.size(); }
+
+   private:
+    std::shared_ptr<dynamics::IDynamics> m_dynObj;
+    std::shared_ptr<measurements::IMeasModel> m_measObj;
+    Eigen::MatrixXd m_procNoise;
+    Eigen::MatrixXd m_measNoise;
+    FilterFactory m_factory;
+    Eigen::VectorXd m_initState;
+    Eigen::MatrixXd m_initCov;
+    std::shared_ptr<filters::BayesPredictParams> m_predParams;
+    std::shared_ptr<filters::BayesCorrectParams> m_corrParams;
+
+    utilities::ThreadPool m_pool;
+};
+
+}  // namespace lager::gncpy::simulation
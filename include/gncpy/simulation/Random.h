@@ -0,0 +1,106 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace lager::gncpy::simulation {
+
+/**
+ * @brief Philox4x32-10 counter based random number generator
+ *
+ * Every (seed, stream) pair is an independent sequence that is a pure
+ * function of its counter, see
+ * @cite Salmon2011_ParallelRandomNumbersAsEasyas123
+ * Giving every Monte Carlo run its own stream makes the results identical no
+ * matter which thread executes the run or in what order. Satisfies the
+ * standard UniformRandomBitGenerator requirements.
+ *
+ */
+class Philox {
+   public:
+    using result_type = uint32_t;
+
+    /**
+     * @brief Construct a new Philox generator
+     *
+     * @param seed key shared by every stream of an experiment
+     * @param stream stream index, typically the run number
+     */
+    explicit Philox(uint64_t seed = 0, uint64_t stream = 0) noexcept
+        : m_key{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)},
+          m_stream(stream) {}
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    /// @brief Next 32 random bits
+    inline result_type operator()() noexcept {
+        if (m_ind == 4) {
+            m_block = generate(m_counter++);
+            m_ind = 0;
+        }
+        return m_block[m_ind++];
+    }
+
+    /**
+     * @brief Random block for a counter value, does not advance the generator
+     *
+     * @param counter block index within the stream
+     * @return std::array<uint32_t, 4> four independent 32 bit outputs
+     */
+    std::array<uint32_t, 4> generate(uint64_t counter) const noexcept;
+
+    /// @brief Skip ahead by a number of 4 word blocks
+    inline void discardBlocks(uint64_t n) noexcept {
+        m_counter += n;
+        m_ind = 4;
+    }
+
+    /// @brief Uniform double in [0, 1) with 53 random bits
+    inline double uniform() noexcept {
+        uint64_t hi = (*this)();
+        uint64_t lo = (*this)();
+        return static_cast<double>(((hi << 32) | lo) >> 11) * 0x1.0p-53;
+    }
+
+    /// @brief Number of normal samples generated at once
+    static constexpr std::size_t NORMAL_BATCH = 64;
+
+    /// @brief Standard normal sample
+    inline double normal() noexcept {
+        if (m_normInd == NORMAL_BATCH) {
+            normalBatch(m_normals.data());
+            m_normInd = 0;
+        }
+        return m_normals[m_normInd++];
+    }
+
+    /**
+     * @brief Fill an array with standard normal samples
+     *
+     * Samples are always produced in batches of NORMAL_BATCH by a vectorized
+     * Box-Muller transform, so filling n values gives exactly the same
+     * numbers as n calls to normal.
+     *
+     * @param out output array
+     * @param n number of samples
+     */
+    void fillNormal(double* out, std::size_t n) noexcept;
+
+   private:
+    void normalBatch(double* out) noexcept;
+
+    std::array<uint32_t, 2> m_key;
+    uint64_t m_stream;
+    uint64_t m_counter = 0;
+    std::array<uint32_t, 4> m_block{};
+    unsigned int m_ind = 4;
+
+    std::array<double, NORMAL_BATCH> m_normals{};
+    std::size_t m_normInd = NORMAL_BATCH;
+};
+
+}  // namespace lager::gncpy::simulation
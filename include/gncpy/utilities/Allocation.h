@@ -0,0 +1,220 @@
+#pragma once
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace lager::gncpy::utilities {
+
+/// @brief Heap allocation totals for one thread
+struct AllocStats {
+    uint64_t allocations = 0;
+    uint64_t deallocations = 0;
+    uint64_t bytes = 0;
+};
+
+/**
+ * @brief Record a heap allocation on the calling thread
+ *
+ * Called by the counting allocator, see GNCPY_COUNTING_ALLOCATOR. Must not
+ * allocate.
+ *
+ * @param bytes size of the allocation
+ */
+void recordAllocation(std::size_t bytes) noexcept;
+
+/// @brief Record a heap deallocation on the calling thread
+void recordDeallocation() noexcept;
+
+/// @brief Totals recorded on the calling thread since it started
+AllocStats threadAllocStats() noexcept;
+
+/**
+ * @brief Number of allocations made on the calling thread while a
+ * NoAllocGuard was active
+ */
+uint64_t threadAllocViolations() noexcept;
+
+/**
+ * @brief Counts the heap allocations made on the calling thread during its
+ * lifetime
+ *
+ * Only counts when the program is built with GNCPY_COUNTING_ALLOCATOR.
+ *
+ */
+class AllocCounter {
+   public:
+    AllocCounter() noexcept : m_start(threadAllocStats()) {}
+
+    AllocStats stats() const noexcept;
+    inline uint64_t allocations() const noexcept {
+        return stats().allocations;
+    }
+
+   private:
+    AllocStats m_start;
+};
+
+/**
+ * @brief Marks a region where the calling thread must not allocate
+ *
+ * Every allocation made while a guard is active is counted as a violation,
+ * see threadAllocViolations. When Eigen is built with EIGEN_RUNTIME_NO_MALLOC
+ * (the GNCPY_ALLOC_TRACKING build option) Eigen allocations also trip its
+ * internal assertion.
+ *
+ */
+class NoAllocGuard {
+   public:
+    NoAllocGuard() noexcept;
+    ~NoAllocGuard();
+
+    NoAllocGuard(const NoAllocGuard&) = delete;
+    NoAllocGuard& operator=(const NoAllocGuard&) = delete;
+
+   private:
+    bool m_eigenAllowed;
+};
+
+/// @brief Aggregated allocations of one instrumented function
+struct AllocSiteReport {
+    std::string name;
+    uint64_t calls;
+    uint64_t allocations;
+    uint64_t bytes;
+};
+
+/**
+ * @brief Allocation counters for one instrumented function
+ *
+ * Created as a function local static by GNCPY_ALLOC_SCOPE, every site adds
+ * itself to a global list on first use.
+ *
+ */
+class AllocSite {
+   public:
+    explicit AllocSite(const char* name) noexcept;
+
+    const char* name;
+    std::atomic<uint64_t> calls = 0;
+    std::atomic<uint64_t> allocations = 0;
+    std::atomic<uint64_t> bytes = 0;
+    AllocSite* next = nullptr;
+};
+
+/// @brief Adds the allocations made during its lifetime to a site
+class AllocSiteScope {
+   public:
+    explicit AllocSiteScope(AllocSite& site) noexcept
+        : m_site(site), m_start(threadAllocStats()) {}
+    ~AllocSiteScope();
+
+    AllocSiteScope(const AllocSiteScope&) = delete;
+    AllocSiteScope& operator=(const AllocSiteScope&) = delete;
+
+   private:
+    AllocSite& m_site;
+    AllocStats m_start;
+};
+
+/**
+ * @brief Report of every instrumented function called so far
+ *
+ * Counts are inclusive, allocations of nested instrumented calls are also
+ * counted by the caller.
+ *
+ * @return std::vector<AllocSiteReport> one entry per site
+ */
+std::vector<AllocSiteReport> allocReport();
+
+/// @brief Reset the counters of every instrumented function
+void resetAllocReport() noexcept;
+
+}  // namespace lager::gncpy::utilities
+
+// per function allocation counters, compiled out unless GNCPY_ALLOC_TRACKING
+// is defined
+#ifdef GNCPY_ALLOC_TRACKING
+#define GNCPY_ALLOC_SCOPE(name)                                            \
+    static ::lager::gncpy::utilities::AllocSite gncpyAllocSite_(name);     \
+    ::lager::gncpy::utilities::AllocSiteScope gncpyAllocScope_(            \
+        gncpyAllocSite_)
+#else
+#define GNCPY_ALLOC_SCOPE(name) static_cast<void>(0)
+#endif
+
+// Installs the counting allocator, expand in exactly one source file of the
+// executable at global scope. On glibc the C allocation functions are
+// interposed so Eigen allocations are counted as well, otherwise only the
+// global operator new and delete are replaced.
+#if defined(__GLIBC__)
+#define GNCPY_COUNTING_ALLOCATOR                                           \
+    extern "C" {                                                           \
+    void* __libc_malloc(std::size_t);                                      \
+    void* __libc_calloc(std::size_t, std::size_t);                         \
+    void* __libc_realloc(void*, std::size_t);                              \
+    void* __libc_memalign(std::size_t, std::size_t);                       \
+    void __libc_free(void*);                                               \
+    void* malloc(std::size_t n) noexcept {                                 \
+        ::lager::gncpy::utilities::recordAllocation(n);                    \
+        return __libc_malloc(n);                                           \
+    }                                                                      \
+    void* calloc(std::size_t c, std::size_t n) noexcept {                  \
+        ::lager::gncpy::utilities::recordAllocation(c * n);                \
+        return __libc_calloc(c, n);                                        \
+    }                                                                      \
+    void* realloc(void* p, std::size_t n) noexcept {                       \
+        ::lager::gncpy::utilities::recordAllocation(n);                    \
+        if (p != nullptr) {                                                \
+            ::lager::gncpy::utilities::recordDeallocation();               \
+        }                                                                  \
+        return __libc_realloc(p, n);                                       \
+    }                                                                      \
+    void* aligned_alloc(std::size_t a, std::size_t n) noexcept {           \
+        ::lager::gncpy::utilities::recordAllocation(n);                    \
+        return __libc_memalign(a, n);                                      \
+    }                                                                      \
+    void* memalign(std::size_t a, std::size_t n) noexcept {                \
+        ::lager::gncpy::utilities::recordAllocation(n);                    \
+        return __libc_memalign(a, n);                                      \
+    }                                                                      \
+    int posix_memalign(void** p, std::size_t a, std::size_t n) noexcept {  \
+        ::lager::gncpy::utilities::recordAllocation(n);                    \
+        *p = __libc_memalign(a, n);                                        \
+        return *p != nullptr || n == 0 ? 0 : ENOMEM;                       \
+    }                                                                      \
+    void free(void* p) noexcept {                                          \
+        if (p != nullptr) {                                                \
+            ::lager::gncpy::utilities::recordDeallocation();               \
+        }                                                                  \
+        __libc_free(p);                                                    \
+    }                                                                      \
+    }
+#else
+#define GNCPY_COUNTING_ALLOCATOR                                           \
+    void* operator new(std::size_t n) {                                    \
+        ::lager::gncpy::utilities::recordAllocation(n);                    \
+        if (void* p = std::malloc(n == 0 ? 1 : n)) {                       \
+            return p;                                                      \
+        }                                                                  \
+        throw std::bad_alloc();                                            \
+    }                                                                      \
+    void* operator new[](std::size_t n) { return operator new(n); }        \
+    void operator delete(void* p) noexcept {                               \
+        if (p != nullptr) {                                                \
+            ::lager::gncpy::utilities::recordDeallocation();               \
+        }                                                                  \
+        std::free(p);                                                      \
+    }                                                                      \
+    void operator delete[](void* p) noexcept { operator delete(p); }       \
+    void operator delete(void* p, std::size_t) noexcept {                  \
+        operator delete(p);                                                \
+    }                                                                      \
+    void operator delete[](void* p, std::size_t) noexcept {                \
+        operator delete(p);                                                \
+    }
+#endif
@@ -0,0 +1,183 @@
+#pragma once
+#include <Eigen/Dense>
+#include <cstdint>
+#include <span>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "gncpy/utilities/MappedFile.h"
+
+namespace lager::gncpy::utilities {
+
+/// @brief Predefined checkpoint fields, any other value may be used for user
+/// data
+enum class CheckpointField : uint32_t { State = 0, Covariance = 1, Model = 2 };
+
+/**
+ * @brief Index entry of one checkpoint record
+ *
+ * Records are identified by an id (typically a track id) and a field. Matrix
+ * records hold rows x cols doubles in column major order, blob records hold
+ * rows bytes.
+ *
+ */
+struct CheckpointEntry {
+    uint64_t id;
+    uint32_t field;
+    uint32_t type;
+    uint64_t offset;
+    uint64_t rows;
+    uint64_t cols;
+
+    static constexpr uint32_t MATRIX = 0;
+    static constexpr uint32_t BLOB = 1;
+};
+
+/**
+ * @brief Builds a flat binary checkpoint
+ *
+ * Matrices are not copied when added, they are copied once straight into the
+ * mapped output file by write so they must stay alive (and unchanged) until
+ * then. The file layout is a fixed header, the 64 byte aligned records and a
+ * sorted index, see Checkpoint for reading it back.
+ *
+ */
+class CheckpointWriter {
+   public:
+    /**
+     * @brief Add a matrix record
+     *
+     * @param id record id
+     * @param field record field
+     * @param mat matrix, referenced until write is called
+     */
+    void addMatrix(uint64_t id, CheckpointField field,
+                   const Eigen::MatrixXd& mat);
+
+    /// @brief Add a vector record, stored as a single column matrix
+    void addVector(uint64_t id, CheckpointField field,
+                   const Eigen::VectorXd& vec);
+
+    /**
+     * @brief Add a record of raw bytes
+     *
+     * @param id record id
+     * @param field record field
+     * @param bytes record contents, copied
+     */
+    void addBlob(uint64_t id, CheckpointField field, std::string bytes);
+
+    /**
+     * @brief Add a serializable object such as a filter or dynamics model
+     *
+     * Stored as the output of its saveClassState, models are typically shared
+     * by many tracks so this is meant for a few records not one per track.
+     *
+     * @tparam T class using GNCPY_SERIALIZE_CLASS
+     * @param id record id
+     * @param field record field
+     * @param obj object to save
+     */
+    template <typename T>
+    void addObject(uint64_t id, CheckpointField field, const T& obj) {
+        addBlob(id, field, obj.saveClassState().str());
+    }
+
+    inline std::size_t size() const { return m_records.size(); }
+
+    /**
+     * @brief Write the checkpoint
+     *
+     * The file is written under a temporary name and renamed into place once
+     * complete, so an interrupted write never leaves a partial checkpoint
+     * behind.
+     *
+     * @param path output file
+     */
+    void write(const std::string& path) const;
+
+   private:
+    struct Record {
+        CheckpointEntry entry;
+        const double* data;
+        std::size_t blob;
+    };
+
+    std::vector<Record> m_records;
+    std::vector<std::string> m_blobs;
+};
+
+/**
+ * @brief Read only view of a checkpoint file
+ *
+ * The file is memory mapped and matrices are returned as Eigen::Map views
+ * into the mapping, so opening is independent of the checkpoint size and
+ * nothing is copied until a record is used. Views are valid for the lifetime
+ * of the Checkpoint.
+ *
+ */
+class Checkpoint {
+   public:
+    static constexpr uint32_t VERSION = 1;
+
+    /**
+     * @brief Open and validate a checkpoint
+     *
+     * @param path file written by CheckpointWriter
+     * @return Checkpoint view of the file
+     */
+    static Checkpoint open(const std::string& path);
+
+    inline uint32_t version() const { return m_version; }
+    inline std::span<const CheckpointEntry> entries() const {
+        return m_entries;
+    }
+
+    /// @brief Whether the checkpoint holds the given record
+    bool contains(uint64_t id, CheckpointField field) const;
+
+    /**
+     * @brief View of a matrix record
+     *
+     * @param id record id
+     * @param field record field
+     * @return Eigen::Map<const Eigen::MatrixXd> view into the mapped file
+     */
+    Eigen::Map<const Eigen::MatrixXd> matrix(uint64_t id,
+                                             CheckpointField field) const;
+
+    /// @brief View of a single column matrix record
+    Eigen::Map<const Eigen::VectorXd> vector(uint64_t id,
+                                             CheckpointField field) const;
+
+    /// @brief View of a blob record
+    std::string_view blob(uint64_t id, CheckpointField field) const;
+
+    /**
+     * @brief Load a serializable object saved with addObject
+     *
+     * @tparam T class using GNCPY_SERIALIZE_CLASS
+     * @param id record id
+     * @param field record field
+     * @return T loaded object
+     */
+    template <typename T>
+    T loadObject(uint64_t id, CheckpointField field) const {
+        std::stringstream ss(std::ios::in | std::ios::out | std::ios::binary);
+        std::string_view bytes = blob(id, field);
+        ss.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        return T::loadClass(ss);
+    }
+
+   private:
+    const CheckpointEntry& find(uint64_t id, CheckpointField field,
+                                uint32_t type) const;
+
+    MappedFile m_file;
+    uint32_t m_version = 0;
+    std::span<const CheckpointEntry> m_entries;
+};
+
+}  // namespace lager::gncpy::utilities
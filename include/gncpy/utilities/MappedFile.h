@@ -0,0 +1,81 @@
+#pragma once
+#include <cstddef>
+#include <string>
+
+namespace lager::gncpy::utilities {
+
+/**
+ * @brief Memory mapped view of a whole file
+ *
+ * Read only files are mapped shared so every process reading the same file
+ * uses the same page cache pages. Files opened for writing are resized first
+ * and changes go straight to the page cache.
+ *
+ */
+class MappedFile {
+   public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * @brief Map an existing file read only
+     *
+     * @param path file to open
+     * @return MappedFile mapping of the file
+     */
+    static MappedFile openRead(const std::string& path);
+
+    /**
+     * @brief Map an existing file for reading and writing
+     *
+     * @param path file to open
+     * @return MappedFile mapping of the file
+     */
+    static MappedFile openWrite(const std::string& path);
+
+    /**
+     * @brief Create (or truncate) a file of the given size and map it for
+     * writing
+     *
+     * @param path file to create
+     * @param size size of the file in bytes
+     * @return MappedFile mapping of the file
+     */
+    static MappedFile create(const std::string& path, std::size_t size);
+
+    /**
+     * @brief Grow or shrink a writable mapping
+     *
+     * Pointers into the old mapping are invalidated.
+     *
+     * @param size new size of the file in bytes
+     */
+    void resize(std::size_t size);
+
+    /// @brief Flush changes to disk, blocks until done
+    void sync();
+
+    /// @brief Unmap and close the file
+    void close() noexcept;
+
+    inline const std::byte* data() const { return m_data; }
+    inline std::byte* data() { return m_data; }
+    inline std::size_t size() const { return m_size; }
+    inline bool isOpen() const { return m_fd >= 0; }
+    inline bool writable() const { return m_writable; }
+
+   private:
+    void map();
+
+    int m_fd = -1;
+    std::byte* m_data = nullptr;
+    std::size_t m_size = 0;
+    bool m_writable = false;
+};
+
+}  // namespace lager::gncpy::utilities
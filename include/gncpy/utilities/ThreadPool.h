@@ -0,0 +1,91 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace lager::gncpy::utilities {
+
+/**
+ * @brief Fixed size work stealing thread pool
+ *
+ * Every worker owns a task queue. Tasks submitted from a worker go to the back
+ * of its own queue and are run last in first out, tasks submitted from any
+ * other thread are spread over the queues. An idle worker steals from the
+ * front of the other queues before going to sleep.
+ *
+ */
+class ThreadPool {
+   public:
+    /**
+     * @brief Construct a new Thread Pool object
+     *
+     * @param numThreads number of workers, 0 uses the hardware concurrency
+     */
+    explicit ThreadPool(size_t numThreads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Queue a task for execution
+     *
+     * @param task callable to run on one of the workers
+     */
+    void submit(std::function<void()> task);
+
+    /**
+     * @brief Block until every submitted task has finished
+     *
+     * Must not be called from a task. If any task threw, the first exception
+     * is rethrown here.
+     */
+    void wait();
+
+    /**
+     * @brief Split [0, num) into contiguous ranges, run them and wait
+     *
+     * Every range holds at least minChunk items unless num is smaller, and
+     * there are at most four ranges per worker so stealing can even out
+     * uneven ranges. Must not be called from a task. If any range threw, the
+     * first exception is rethrown.
+     *
+     * @param num number of items
+     * @param minChunk smallest number of items worth handing to a worker
+     * @param fnc called with the start and one past the end of each range
+     */
+    void parallelFor(size_t num, size_t minChunk,
+                     const std::function<void(size_t, size_t)>& fnc);
+
+    inline size_t size() const { return m_workers.size(); }
+
+   private:
+    struct TaskQueue {
+        std::mutex mut;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    void workerLoop(size_t ind);
+    bool tryPop(size_t ind, std::function<void()>& task);
+
+    std::vector<std::unique_ptr<TaskQueue>> m_queues;
+    std::vector<std::thread> m_workers;
+
+    std::mutex m_mut;
+    std::condition_variable m_taskCv;
+    std::condition_variable m_doneCv;
+    std::atomic<size_t> m_queued = 0;
+    std::atomic<size_t> m_pending = 0;
+    std::atomic<size_t> m_next = 0;
+    bool m_stop = false;
+    std::exception_ptr m_error;
+};
+
+}  // namespace lager::gncpy::utilities
@@ -0,0 +1,118 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace lager::gncpy::utilities {
+
+/// @brief Number of latency histogram buckets, bucket i holds durations in
+/// [2^(i-1), 2^i) nanoseconds and the last bucket everything longer
+inline constexpr std::size_t TRACE_BUCKETS = 40;
+
+/// @brief Aggregated timing of one traced stage
+struct TraceStageReport {
+    std::string name;
+    uint64_t calls;
+    uint64_t totalNs;
+    uint64_t maxNs;
+    std::array<uint64_t, TRACE_BUCKETS> histogram;
+
+    /// @brief Mean duration in nanoseconds
+    double meanNs() const;
+    /**
+     * @brief Approximate duration percentile from the histogram
+     *
+     * @param fraction percentile as a fraction in [0, 1]
+     * @return uint64_t upper edge of the bucket holding the percentile in
+     * nanoseconds
+     */
+    uint64_t percentileNs(double fraction) const;
+};
+
+/**
+ * @brief Timing counters for one traced stage
+ *
+ * Created as a function local static by GNCPY_TRACE_SCOPE, every stage adds
+ * itself to a global list on first use. Updates are lock free so stages may
+ * be traced from several threads.
+ *
+ */
+class TraceStage {
+   public:
+    explicit TraceStage(const char* name) noexcept;
+
+    /// @brief Add one call of the given duration
+    void record(uint64_t ns) noexcept;
+
+    const char* name;
+    std::atomic<uint64_t> calls = 0;
+    std::atomic<uint64_t> totalNs = 0;
+    std::atomic<uint64_t> maxNs = 0;
+    std::array<std::atomic<uint64_t>, TRACE_BUCKETS> histogram{};
+    TraceStage* next = nullptr;
+};
+
+/// @brief Records the time between its construction and destruction
+class TraceScope {
+   public:
+    explicit TraceScope(TraceStage& stage) noexcept
+        : m_stage(stage), m_start(std::chrono::steady_clock::now()) {}
+    ~TraceScope() {
+        m_stage.record(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - m_start)
+                .count()));
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+   private:
+    TraceStage& m_stage;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+/**
+ * @brief Report of every traced stage called so far
+ *
+ * Durations are inclusive, nested stages are also counted by the enclosing
+ * stage.
+ *
+ * @return std::vector<TraceStageReport> one entry per stage
+ */
+std::vector<TraceStageReport> traceReport();
+
+/// @brief Reset the counters of every traced stage
+void resetTraceReport() noexcept;
+
+/**
+ * @brief Writes the trace report as a table
+ *
+ * One row per stage with the call count, mean, p50, p99 and max latency
+ * followed by the non-empty histogram buckets.
+ *
+ * @param os output stream
+ */
+void writeTraceReport(std::ostream& os);
+
+}  // namespace lager::gncpy::utilities
+
+#define GNCPY_TRACE_CONCAT_(a, b) a##b
+#define GNCPY_TRACE_CONCAT(a, b) GNCPY_TRACE_CONCAT_(a, b)
+
+// per stage timers, compiled out unless GNCPY_TRACING is defined. Several
+// scopes may be used in one function, each times until the end of its block.
+#ifdef GNCPY_TRACING
+#define GNCPY_TRACE_SCOPE(name)                                            \
+    static ::lager::gncpy::utilities::TraceStage GNCPY_TRACE_CONCAT(       \
+        gncpyTraceStage_, __LINE__)(name);                                 \
+    ::lager::gncpy::utilities::TraceScope GNCPY_TRACE_CONCAT(              \
+        gncpyTraceScope_,                                                  \
+        __LINE__)(GNCPY_TRACE_CONCAT(gncpyTraceStage_, __LINE__))
+#else
+#define GNCPY_TRACE_SCOPE(name) static_cast<void>(0)
+#endif
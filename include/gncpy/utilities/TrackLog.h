@@ -0,0 +1,180 @@
+#pragma once
+#include <Eigen/Dense>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gncpy/utilities/MappedFile.h"
+
+namespace lager::gncpy::utilities {
+
+/// @brief Index entry of one logged record
+struct TrackLogIndexEntry {
+    uint64_t trackId;
+    double time;
+    uint64_t offset;
+};
+
+/**
+ * @brief Writes an append only binary log of track states and covariances
+ *
+ * Every record has a fixed layout header (track id, timestamp and
+ * dimensions) followed by the raw state and covariance. After every
+ * indexInterval records an index block sorted by track and time is appended,
+ * each block points to the previous one and the file header points to the
+ * newest, so readers never scan more than one interval of records. Records
+ * are encoded into a memory buffer and written by a background thread, append
+ * only blocks on encoding.
+ *
+ */
+class TrackLogWriter {
+   public:
+    /**
+     * @brief Create (or truncate) a log file
+     *
+     * @param path output file
+     * @param indexInterval number of records between index blocks
+     * @param flushBytes buffered bytes that trigger a background write
+     */
+    explicit TrackLogWriter(const std::string& path,
+                            std::size_t indexInterval = 1024,
+                            std::size_t flushBytes = 1 << 20);
+    ~TrackLogWriter();
+
+    TrackLogWriter(const TrackLogWriter&) = delete;
+    TrackLogWriter& operator=(const TrackLogWriter&) = delete;
+
+    /**
+     * @brief Append a record, not thread safe
+     *
+     * @param trackId track identifier
+     * @param time timestamp of the estimate
+     * @param state state estimate
+     * @param cov state covariance, may be empty
+     */
+    void append(uint64_t trackId, double time, const Eigen::VectorXd& state,
+                const Eigen::MatrixXd& cov);
+
+    /**
+     * @brief Block until everything appended so far is written
+     *
+     * Rethrows any error raised by the background writer.
+     */
+    void flush();
+
+    /// @brief Write the final index block, flush and stop the writer thread
+    void close();
+
+    inline uint64_t numRecords() const { return m_numRecords; }
+
+   private:
+    struct Chunk {
+        std::vector<std::byte> bytes;
+        uint64_t lastIndex;
+    };
+
+    void writeIndex();
+    void submit();
+    void writerLoop();
+
+    int m_fd = -1;
+    std::size_t m_indexInterval;
+    std::size_t m_flushBytes;
+
+    uint64_t m_offset = 0;
+    uint64_t m_lastIndex = 0;
+    uint64_t m_numRecords = 0;
+    std::vector<std::byte> m_buffer;
+    std::vector<TrackLogIndexEntry> m_pending;
+
+    std::mutex m_mut;
+    std::condition_variable m_cv;
+    std::deque<Chunk> m_queue;
+    bool m_busy = false;
+    bool m_stop = false;
+    std::exception_ptr m_error;
+    std::thread m_thread;
+};
+
+/// @brief View of one logged record, points into the mapped log file
+struct TrackLogRecord {
+    uint64_t trackId;
+    double time;
+    Eigen::Map<const Eigen::VectorXd> state;
+    Eigen::Map<const Eigen::MatrixXd> cov;
+};
+
+/**
+ * @brief Memory mapped reader for logs written by TrackLogWriter
+ *
+ * Opening only walks the chain of index blocks and the records after the
+ * last block. Queries binary search the blocks that overlap the requested
+ * time range and check each record they return, so a damaged record throws
+ * IOError from the query that reaches it rather than from open. The reader
+ * sees the file as it was when opened, reopen it to see records appended
+ * since. A log whose writer did not close cleanly is still readable up to
+ * the last complete record.
+ *
+ */
+class TrackLogReader {
+   public:
+    /**
+     * @brief Open a log file
+     *
+     * @param path file written by TrackLogWriter
+     * @return TrackLogReader reader of the file
+     */
+    static TrackLogReader open(const std::string& path);
+
+    inline std::size_t size() const { return m_numRecords; }
+
+    /**
+     * @brief Records of one track within a time range
+     *
+     * @param trackId track identifier
+     * @param startTime first timestamp, inclusive
+     * @param endTime last timestamp, inclusive
+     * @return std::vector<TrackLogRecord> records ordered by time
+     */
+    std::vector<TrackLogRecord> query(
+        uint64_t trackId,
+        double startTime = -std::numeric_limits<double>::infinity(),
+        double endTime = std::numeric_limits<double>::infinity()) const;
+
+    /**
+     * @brief Records of every track within a time range
+     *
+     * @param startTime first timestamp, inclusive
+     * @param endTime last timestamp, inclusive
+     * @return std::vector<TrackLogRecord> records ordered by time
+     */
+    std::vector<TrackLogRecord> queryTime(double startTime,
+                                          double endTime) const;
+
+   private:
+    struct Block {
+        double minTime;
+        double maxTime;
+        const TrackLogIndexEntry* entries;
+        std::size_t count;
+    };
+
+    TrackLogRecord record(uint64_t offset) const;
+    std::vector<TrackLogRecord> collect(
+        std::vector<const TrackLogIndexEntry*>& found) const;
+
+    MappedFile m_file;
+    std::vector<Block> m_blocks;
+    // records after the last index block, sorted like a block
+    std::vector<TrackLogIndexEntry> m_tail;
+    std::size_t m_numRecords = 0;
+};
+
+}  // namespace lager::gncpy::utilities
@@ -0,0 +1,26 @@
+#pragma once
+#include <pybind11/eigen.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <Eigen/Dense>
+
+namespace lager::gncpy::python {
+
+namespace py = pybind11;
+
+/// @brief Batch layout, one state or measurement per row of an (N, n) array
+using RowMatrixXd =
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+/// @brief View of an (N, n) array, copied unless C contiguous float64
+using BatchRef = Eigen::Ref<const RowMatrixXd>;
+
+/// @brief View of a vector, copied unless contiguous float64
+using VectorRef = Eigen::Ref<const Eigen::VectorXd>;
+
+void bindDynamics(py::module_& m);
+void bindMeasurements(py::module_& m);
+void bindFilters(py::module_& m);
+
+}  // namespace lager::gncpy::python
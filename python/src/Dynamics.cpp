@@ -0,0 +1,149 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Bindings.h"
+#include "gncpy/dynamics/ClohessyWiltshire.h"
+#include "gncpy/dynamics/ClohessyWiltshire2D.h"
+#include "gncpy/dynamics/CoordinatedTurn.h"
+#include "gncpy/dynamics/CurvilinearMotion.h"
+#include "gncpy/dynamics/DoubleIntegrator.h"
+#include "gncpy/dynamics/IDynamics.h"
+#include "gncpy/dynamics/ILinearDynamics.h"
+#include "gncpy/dynamics/INonLinearDynamics.h"
+#include "gncpy/dynamics/Keplerian.h"
+#include "gncpy/dynamics/Parameters.h"
+#include "gncpy/dynamics/TwoBodyJ2.h"
+
+namespace lager::gncpy::python {
+
+namespace {
+
+// propagates every row of the batch, the output owns its buffer and is moved
+// into the returned array
+RowMatrixXd propagateBatch(const dynamics::IDynamics& dyn, double timestep,
+                           BatchRef states,
+                           const dynamics::StateTransParams* params) {
+    RowMatrixXd out(states.rows(), states.cols());
+    Eigen::VectorXd state(states.cols());
+    for (Eigen::Index ii = 0; ii < states.rows(); ii++) {
+        state = states.row(ii).transpose();
+        out.row(ii) = dyn.propagateState(timestep, state, params).transpose();
+    }
+    return out;
+}
+
+}  // namespace
+
+void bindDynamics(py::module_& m) {
+    py::class_<dynamics::StateTransParams,
+               std::shared_ptr<dynamics::StateTransParams>>(m,
+                                                            "StateTransParams")
+        .def(py::init<>());
+
+    py::class_<dynamics::IDynamics, std::shared_ptr<dynamics::IDynamics>>(
+        m, "IDynamics")
+        .def(
+            "propagate_state",
+            [](const dynamics::IDynamics& self, double timestep,
+               VectorRef state, const dynamics::StateTransParams* params) {
+                return self.propagateState(timestep, state, params);
+            },
+            py::arg("timestep"), py::arg("state"),
+            py::arg("params") = nullptr,
+            py::call_guard<py::gil_scoped_release>())
+        .def("propagate_batch", &propagateBatch, py::arg("timestep"),
+             py::arg("states"), py::arg("params") = nullptr,
+             py::call_guard<py::gil_scoped_release>(),
+             "Propagate an (N, n) array of states, one per row")
+        .def_property_readonly("state_names",
+                               &dynamics::IDynamics::stateNames)
+        .def_property_readonly("has_control_model",
+                               &dynamics::IDynamics::hasControlModel);
+
+    py::class_<dynamics::ILinearDynamics, dynamics::IDynamics,
+               std::shared_ptr<dynamics::ILinearDynamics>>(m, "ILinearDynamics")
+        .def(
+            "get_state_mat",
+            [](const dynamics::ILinearDynamics& self, double timestep,
+               const dynamics::StateTransParams* params) {
+                return self.getStateMat(timestep, params);
+            },
+            py::arg("timestep"), py::arg("params") = nullptr,
+            py::call_guard<py::gil_scoped_release>());
+
+    py::class_<dynamics::INonLinearDynamics, dynamics::IDynamics,
+               std::shared_ptr<dynamics::INonLinearDynamics>>(
+        m, "INonLinearDynamics")
+        .def(
+            "continuous_dynamics",
+            [](const dynamics::INonLinearDynamics& self, double timestep,
+               VectorRef state, const dynamics::StateTransParams* params) {
+                return self.continuousDynamics(timestep, state, params);
+            },
+            py::arg("timestep"), py::arg("state"),
+            py::arg("params") = nullptr,
+            py::call_guard<py::gil_scoped_release>())
+        .def(
+            "get_state_mat",
+            [](const dynamics::INonLinearDynamics& self, double timestep,
+               VectorRef state, const dynamics::StateTransParams* params) {
+                return self.getStateMat(timestep, state, params);
+            },
+            py::arg("timestep"), py::arg("state"),
+            py::arg("params") = nullptr,
+            py::call_guard<py::gil_scoped_release>())
+        .def_property("dt", &dynamics::INonLinearDynamics::dt,
+                      &dynamics::INonLinearDynamics::setDt);
+
+    py::class_<dynamics::DoubleIntegrator, dynamics::ILinearDynamics,
+               std::shared_ptr<dynamics::DoubleIntegrator>>(m,
+                                                            "DoubleIntegrator")
+        .def(py::init<double>(), py::arg("dt"))
+        .def_property("dt", &dynamics::DoubleIntegrator::dt,
+                      &dynamics::DoubleIntegrator::setDt);
+
+    py::class_<dynamics::ClohessyWiltshire2D, dynamics::ILinearDynamics,
+               std::shared_ptr<dynamics::ClohessyWiltshire2D>>(
+        m, "ClohessyWiltshire2D")
+        .def(py::init<double, double>(), py::arg("dt"), py::arg("mean_motion"))
+        .def_property("dt", &dynamics::ClohessyWiltshire2D::dt,
+                      &dynamics::ClohessyWiltshire2D::setDt)
+        .def_property("mean_motion",
+                      &dynamics::ClohessyWiltshire2D::mean_motion,
+                      &dynamics::ClohessyWiltshire2D::setMeanMotion);
+
+    py::class_<dynamics::ClohessyWiltshire, dynamics::ClohessyWiltshire2D,
+               std::shared_ptr<dynamics::ClohessyWiltshire>>(
+        m, "ClohessyWiltshire")
+        .def(py::init<double, double>(), py::arg("dt"),
+             py::arg("mean_motion"));
+
+    py::class_<dynamics::CurvilinearMotion, dynamics::INonLinearDynamics,
+               std::shared_ptr<dynamics::CurvilinearMotion>>(
+        m, "CurvilinearMotion")
+        .def(py::init<double>(), py::arg("dt"));
+
+    py::class_<dynamics::CoordinatedTurn, dynamics::INonLinearDynamics,
+               std::shared_ptr<dynamics::CoordinatedTurn>>(m,
+                                                           "CoordinatedTurn")
+        .def(py::init<double>(), py::arg("dt"));
+
+    py::class_<dynamics::TwoBodyJ2, dynamics::INonLinearDynamics,
+               std::shared_ptr<dynamics::TwoBodyJ2>>(m, "TwoBodyJ2")
+        .def(py::init<double, double, double, double>(), py::arg("dt"),
+             py::arg("mu") = dynamics::TwoBodyJ2::EARTH_MU,
+             py::arg("radius") = dynamics::TwoBodyJ2::EARTH_RADIUS,
+             py::arg("j2") = dynamics::TwoBodyJ2::EARTH_J2)
+        .def_property_readonly("mu", &dynamics::TwoBodyJ2::mu)
+        .def_property_readonly("radius", &dynamics::TwoBodyJ2::radius)
+        .def_property_readonly("j2", &dynamics::TwoBodyJ2::j2);
+
+    py::class_<dynamics::Keplerian, dynamics::INonLinearDynamics,
+               std::shared_ptr<dynamics::Keplerian>>(m, "Keplerian")
+        .def(py::init<double, double>(), py::arg("dt"),
+             py::arg("mu") = dynamics::TwoBodyJ2::EARTH_MU)
+        .def_property_readonly("mu", &dynamics::Keplerian::mu);
+}
+
+}  // namespace lager::gncpy::python
@@ -0,0 +1,124 @@
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "Bindings.h"
+#include "gncpy/Exceptions.h"
+#include "gncpy/filters/ExtendedKalman.h"
+#include "gncpy/filters/IBayesFilter.h"
+#include "gncpy/filters/Kalman.h"
+#include "gncpy/filters/Parameters.h"
+
+namespace lager::gncpy::python {
+
+namespace {
+
+// filters a whole measurement sequence without returning to python, the
+// filter is predicted from the previous time then corrected at each
+// measurement time
+RowMatrixXd runSequence(filters::IBayesFilter& filt, double startTime,
+                        VectorRef initState, VectorRef times, BatchRef meas,
+                        const filters::BayesPredictParams* predParams,
+                        const filters::BayesCorrectParams* corrParams) {
+    if (times.size() != meas.rows()) {
+        throw exceptions::BadParams(
+            "Number of times must match the number of measurements");
+    }
+    RowMatrixXd out(meas.rows(), initState.size());
+    Eigen::VectorXd state = initState;
+    Eigen::VectorXd curMeas(meas.cols());
+    double time = startTime;
+    double measFitProb;
+    for (Eigen::Index ii = 0; ii < meas.rows(); ii++) {
+        state = filt.predict(time, state, std::nullopt, predParams);
+        time = times(ii);
+        curMeas = meas.row(ii).transpose();
+        state = filt.correct(time, curMeas, state, measFitProb, corrParams);
+        out.row(ii) = state.transpose();
+    }
+    return out;
+}
+
+}  // namespace
+
+void bindFilters(py::module_& m) {
+    py::class_<filters::BayesPredictParams,
+               std::shared_ptr<filters::BayesPredictParams>>(
+        m, "BayesPredictParams")
+        .def(py::init<>())
+        .def_readwrite("state_trans_params",
+                       &filters::BayesPredictParams::stateTransParams);
+
+    py::class_<filters::BayesCorrectParams,
+               std::shared_ptr<filters::BayesCorrectParams>>(
+        m, "BayesCorrectParams")
+        .def(py::init<>())
+        .def_readwrite("meas_params",
+                       &filters::BayesCorrectParams::measParams);
+
+    py::class_<filters::IBayesFilter, std::shared_ptr<filters::IBayesFilter>>(
+        m, "IBayesFilter")
+        .def(
+            "predict",
+            [](filters::IBayesFilter& self, double timestep,
+               VectorRef curState, std::optional<Eigen::VectorXd> control,
+               const filters::BayesPredictParams* params) {
+                return self.predict(timestep, curState, std::move(control),
+                                    params);
+            },
+            py::arg("timestep"), py::arg("cur_state"),
+            py::arg("control") = std::nullopt, py::arg("params") = nullptr,
+            py::call_guard<py::gil_scoped_release>())
+        .def(
+            "correct",
+            [](filters::IBayesFilter& self, double timestep, VectorRef meas,
+               VectorRef curState, const filters::BayesCorrectParams* params) {
+                double measFitProb;
+                Eigen::VectorXd out = self.correct(timestep, meas, curState,
+                                                   measFitProb, params);
+                return std::make_pair(std::move(out), measFitProb);
+            },
+            py::arg("timestep"), py::arg("meas"), py::arg("cur_state"),
+            py::arg("params") = nullptr,
+            py::call_guard<py::gil_scoped_release>(),
+            "Returns the corrected state and the measurement fit probability")
+        .def("run", &runSequence, py::arg("start_time"),
+             py::arg("init_state"), py::arg("times"), py::arg("meas"),
+             py::arg("pred_params") = nullptr,
+             py::arg("corr_params") = nullptr,
+             py::call_guard<py::gil_scoped_release>(),
+             "Filter an (N, m) array of measurements, returns the (N, n) "
+             "corrected states")
+        .def("set_state_model", &filters::IBayesFilter::setStateModel,
+             py::arg("dyn_obj"), py::arg("proc_noise"))
+        .def("set_measurement_model",
+             &filters::IBayesFilter::setMeasurementModel, py::arg("meas_obj"),
+             py::arg("meas_noise"))
+        .def_property_readonly("dynamics_model",
+                               &filters::IBayesFilter::dynamicsModel)
+        .def_property_readonly("measurement_model",
+                               &filters::IBayesFilter::measurementModel)
+        // the getter returns a copy, a view would dangle once the filter
+        // resizes its covariance
+        .def_property(
+            "cov",
+            [](filters::IBayesFilter& self) -> Eigen::MatrixXd {
+                return self.viewCov();
+            },
+            [](filters::IBayesFilter& self, const Eigen::MatrixXd& cov) {
+                self.getCov() = cov;
+            });
+
+    py::class_<filters::Kalman, filters::IBayesFilter,
+               std::shared_ptr<filters::Kalman>>(m, "Kalman")
+        .def(py::init<>());
+
+    py::class_<filters::ExtendedKalman, filters::Kalman,
+               std::shared_ptr<filters::ExtendedKalman>>(m, "ExtendedKalman")
+        .def(py::init<>())
+        .def("set_iterations", &filters::ExtendedKalman::setIterations,
+             py::arg("max_iterations"), py::arg("tolerance") = 1e-6,
+             py::arg("jacobian_reuse_tolerance") = 0.0);
+}
+
+}  // namespace lager::gncpy::python
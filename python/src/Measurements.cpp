@@ -0,0 +1,100 @@
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "Bindings.h"
+#include "gncpy/measurements/ILinearMeasModel.h"
+#include "gncpy/measurements/IMeasModel.h"
+#include "gncpy/measurements/INonLinearMeasModel.h"
+#include "gncpy/measurements/Parameters.h"
+#include "gncpy/measurements/RangeAndBearing.h"
+#include "gncpy/measurements/StateObservation.h"
+
+namespace lager::gncpy::python {
+
+namespace {
+
+// measures every row of the batch, the output size comes from the first row
+RowMatrixXd measureBatch(const measurements::IMeasModel& model,
+                         BatchRef states,
+                         const measurements::MeasParams* params) {
+    if (states.rows() == 0) {
+        return RowMatrixXd(0, 0);
+    }
+    Eigen::VectorXd state = states.row(0).transpose();
+    Eigen::VectorXd meas = model.measure(state, params);
+    RowMatrixXd out(states.rows(), meas.size());
+    out.row(0) = meas.transpose();
+    for (Eigen::Index ii = 1; ii < states.rows(); ii++) {
+        state = states.row(ii).transpose();
+        out.row(ii) = model.measure(state, params).transpose();
+    }
+    return out;
+}
+
+}  // namespace
+
+void bindMeasurements(py::module_& m) {
+    py::class_<measurements::MeasParams,
+               std::shared_ptr<measurements::MeasParams>>(m, "MeasParams")
+        .def(py::init<>());
+
+    py::class_<measurements::StateObservationParams, measurements::MeasParams,
+               std::shared_ptr<measurements::StateObservationParams>>(
+        m, "StateObservationParams")
+        .def(py::init<const std::vector<uint8_t>&>(), py::arg("obs_inds"))
+        .def_readwrite("obs_inds",
+                       &measurements::StateObservationParams::obsInds);
+
+    py::class_<measurements::RangeAndBearingParams, measurements::MeasParams,
+               std::shared_ptr<measurements::RangeAndBearingParams>>(
+        m, "RangeAndBearingParams")
+        .def(py::init<uint8_t, uint8_t>(), py::arg("x_ind"), py::arg("y_ind"))
+        .def_readwrite("x_ind", &measurements::RangeAndBearingParams::xInd)
+        .def_readwrite("y_ind", &measurements::RangeAndBearingParams::yInd);
+
+    py::class_<measurements::IMeasModel,
+               std::shared_ptr<measurements::IMeasModel>>(m, "IMeasModel")
+        .def(
+            "measure",
+            [](const measurements::IMeasModel& self, VectorRef state,
+               const measurements::MeasParams* params) {
+                return self.measure(state, params);
+            },
+            py::arg("state"), py::arg("params") = nullptr,
+            py::call_guard<py::gil_scoped_release>())
+        .def(
+            "get_meas_mat",
+            [](const measurements::IMeasModel& self, VectorRef state,
+               const measurements::MeasParams* params) {
+                return self.getMeasMat(state, params);
+            },
+            py::arg("state"), py::arg("params") = nullptr,
+            py::call_guard<py::gil_scoped_release>())
+        .def("measure_batch", &measureBatch, py::arg("states"),
+             py::arg("params") = nullptr,
+             py::call_guard<py::gil_scoped_release>(),
+             "Measure an (N, n) array of states, one per row");
+
+    py::class_<measurements::ILinearMeasModel, measurements::IMeasModel,
+               std::shared_ptr<measurements::ILinearMeasModel>>(
+        m, "ILinearMeasModel");
+
+    py::class_<measurements::INonLinearMeasModel, measurements::IMeasModel,
+               std::shared_ptr<measurements::INonLinearMeasModel>>(
+        m, "INonLinearMeasModel");
+
+    py::class_<measurements::StateObservation,
+               measurements::ILinearMeasModel,
+               std::shared_ptr<measurements::StateObservation>>(
+        m, "StateObservation")
+        .def(py::init<>());
+
+    py::class_<measurements::RangeAndBearing,
+               measurements::INonLinearMeasModel,
+               std::shared_ptr<measurements::RangeAndBearing>>(
+        m, "RangeAndBearing")
+        .def(py::init<>());
+}
+
+}  // namespace lager::gncpy::python
@@ -0,0 +1,26 @@
+#include "Bindings.h"
+
+#include "gncpy/Exceptions.h"
+
+namespace py = pybind11;
+
+PYBIND11_MODULE(gncpp, m) {
+    m.doc() = "C++ core of gncpy";
+    m.attr("__version__") = GNCPY_VERSION_STR;
+
+    py::register_exception<lager::gncpy::exceptions::BadParams>(
+        m, "BadParams", PyExc_ValueError);
+    py::register_exception<lager::gncpy::exceptions::TypeError>(
+        m, "TypeError", PyExc_TypeError);
+    py::register_exception<lager::gncpy::exceptions::IOError>(m, "IOError",
+                                                              PyExc_OSError);
+
+    auto dynamics = m.def_submodule("dynamics", "Dynamics models");
+    lager::gncpy::python::bindDynamics(dynamics);
+
+    auto measurements = m.def_submodule("measurements", "Measurement models");
+    lager::gncpy::python::bindMeasurements(measurements);
+
+    auto filters = m.def_submodule("filters", "Filter implementations");
+    lager::gncpy::python::bindFilters(filters);
+}
@@ -0,0 +1,52 @@
+"""Smoke test of the gncpp extension module.
+
+Runs under pytest or directly with the interpreter, ctest runs it directly
+with the built module on the python path.
+"""
+import numpy as np
+
+import gncpp
+
+
+def test_propagate_batch():
+    dyn = gncpp.dynamics.DoubleIntegrator(0.5)
+    states = np.arange(12, dtype=np.float64).reshape(3, 4)
+
+    out = dyn.propagate_batch(0.0, states)
+
+    assert out.shape == states.shape
+    for row, state in zip(out, states):
+        np.testing.assert_allclose(row, dyn.propagate_state(0.0, state))
+    np.testing.assert_allclose(out[:, :2], states[:, :2] + 0.5 * states[:, 2:])
+
+
+def test_kalman_predict_correct():
+    filt = gncpp.filters.Kalman()
+    filt.set_state_model(gncpp.dynamics.DoubleIntegrator(0.5),
+                         0.01 * np.eye(4))
+    filt.set_measurement_model(gncpp.measurements.StateObservation(),
+                               0.1 * np.eye(2))
+    filt.cov = np.eye(4)
+    # the property is a copy, writing to it does not change the filter
+    filt.cov[0, 0] = 5.0
+    np.testing.assert_allclose(filt.cov, np.eye(4))
+
+    corr_params = gncpp.filters.BayesCorrectParams()
+    corr_params.meas_params = gncpp.measurements.StateObservationParams([0, 1])
+
+    state = filt.predict(0.0, np.array([0.0, 0.0, 1.0, -1.0]))
+    np.testing.assert_allclose(state, [0.5, -0.5, 1.0, -1.0])
+
+    meas = np.array([0.6, -0.4])
+    state, meas_fit_prob = filt.correct(0.5, meas, state, corr_params)
+    assert state.shape == (4,)
+    assert np.all(np.isfinite(state))
+    assert meas_fit_prob > 0.0
+    # the corrected position moves toward the measurement
+    assert abs(state[0] - meas[0]) < 0.1
+    assert abs(state[1] - meas[1]) < 0.1
+
+
+if __name__ == "__main__":
+    test_propagate_batch()
+    test_kalman_predict_correct()
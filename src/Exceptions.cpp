@@ -7,4 +7,10 @@ BadParams::BadParams(char const* const message) noexcept
 
 TypeError::TypeError(char const* const message) noexcept
     : std::runtime_error(message) {}
+
+IOError::IOError(char const* const message) noexcept
+    : std::runtime_error(message) {}
+
+NotImplemented::NotImplemented(char const* const message) noexcept
+    : std::runtime_error(message) {}
 }  // namespace lager::gncpy::exceptions
@@ -1,7 +1,6 @@
 #include "gncpy/control/StateControl.h"
 
 #include "gncpy/Exceptions.h"
-#include "gncpy/Utilities.h"
 
 namespace lager::gncpy::control {
 
@@ -11,11 +10,11 @@ Eigen::MatrixXd StateControl::getInputMat([[maybe_unused]] double timestep,
     if (!params) {
         throw exceptions::BadParams("State Control requires parameters");
     }
-    if (!utilities::instanceof <StateControlParams>(params)) {
+    auto ptr = dynamic_cast<const StateControlParams*>(params);
+    if (!ptr) {
         throw exceptions::BadParams(
             "params type must be StateControlParams.");
     }
-    auto ptr = dynamic_cast<const StateControlParams*>(params);
     Eigen::MatrixXd data(m_stateDim, m_contDim);
 
     data.fill(0.0);
@@ -0,0 +1,26 @@
+#pragma once
+#include <Eigen/Dense>
+#include <cmath>
+
+// shared by the batch propagators, not part of the installed headers
+namespace lager::gncpy::dynamics::detail {
+
+// objects propagated together, the temporaries live on the stack
+constexpr Eigen::Index BATCH_BLOCK = 128;
+
+using Batch =
+    Eigen::Array<double, Eigen::Dynamic, 6, Eigen::ColMajor, BATCH_BLOCK, 6>;
+using BatchCol =
+    Eigen::Array<double, Eigen::Dynamic, 1, Eigen::ColMajor, BATCH_BLOCK, 1>;
+
+// 1 - cos is written with a half angle sine to avoid cancellation
+inline double oneMinusCos(double angle) {
+    const double halfSin = std::sin(0.5 * angle);
+    return 2.0 * halfSin * halfSin;
+}
+
+inline BatchCol oneMinusCos(const BatchCol& angle) {
+    return 2.0 * (0.5 * angle).sin().square();
+}
+
+}  // namespace lager::gncpy::dynamics::detail
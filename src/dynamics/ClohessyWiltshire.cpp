@@ -1,7 +1,17 @@
 #include "gncpy/dynamics/ClohessyWiltshire.h"
 
+#include <algorithm>
+
+#include "BatchDetail.h"
+#include "gncpy/Exceptions.h"
+#include "gncpy/utilities/Trace.h"
+
 namespace lager::gncpy::dynamics {
 
+using detail::Batch;
+using detail::BATCH_BLOCK;
+using detail::BatchCol;
+
 Eigen::MatrixXd ClohessyWiltshire::getStateMat(
     [[maybe_unused]] double timestep,
     [[maybe_unused]] const StateTransParams* const stateTransParams) const {
@@ -40,4 +50,55 @@ Eigen::MatrixXd ClohessyWiltshire::getStateMat(
     return F;
 }
 
-}
\ No newline at end of file
+void ClohessyWiltshire::propagateBatch(
+    double timestep, Eigen::Ref<Eigen::MatrixXd> states) const {
+    propagateBatch(timestep, states,
+                   Eigen::VectorXd::Constant(states.rows(), m_dt));
+}
+
+void ClohessyWiltshire::propagateBatch(
+    double timestep, Eigen::Ref<Eigen::MatrixXd> states,
+    const Eigen::Ref<const Eigen::VectorXd>& dts) const {
+    GNCPY_TRACE_SCOPE("ClohessyWiltshire::propagateBatch");
+    if (states.cols() != 6) {
+        throw exceptions::BadParams(
+            "Batch must hold one 6 element state per row");
+    }
+    if (dts.size() != states.rows()) {
+        throw exceptions::BadParams("Batch needs one time step per deputy");
+    }
+    const double n = m_mean_motion;
+
+    Batch s;
+    Batch out;
+    for (Eigen::Index start = 0; start < states.rows(); start += BATCH_BLOCK) {
+        const Eigen::Index num = std::min(BATCH_BLOCK, states.rows() - start);
+        auto block = states.middleRows(start, num);
+        s = block.array();
+
+        const BatchCol nt = n * dts.segment(start, num).array();
+        const BatchCol sinT = nt.sin();
+        const BatchCol cosT = nt.cos();
+        const BatchCol oneMinusCos = detail::oneMinusCos(nt);
+
+        const auto x = s.col(0);
+        const auto vx = s.col(3);
+        const auto vy = s.col(4);
+        out.resize(num, 6);
+        out.col(0) = (1.0 + 3.0 * oneMinusCos) * x + sinT / n * vx +
+                     2.0 / n * oneMinusCos * vy;
+        out.col(1) = 6.0 * (sinT - nt) * x + s.col(1) -
+                     2.0 / n * oneMinusCos * vx +
+                     (4.0 * sinT - 3.0 * nt) / n * vy;
+        out.col(2) = cosT * s.col(2) + sinT / n * s.col(5);
+        out.col(3) = 3.0 * n * sinT * x + cosT * vx + 2.0 * sinT * vy;
+        out.col(4) = -6.0 * n * oneMinusCos * x - 2.0 * sinT * vx +
+                     (4.0 * cosT - 3.0) * vy;
+        out.col(5) = -n * sinT * s.col(2) + cosT * s.col(5);
+        block = out.matrix();
+    }
+
+    applyStateConstraintRows(timestep, states);
+}
+
+}  // namespace lager::gncpy::dynamics
@@ -0,0 +1,118 @@
+#include "gncpy/dynamics/CoordinatedTurn.h"
+
+#include <cmath>
+
+#include "BatchDetail.h"
+#include "gncpy/Exceptions.h"
+#include "gncpy/utilities/Trace.h"
+
+namespace lager::gncpy::dynamics {
+
+namespace {
+
+// turn angles below this use the series expansions
+constexpr double SMALL_ANGLE = 1e-2;
+
+// sin(wT) / w, (1 - cos(wT)) / w, and their derivatives with respect to w
+struct TurnTerms {
+    double sinT;
+    double cosT;
+    double a;
+    double b;
+    double da;
+    double db;
+};
+
+TurnTerms turnTerms(double omega, double dt) {
+    const double theta = omega * dt;
+    TurnTerms out;
+    out.sinT = std::sin(theta);
+    out.cosT = std::cos(theta);
+    if (std::abs(theta) < SMALL_ANGLE) {
+        const double th2 = theta * theta;
+        out.a = dt * (1.0 - th2 / 6.0 * (1.0 - th2 / 20.0));
+        out.b = dt * theta * (0.5 - th2 / 24.0 * (1.0 - th2 / 30.0));
+        out.da = dt * dt * theta * (-1.0 / 3.0 + th2 / 30.0);
+        out.db = dt * dt * (0.5 - th2 / 8.0 * (1.0 - th2 / 18.0));
+    } else {
+        const double oneMinusCos = detail::oneMinusCos(theta);
+        const double omega2 = omega * omega;
+        out.a = out.sinT / omega;
+        out.b = oneMinusCos / omega;
+        out.da = (theta * out.cosT - out.sinT) / omega2;
+        out.db = (theta * out.sinT - oneMinusCos) / omega2;
+    }
+    return out;
+}
+
+void checkSize(const Eigen::VectorXd& state) {
+    if (state.size() != 5) {
+        throw exceptions::BadParams(
+            "Coordinated turn state must be [x, y, vx, vy, omega]");
+    }
+}
+
+}  // namespace
+
+Eigen::VectorXd CoordinatedTurn::continuousDynamics(
+    [[maybe_unused]] double timestep, const Eigen::VectorXd& state,
+    [[maybe_unused]] const StateTransParams* stateTransParams) const {
+    checkSize(state);
+    Eigen::VectorXd out(5);
+    out << state(2), state(3), -state(4) * state(3), state(4) * state(2), 0.0;
+    return out;
+}
+
+Eigen::VectorXd CoordinatedTurn::propagateState(
+    double timestep, const Eigen::VectorXd& state,
+    [[maybe_unused]] const StateTransParams* stateTransParams) const {
+    GNCPY_TRACE_SCOPE("CoordinatedTurn::propagateState");
+    checkSize(state);
+    const TurnTerms tt = turnTerms(state(4), dt());
+    const double vx = state(2);
+    const double vy = state(3);
+
+    Eigen::VectorXd nextState(5);
+    nextState << state(0) + tt.a * vx - tt.b * vy,
+        state(1) + tt.b * vx + tt.a * vy, tt.cosT * vx - tt.sinT * vy,
+        tt.sinT * vx + tt.cosT * vy, state(4);
+
+    if (hasStateConstraint()) {
+        stateConstraint(timestep, nextState);
+    }
+    return nextState;
+}
+
+std::optional<Eigen::MatrixXd> CoordinatedTurn::analyticStateMat(
+    [[maybe_unused]] double timestep, const Eigen::VectorXd& state,
+    [[maybe_unused]] const StateTransParams* stateTransParams) const {
+    checkSize(state);
+    Eigen::MatrixXd out = Eigen::MatrixXd::Zero(5, 5);
+    out(0, 2) = 1.0;
+    out(1, 3) = 1.0;
+    out(2, 3) = -state(4);
+    out(2, 4) = -state(3);
+    out(3, 2) = state(4);
+    out(3, 4) = state(2);
+    return out;
+}
+
+std::optional<Eigen::MatrixXd> CoordinatedTurn::analyticDiscreteStateMat(
+    [[maybe_unused]] double timestep, const Eigen::VectorXd& state,
+    [[maybe_unused]] const StateTransParams* stateTransParams) const {
+    checkSize(state);
+    const double T = dt();
+    const TurnTerms tt = turnTerms(state(4), T);
+    const double vx = state(2);
+    const double vy = state(3);
+
+    Eigen::MatrixXd out(5, 5);
+    out << 1.0, 0.0, tt.a, -tt.b, tt.da * vx - tt.db * vy,  //
+        0.0, 1.0, tt.b, tt.a, tt.db * vx + tt.da * vy,      //
+        0.0, 0.0, tt.cosT, -tt.sinT, -T * (tt.sinT * vx + tt.cosT * vy),
+        0.0, 0.0, tt.sinT, tt.cosT, T * (tt.cosT * vx - tt.sinT * vy),  //
+        0.0, 0.0, 0.0, 0.0, 1.0;
+    return out;
+}
+
+}  // namespace lager::gncpy::dynamics
@@ -23,6 +23,17 @@ Eigen::VectorXd CurvilinearMotion::continuousDynamics(
     return out;
 }
 
+std::optional<Eigen::MatrixXd> CurvilinearMotion::analyticStateMat(
+    [[maybe_unused]] double timestep, const Eigen::VectorXd& state,
+    [[maybe_unused]] const StateTransParams* stateTransParams) const {
+    Eigen::MatrixXd out = Eigen::MatrixXd::Zero(4, 4);
+    out(0, 2) = cos(state(3));
+    out(0, 3) = -state(2) * sin(state(3));
+    out(1, 2) = sin(state(3));
+    out(1, 3) = state(2) * cos(state(3));
+    return out;
+}
+
 void CurvilinearMotion::clearControlModel() {
     std::cerr << "Warning, disabling control model and it can not be "
                  "re-enabled for this curvilinear motion model!"
@@ -11,4 +11,17 @@ void IDynamics::stateConstraint(
     throw NoStateConstraintError();
 }
 
+void IDynamics::applyStateConstraintRows(
+    double timestep, Eigen::Ref<Eigen::MatrixXd> states) const {
+    if (!m_hasStateConstraint) {
+        return;
+    }
+    Eigen::VectorXd state(states.cols());
+    for (Eigen::Index ii = 0; ii < states.rows(); ii++) {
+        state = states.row(ii).transpose();
+        stateConstraint(timestep, state);
+        states.row(ii) = state.transpose();
+    }
+}
+
 }  // namespace lager::gncpy::dynamics
@@ -1,5 +1,8 @@
 #include "gncpy/dynamics/ILinearDynamics.h"
 
+#include "gncpy/utilities/Allocation.h"
+#include "gncpy/utilities/Trace.h"
+
 namespace lager::gncpy::dynamics {
 
 void ILinearDynamics::setControlModel(std::shared_ptr<control::ILinearControlModel> model) {
@@ -9,6 +12,8 @@ void ILinearDynamics::setControlModel(std::shared_ptr<control::ILinearControlMod
 Eigen::VectorXd ILinearDynamics::propagateState(
     double timestep, const Eigen::VectorXd& state,
     const StateTransParams* stateTransParams) const {
+    GNCPY_ALLOC_SCOPE("ILinearDynamics::propagateState");
+    GNCPY_TRACE_SCOPE("ILinearDynamics::propagateState");
     Eigen::VectorXd nextState =
         propagateState_(timestep, state, stateTransParams);
 
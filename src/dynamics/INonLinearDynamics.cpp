@@ -1,7 +1,13 @@
 #include "gncpy/dynamics/INonLinearDynamics.h"
 
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
 #include "gncpy/Exceptions.h"
 #include "gncpy/math/Math.h"
+#include "gncpy/utilities/Allocation.h"
+#include "gncpy/utilities/Trace.h"
 
 namespace lager::gncpy::dynamics {
 
@@ -18,6 +24,8 @@ void INonLinearDynamics::setControlModel
 Eigen::VectorXd INonLinearDynamics::propagateState(
     double timestep, const Eigen::VectorXd& state,
     const StateTransParams* stateTransParams) const {
+    GNCPY_ALLOC_SCOPE("INonLinearDynamics::propagateState");
+    GNCPY_TRACE_SCOPE("INonLinearDynamics::propagateState");
     Eigen::VectorXd nextState =
         math::rungeKutta4<Eigen::VectorXd, Eigen::VectorXd, double>(
             timestep, state, dt(),
@@ -103,6 +111,78 @@ Eigen::VectorXd INonLinearDynamics::propagateState(
 }
 
 Eigen::MatrixXd INonLinearDynamics::getStateMat(
+    double timestep, const Eigen::VectorXd& state,
+    const StateTransParams* stateTransParams) const {
+    GNCPY_TRACE_SCOPE("INonLinearDynamics::getStateMat");
+    std::optional<Eigen::MatrixXd> discrete =
+        analyticDiscreteStateMat(timestep, state, stateTransParams);
+    if (!discrete) {
+        return getNumericalDiscreteStateMat(timestep, state, stateTransParams);
+    }
+#ifdef GNCPY_CHECK_JACOBIANS
+    math::checkJacobian(
+        *discrete,
+        getNumericalDiscreteStateMat(timestep, state, stateTransParams),
+        "discrete dynamics");
+#endif
+    return std::move(*discrete);
+}
+
+Eigen::MatrixXd INonLinearDynamics::getContinuousStateMat(
+    double timestep, const Eigen::VectorXd& state,
+    const StateTransParams* stateTransParams) const {
+    std::optional<Eigen::MatrixXd> analytic =
+        analyticStateMat(timestep, state, stateTransParams);
+    if (!analytic) {
+        return getNumericalStateMat(timestep, state, stateTransParams);
+    }
+#ifdef GNCPY_CHECK_JACOBIANS
+    math::checkJacobian(
+        *analytic, getNumericalStateMat(timestep, state, stateTransParams),
+        "continuous dynamics");
+#endif
+    return std::move(*analytic);
+}
+
+std::optional<Eigen::MatrixXd> INonLinearDynamics::analyticDiscreteStateMat(
+    double timestep, const Eigen::VectorXd& state,
+    const StateTransParams* stateTransParams) const {
+    // the constraint applied after the step has no Jacobian
+    if (hasStateConstraint()) {
+        return std::nullopt;
+    }
+    std::optional<Eigen::MatrixXd> dK0 =
+        analyticStateMat(timestep, state, stateTransParams);
+    if (!dK0) {
+        return std::nullopt;
+    }
+    GNCPY_TRACE_SCOPE("INonLinearDynamics::analyticDiscreteStateMat");
+    const double h = dt();
+    const double tHalf = timestep + 0.5 * h;
+
+    // same stages as math::rungeKutta4, a model with a closed form has it at
+    // every state
+    auto stage = [this, stateTransParams](double t, const Eigen::VectorXd& x) {
+        return *analyticStateMat(t, x, stateTransParams);
+    };
+    const Eigen::MatrixXd eye =
+        Eigen::MatrixXd::Identity(state.size(), state.size());
+    const Eigen::VectorXd k0 =
+        continuousDynamics(timestep, state, stateTransParams);
+    const Eigen::VectorXd x1 = state + 0.5 * h * k0;
+    const Eigen::VectorXd k1 = continuousDynamics(tHalf, x1, stateTransParams);
+    const Eigen::MatrixXd dK1 = stage(tHalf, x1) * (eye + 0.5 * h * *dK0);
+    const Eigen::VectorXd x2 = state + 0.5 * h * k1;
+    const Eigen::VectorXd k2 = continuousDynamics(tHalf, x2, stateTransParams);
+    const Eigen::MatrixXd dK2 = stage(tHalf, x2) * (eye + 0.5 * h * dK1);
+    const Eigen::MatrixXd dK3 =
+        stage(timestep + h, state + h * k2) * (eye + h * dK2);
+
+    return Eigen::MatrixXd(eye +
+                           h / 6.0 * (*dK0 + 2.0 * (dK1 + dK2) + dK3));
+}
+
+Eigen::MatrixXd INonLinearDynamics::getNumericalStateMat(
     double timestep, const Eigen::VectorXd& state,
     const StateTransParams* stateTransParams) const {
     return math::getJacobian(
@@ -113,4 +193,25 @@ Eigen::MatrixXd INonLinearDynamics::getStateMat(
         state.size());
 }
 
+Eigen::MatrixXd INonLinearDynamics::getNumericalDiscreteStateMat(
+    double timestep, const Eigen::VectorXd& state,
+    const StateTransParams* stateTransParams) const {
+    GNCPY_TRACE_SCOPE("INonLinearDynamics::getNumericalDiscreteStateMat");
+    // central differences one column at a time, two propagations per state
+    // element, with the step scaled to the element
+    Eigen::MatrixXd out(state.size(), state.size());
+    Eigen::VectorXd x(state);
+    for (Eigen::Index c = 0; c < state.size(); c++) {
+        const double step = 1e-7 * std::max(1.0, std::abs(state(c)));
+        x(c) = state(c) + step;
+        const Eigen::VectorXd plus =
+            propagateState(timestep, x, stateTransParams);
+        x(c) = state(c) - step;
+        out.col(c) = (plus - propagateState(timestep, x, stateTransParams)) /
+                     (2.0 * step);
+        x(c) = state(c);
+    }
+    return out;
+}
+
 }  // namespace lager::gncpy::dynamics
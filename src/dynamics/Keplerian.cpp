@@ -0,0 +1,358 @@
+#include "gncpy/dynamics/Keplerian.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "BatchDetail.h"
+#include "gncpy/Exceptions.h"
+#include "gncpy/utilities/Trace.h"
+
+namespace lager::gncpy::dynamics {
+
+using detail::Batch;
+using detail::BATCH_BLOCK;
+using detail::BatchCol;
+
+namespace {
+
+// Halley converges cubically, this is only reached near e = 1
+constexpr int MAX_ITER = 20;
+constexpr double ANGLE_TOL = 1e-14;
+
+// splits an angle into whole revolutions and a remainder in [-pi, pi)
+template <class Arr>
+Arr reduceAngle(const Arr& angle, Arr& revs) {
+    revs = ((angle + M_PI) / (2.0 * M_PI)).floor();
+    return angle - 2.0 * M_PI * revs;
+}
+
+// Solves x - alpha sin(x) + beta (1 - cos(x)) = mean for x, which is Kepler's
+// equation for the change in eccentric anomaly from E0 with
+// alpha = e cos(E0) and beta = e sin(E0). The mean anomaly must already be
+// reduced to [-pi, pi), so the result is the reduced x and callers evaluate
+// its sine and cosine without losing precision over long gaps.
+template <class Arr>
+Arr solveGeneralized(const Arr& reduced, const Arr& alpha, const Arr& beta) {
+    // starting guess of Danby, shifted by E0
+    const Arr ecc = (alpha.square() + beta.square()).sqrt();
+    const Arr startAnom = beta.binaryExpr(
+        alpha, [](double b, double a) { return std::atan2(b, a); });
+    const Arr stdMean = reduced + startAnom - beta;
+    Arr x = reduced - beta + 0.85 * ecc * stdMean.sin().sign();
+
+    // converged objects are frozen so each result does not depend on the
+    // other objects in the batch
+    Arr active = Arr::Ones(x.size());
+    for (int iter = 0; iter < MAX_ITER && (active > 0.0).any(); iter++) {
+        const Arr sinX = x.sin();
+        const Arr cosX = x.cos();
+        const Arr f = x - alpha * sinX + beta * (1.0 - cosX) - reduced;
+        const Arr df = 1.0 - alpha * cosX + beta * sinX;
+        const Arr ddf = alpha * sinX + beta * cosX;
+        const Arr step = 2.0 * f * df / (2.0 * df.square() - f * ddf);
+        x -= active * step;
+        active = (step.abs() > ANGLE_TOL).select(active, 0.0);
+    }
+    if ((active > 0.0).any()) {
+        throw exceptions::BadParams("Kepler's equation did not converge");
+    }
+    return x;
+}
+
+void checkSize(const Eigen::VectorXd& state) {
+    if (state.size() != 6) {
+        throw exceptions::BadParams(
+            "Keplerian state must be [x, y, z, vx, vy, vz]");
+    }
+}
+
+// wraps an angle to [0, 2 pi)
+double wrapAngle(double ang) {
+    const double out = std::fmod(ang, 2.0 * M_PI);
+    return out < 0.0 ? out + 2.0 * M_PI : out;
+}
+
+}  // namespace
+
+OrbitalElements cartesianToElements(const Eigen::VectorXd& state, double mu) {
+    checkSize(state);
+    // circular and equatorial orbits fall back to the conventions in
+    // OrbitalElements below this
+    constexpr double SMALL = 1e-11;
+
+    const Eigen::Vector3d pos = state.head<3>();
+    const Eigen::Vector3d vel = state.tail<3>();
+    const double r = pos.norm();
+    const Eigen::Vector3d h = pos.cross(vel);
+    const Eigen::Vector3d hHat = h.normalized();
+    const Eigen::Vector3d ecc =
+        ((vel.squaredNorm() - mu / r) * pos - pos.dot(vel) * vel) / mu;
+
+    OrbitalElements out;
+    out.semiMajorAxis = 1.0 / (2.0 / r - vel.squaredNorm() / mu);
+    out.eccentricity = ecc.norm();
+    out.inclination = std::acos(std::clamp(hHat(2), -1.0, 1.0));
+
+    // in plane axes, p points at the ascending node
+    Eigen::Vector3d p(1.0, 0.0, 0.0);
+    if (std::hypot(hHat(0), hHat(1)) > SMALL) {
+        out.raan = wrapAngle(std::atan2(h(0), -h(1)));
+        p << std::cos(out.raan), std::sin(out.raan), 0.0;
+    }
+    const Eigen::Vector3d q = hHat.cross(p);
+
+    const double argLat = std::atan2(pos.dot(q), pos.dot(p));
+    if (out.eccentricity > SMALL) {
+        out.argPeriapsis = wrapAngle(std::atan2(ecc.dot(q), ecc.dot(p)));
+    }
+    out.trueAnomaly = wrapAngle(argLat - out.argPeriapsis);
+    return out;
+}
+
+Eigen::VectorXd elementsToCartesian(const OrbitalElements& elements,
+                                    double mu) {
+    const double e = elements.eccentricity;
+    const double nu = elements.trueAnomaly;
+    const double semiLatus = elements.semiMajorAxis * (1.0 - e * e);
+    const double r = semiLatus / (1.0 + e * std::cos(nu));
+    const double velScale = std::sqrt(mu / semiLatus);
+
+    const Eigen::Vector3d posPqw(r * std::cos(nu), r * std::sin(nu), 0.0);
+    const Eigen::Vector3d velPqw(-velScale * std::sin(nu),
+                                 velScale * (e + std::cos(nu)), 0.0);
+    const Eigen::Matrix3d rot =
+        (Eigen::AngleAxisd(elements.raan, Eigen::Vector3d::UnitZ()) *
+         Eigen::AngleAxisd(elements.inclination, Eigen::Vector3d::UnitX()) *
+         Eigen::AngleAxisd(elements.argPeriapsis, Eigen::Vector3d::UnitZ()))
+            .toRotationMatrix();
+
+    Eigen::VectorXd out(6);
+    out << rot * posPqw, rot * velPqw;
+    return out;
+}
+
+Eigen::ArrayXd solveKepler(const Eigen::ArrayXd& meanAnomaly,
+                           const Eigen::ArrayXd& eccentricity) {
+    if (meanAnomaly.size() != eccentricity.size()) {
+        throw exceptions::BadParams(
+            "Mean anomalies and eccentricities must have the same size");
+    }
+    if ((eccentricity < 0.0).any() || (eccentricity >= 1.0).any()) {
+        throw exceptions::BadParams("Eccentricity must be in [0, 1)");
+    }
+    Eigen::ArrayXd revs;
+    const Eigen::ArrayXd reduced = reduceAngle(meanAnomaly, revs);
+    return solveGeneralized<Eigen::ArrayXd>(
+               reduced, eccentricity,
+               Eigen::ArrayXd::Zero(meanAnomaly.size())) +
+           2.0 * M_PI * revs;
+}
+
+double solveKepler(double meanAnomaly, double eccentricity) {
+    return solveKepler(Eigen::ArrayXd::Constant(1, meanAnomaly),
+                       Eigen::ArrayXd::Constant(1, eccentricity))(0);
+}
+
+Keplerian::Keplerian(double dt, double mu) : m_mu(mu) { setDt(dt); }
+
+Eigen::VectorXd Keplerian::continuousDynamics(
+    [[maybe_unused]] double timestep, const Eigen::VectorXd& state,
+    [[maybe_unused]] const StateTransParams* stateTransParams) const {
+    checkSize(state);
+    const double r = state.head<3>().norm();
+    Eigen::VectorXd out(6);
+    out << state.tail<3>(), -m_mu / (r * r * r) * state.head<3>();
+    return out;
+}
+
+Eigen::VectorXd Keplerian::propagateState(
+    double timestep, const Eigen::VectorXd& state,
+    [[maybe_unused]] const StateTransParams* stateTransParams) const {
+    GNCPY_TRACE_SCOPE("Keplerian::propagateState");
+    checkSize(state);
+    Eigen::MatrixXd batch = state.transpose();
+    propagateBatch(timestep, batch);
+    return batch.transpose();
+}
+
+void Keplerian::propagateBatch(double timestep,
+                               Eigen::Ref<Eigen::MatrixXd> states) const {
+    propagateBatch(timestep, states,
+                   Eigen::VectorXd::Constant(states.rows(), dt()));
+}
+
+void Keplerian::propagateBatch(
+    double timestep, Eigen::Ref<Eigen::MatrixXd> states,
+    const Eigen::Ref<const Eigen::VectorXd>& dts) const {
+    GNCPY_TRACE_SCOPE("Keplerian::propagateBatch");
+    if (states.cols() != 6) {
+        throw exceptions::BadParams(
+            "Batch must hold one 6 element state per row");
+    }
+    if (dts.size() != states.rows()) {
+        throw exceptions::BadParams("Batch needs one time step per object");
+    }
+    const double sqrtMu = std::sqrt(m_mu);
+
+    Batch s;
+    Batch out;
+    BatchCol revs;
+    for (Eigen::Index start = 0; start < states.rows(); start += BATCH_BLOCK) {
+        const Eigen::Index n = std::min(BATCH_BLOCK, states.rows() - start);
+        auto block = states.middleRows(start, n);
+        s = block.array();
+        const BatchCol step = dts.segment(start, n).array();
+
+        const BatchCol r0 =
+            (s.col(0).square() + s.col(1).square() + s.col(2).square())
+                .sqrt();
+        const BatchCol rv = s.col(0) * s.col(3) + s.col(1) * s.col(4) +
+                            s.col(2) * s.col(5);
+        const BatchCol a =
+            (2.0 / r0 - (s.col(3).square() + s.col(4).square() +
+                         s.col(5).square()) /
+                            m_mu)
+                .inverse();
+        // a parabolic state divides by zero and gives a = +inf
+        if (!(a > 0.0).all() || !a.isFinite().all()) {
+            throw exceptions::BadParams(
+                "Keplerian propagation requires elliptic orbits");
+        }
+        const BatchCol sqrtA = a.sqrt();
+        const BatchCol meanMotion = sqrtMu / (a * sqrtA);
+        const BatchCol alpha = 1.0 - r0 / a;
+        const BatchCol beta = rv / (sqrtMu * sqrtA);
+
+        // only the sine and cosine of x are used, so whole revolutions are
+        // dropped
+        const BatchCol x = solveGeneralized<BatchCol>(
+            reduceAngle<BatchCol>(meanMotion * step, revs), alpha, beta);
+        const BatchCol sinX = x.sin();
+        const BatchCol oneMinusCos = detail::oneMinusCos(x);
+        const BatchCol r =
+            a * (1.0 - alpha + alpha * oneMinusCos + beta * sinX);
+
+        // Lagrange coefficients, g uses Kepler's equation to avoid the
+        // cancellation of dt - (x - sin x) / n over long steps
+        const BatchCol f = 1.0 - a / r0 * oneMinusCos;
+        const BatchCol g =
+            (r0 / a * sinX + beta * oneMinusCos) / meanMotion;
+        const BatchCol fDot = -sqrtMu * sqrtA * sinX / (r * r0);
+        const BatchCol gDot = 1.0 - a / r * oneMinusCos;
+
+        out.resize(n, 6);
+        for (int ii = 0; ii < 3; ii++) {
+            out.col(ii) = f * s.col(ii) + g * s.col(ii + 3);
+            out.col(ii + 3) = fDot * s.col(ii) + gDot * s.col(ii + 3);
+        }
+        block = out.matrix();
+    }
+
+    applyStateConstraintRows(timestep, states);
+}
+
+std::optional<Eigen::MatrixXd> Keplerian::analyticStateMat(
+    [[maybe_unused]] double timestep, const Eigen::VectorXd& state,
+    [[maybe_unused]] const StateTransParams* stateTransParams) const {
+    checkSize(state);
+    const Eigen::Vector3d pos = state.head<3>();
+    const double invR2 = 1.0 / pos.squaredNorm();
+    const double invR3 = invR2 * std::sqrt(invR2);
+
+    Eigen::MatrixXd out = Eigen::MatrixXd::Zero(6, 6);
+    out.topRightCorner<3, 3>().setIdentity();
+    out.bottomLeftCorner<3, 3>() =
+        m_mu * invR3 *
+        (3.0 * invR2 * pos * pos.transpose() - Eigen::Matrix3d::Identity());
+    return out;
+}
+
+std::optional<Eigen::MatrixXd> Keplerian::analyticDiscreteStateMat(
+    [[maybe_unused]] double timestep, const Eigen::VectorXd& state,
+    [[maybe_unused]] const StateTransParams* stateTransParams) const {
+    GNCPY_TRACE_SCOPE("Keplerian::analyticDiscreteStateMat");
+    checkSize(state);
+    using Grad = Eigen::Matrix<double, 1, 6>;
+    const Eigen::Vector3d pos = state.head<3>();
+    const Eigen::Vector3d vel = state.tail<3>();
+    const double sqrtMu = std::sqrt(m_mu);
+    const double step = dt();
+
+    // the same scalars as propagateBatch, each with its gradient with
+    // respect to the initial state
+    const double r0 = pos.norm();
+    const double rv = pos.dot(vel);
+    const double a = 1.0 / (2.0 / r0 - vel.squaredNorm() / m_mu);
+    if (!(a > 0.0) || !std::isfinite(a)) {
+        throw exceptions::BadParams(
+            "Keplerian propagation requires elliptic orbits");
+    }
+    const double sqrtA = std::sqrt(a);
+    const double meanMotion = sqrtMu / (a * sqrtA);
+    const double alpha = 1.0 - r0 / a;
+    const double beta = rv / (sqrtMu * sqrtA);
+
+    Grad dR0;
+    dR0 << pos.transpose() / r0, 0.0, 0.0, 0.0;
+    Grad dRv;
+    dRv << vel.transpose(), pos.transpose();
+    Grad dV2;
+    dV2 << 0.0, 0.0, 0.0, 2.0 * vel.transpose();
+    const Grad dA = a * a * (2.0 / (r0 * r0) * dR0 + dV2 / m_mu);
+    const Grad dMeanMotion = -1.5 * meanMotion / a * dA;
+    const Grad dAlpha = -dR0 / a + r0 / (a * a) * dA;
+    const Grad dBeta = dRv / (sqrtMu * sqrtA) - 0.5 * beta / a * dA;
+
+    Eigen::ArrayXd revs;
+    const double x = solveGeneralized<Eigen::ArrayXd>(
+        reduceAngle<Eigen::ArrayXd>(
+            Eigen::ArrayXd::Constant(1, meanMotion * step), revs),
+        Eigen::ArrayXd::Constant(1, alpha),
+        Eigen::ArrayXd::Constant(1, beta))(0);
+    const double sinX = std::sin(x);
+    const double cosX = std::cos(x);
+    const double oneMinusCos = detail::oneMinusCos(x);
+
+    // implicit derivative of Kepler's equation, the derivative of its left
+    // side with respect to x is r / a
+    const double rOverA = 1.0 - alpha * cosX + beta * sinX;
+    const Grad dX = (sinX * dAlpha - oneMinusCos * dBeta + step * dMeanMotion) /
+                    rOverA;
+    const Grad dSin = cosX * dX;
+    const Grad dOneMinusCos = sinX * dX;
+    const double r = a * rOverA;
+    const Grad dR = rOverA * dA + a * ((oneMinusCos - 1.0) * dAlpha +
+                                       alpha * dOneMinusCos + sinX * dBeta +
+                                       beta * dSin);
+
+    // Lagrange coefficients and their gradients
+    const double f = 1.0 - a / r0 * oneMinusCos;
+    const double g = (r0 / a * sinX + beta * oneMinusCos) / meanMotion;
+    const double fDot = -sqrtMu * sqrtA * sinX / (r * r0);
+    const double gDot = 1.0 - a / r * oneMinusCos;
+    const Grad dF = -oneMinusCos / r0 * dA +
+                    a * oneMinusCos / (r0 * r0) * dR0 - a / r0 * dOneMinusCos;
+    const Grad dG = (sinX / a * dR0 - r0 * sinX / (a * a) * dA +
+                     r0 / a * dSin + oneMinusCos * dBeta +
+                     beta * dOneMinusCos) /
+                        meanMotion -
+                    g / meanMotion * dMeanMotion;
+    const Grad dFDot =
+        -sqrtMu * (0.5 * sinX / sqrtA * dA + sqrtA * dSin) / (r * r0) -
+        fDot * (dR / r + dR0 / r0);
+    const Grad dGDot =
+        -oneMinusCos / r * dA + a * oneMinusCos / (r * r) * dR -
+        a / r * dOneMinusCos;
+
+    // next state is [f r0 + g v0, fDot r0 + gDot v0]
+    Eigen::MatrixXd out(6, 6);
+    out.topRows<3>() = pos * dF + vel * dG;
+    out.bottomRows<3>() = pos * dFDot + vel * dGDot;
+    out.topLeftCorner<3, 3>().diagonal().array() += f;
+    out.topRightCorner<3, 3>().diagonal().array() += g;
+    out.bottomLeftCorner<3, 3>().diagonal().array() += fDot;
+    out.bottomRightCorner<3, 3>().diagonal().array() += gDot;
+    return out;
+}
+
+}  // namespace lager::gncpy::dynamics
@@ -0,0 +1,136 @@
+#include "gncpy/dynamics/TwoBodyJ2.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "BatchDetail.h"
+#include "gncpy/Exceptions.h"
+#include "gncpy/utilities/Trace.h"
+
+namespace lager::gncpy::dynamics {
+
+using detail::Batch;
+using detail::BATCH_BLOCK;
+using detail::BatchCol;
+
+namespace {
+
+// derivative of every row, c is 3/2 J2 R^2
+void batchDerivative(double mu, double c, const Batch& s, Batch& ds) {
+    const BatchCol invR2 =
+        (s.col(0).square() + s.col(1).square() + s.col(2).square()).inverse();
+    const BatchCol f = -mu * invR2 * invR2.sqrt();
+    const BatchCol g = c * invR2;
+    const BatchCol zr2 = 5.0 * s.col(2).square() * invR2;
+    const BatchCol horiz = f * (1.0 - g * (zr2 - 1.0));
+
+    ds.resize(s.rows(), 6);
+    ds.leftCols<3>() = s.rightCols<3>();
+    ds.col(3) = horiz * s.col(0);
+    ds.col(4) = horiz * s.col(1);
+    ds.col(5) = f * s.col(2) * (1.0 - g * (zr2 - 3.0));
+}
+
+void checkSize(const Eigen::VectorXd& state) {
+    if (state.size() != 6) {
+        throw exceptions::BadParams(
+            "Two body state must be [x, y, z, vx, vy, vz]");
+    }
+}
+
+}  // namespace
+
+TwoBodyJ2::TwoBodyJ2(double dt, double mu, double radius, double j2)
+    : m_mu(mu), m_radius(radius), m_j2(j2) {
+    setDt(dt);
+}
+
+Eigen::VectorXd TwoBodyJ2::continuousDynamics(
+    [[maybe_unused]] double timestep, const Eigen::VectorXd& state,
+    [[maybe_unused]] const StateTransParams* stateTransParams) const {
+    checkSize(state);
+    const double invR2 = 1.0 / state.head<3>().squaredNorm();
+    const double f = -m_mu * invR2 * std::sqrt(invR2);
+    const double g = 1.5 * m_j2 * m_radius * m_radius * invR2;
+    const double zr2 = 5.0 * state(2) * state(2) * invR2;
+    const double horiz = f * (1.0 - g * (zr2 - 1.0));
+
+    Eigen::VectorXd out(6);
+    out << state.tail<3>(), horiz * state(0), horiz * state(1),
+        f * state(2) * (1.0 - g * (zr2 - 3.0));
+    return out;
+}
+
+void TwoBodyJ2::propagateBatch(double timestep,
+                               Eigen::Ref<Eigen::MatrixXd> states) const {
+    GNCPY_TRACE_SCOPE("TwoBodyJ2::propagateBatch");
+    if (states.cols() != 6) {
+        throw exceptions::BadParams(
+            "Batch must hold one 6 element state per row");
+    }
+    const double h = dt();
+    const double c = 1.5 * m_j2 * m_radius * m_radius;
+
+    Batch s;
+    Batch k;
+    Batch acc;
+    Batch tmp;
+    for (Eigen::Index start = 0; start < states.rows(); start += BATCH_BLOCK) {
+        const Eigen::Index n = std::min(BATCH_BLOCK, states.rows() - start);
+        auto block = states.middleRows(start, n);
+        s = block.array();
+
+        batchDerivative(m_mu, c, s, k);
+        acc = k;
+        tmp = s + 0.5 * h * k;
+        batchDerivative(m_mu, c, tmp, k);
+        acc += 2.0 * k;
+        tmp = s + 0.5 * h * k;
+        batchDerivative(m_mu, c, tmp, k);
+        acc += 2.0 * k;
+        tmp = s + h * k;
+        batchDerivative(m_mu, c, tmp, k);
+        acc += k;
+
+        block = (s + h / 6.0 * acc).matrix();
+    }
+
+    applyStateConstraintRows(timestep, states);
+}
+
+std::optional<Eigen::MatrixXd> TwoBodyJ2::analyticStateMat(
+    [[maybe_unused]] double timestep, const Eigen::VectorXd& state,
+    [[maybe_unused]] const StateTransParams* stateTransParams) const {
+    checkSize(state);
+    const Eigen::Vector3d pos = state.head<3>();
+    const double z = pos(2);
+    const double invR2 = 1.0 / pos.squaredNorm();
+    const double invR = std::sqrt(invR2);
+    const double invR3 = invR2 * invR;
+    const double invR5 = invR3 * invR2;
+    const double invR7 = invR5 * invR2;
+    const double c = 1.5 * m_j2 * m_radius * m_radius;
+    const Eigen::Vector3d zonal(1.0, 1.0, 3.0);
+
+    // gradient of the acceleration written as a sum of r_i / r^n terms
+    Eigen::Matrix3d grad;
+    for (int ii = 0; ii < 3; ii++) {
+        for (int jj = 0; jj < 3; jj++) {
+            const double delta = ii == jj ? 1.0 : 0.0;
+            const double outer = pos(ii) * pos(jj);
+            grad(ii, jj) = -(delta * invR3 - 3.0 * outer * invR5) -
+                           c * zonal(ii) *
+                               (delta * invR5 - 5.0 * outer * invR7) +
+                           5.0 * c * z * z *
+                               (delta * invR7 - 7.0 * outer * invR7 * invR2);
+        }
+        grad(ii, 2) += 10.0 * c * z * pos(ii) * invR7;
+    }
+
+    Eigen::MatrixXd out = Eigen::MatrixXd::Zero(6, 6);
+    out.topRightCorner<3, 3>().setIdentity();
+    out.bottomLeftCorner<3, 3>() = m_mu * grad;
+    return out;
+}
+
+}  // namespace lager::gncpy::dynamics
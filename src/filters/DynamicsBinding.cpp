@@ -0,0 +1,35 @@
+#include "gncpy/filters/DynamicsBinding.h"
+
+#include "gncpy/Exceptions.h"
+
+namespace lager::gncpy::filters::detail {
+
+void DynamicsBinding::bind(
+    const std::shared_ptr<dynamics::IDynamics>& dynObj) {
+    if (!dynObj) {
+        throw exceptions::TypeError("Dynamics model is unset");
+    }
+    if (!bound.owner_before(dynObj) && !dynObj.owner_before(bound)) {
+        return;
+    }
+    bound.reset();
+    nonLin = dynamic_cast<const dynamics::INonLinearDynamics*>(dynObj.get());
+    lin = nonLin == nullptr
+              ? dynamic_cast<const dynamics::ILinearDynamics*>(dynObj.get())
+              : nullptr;
+    if (nonLin == nullptr && lin == nullptr) {
+        throw exceptions::TypeError("Unknown dynamics type");
+    }
+    bound = dynObj;
+}
+
+Eigen::MatrixXd DynamicsBinding::getStateMat(
+    double timestep, const Eigen::VectorXd& state,
+    const dynamics::StateTransParams* stateTransParams) const {
+    if (nonLin != nullptr) {
+        return nonLin->getStateMat(timestep, state, stateTransParams);
+    }
+    return lin->getStateMat(timestep, stateTransParams);
+}
+
+}  // namespace lager::gncpy::filters::detail
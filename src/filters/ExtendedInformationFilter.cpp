@@ -0,0 +1,46 @@
+#include "gncpy/filters/ExtendedInformationFilter.h"
+
+#include "gncpy/Exceptions.h"
+#include "gncpy/Utilities.h"
+#include "gncpy/dynamics/ILinearDynamics.h"
+#include "gncpy/dynamics/INonLinearDynamics.h"
+#include "gncpy/utilities/Trace.h"
+
+namespace lager::gncpy::filters {
+
+Eigen::VectorXd ExtendedInformationFilter::predict(
+    double timestep, const Eigen::VectorXd& curState,
+    const std::optional<Eigen::VectorXd> controlInput,
+    const BayesPredictParams* params) {
+    m_dyn.bind(dynamicsHandle());
+    return InformationFilter::predict(timestep, curState, controlInput,
+                                      params);
+}
+
+void ExtendedInformationFilter::setStateModel(
+    std::shared_ptr<dynamics::IDynamics> dynObj, Eigen::MatrixXd procNoise) {
+    if (dynObj && !utilities:: instanceof
+        <dynamics::INonLinearDynamics>(dynObj) && !utilities:: instanceof
+        <dynamics::ILinearDynamics>(dynObj)) {
+        throw exceptions::TypeError("Unknown dynamics type");
+    }
+    setModels(dynObj, procNoise);
+    m_dyn.bind(dynamicsHandle());
+}
+
+void ExtendedInformationFilter::setMeasurementModel(
+    std::shared_ptr<measurements::IMeasModel> measObj,
+    Eigen::MatrixXd measNoise) {
+    setMeasModel(measObj, measNoise);
+}
+
+Eigen::MatrixXd ExtendedInformationFilter::getStateMat(
+    double timestep, const Eigen::VectorXd& curState,
+    const BayesPredictParams* params) const {
+    GNCPY_TRACE_SCOPE("ExtendedInformationFilter::getStateMat");
+    const dynamics::StateTransParams* stateTransParams =
+        params != nullptr ? params->stateTransParams.get() : nullptr;
+    return m_dyn.getStateMat(timestep, curState, stateTransParams);
+}
+
+}  // namespace lager::gncpy::filters
@@ -4,6 +4,8 @@
 #include "gncpy/dynamics/ILinearDynamics.h"
 #include "gncpy/dynamics/INonLinearDynamics.h"
 #include "gncpy/math/Math.h"
+#include "gncpy/utilities/Allocation.h"
+#include "gncpy/utilities/Trace.h"
 
 namespace lager::gncpy::filters {
 
@@ -11,28 +13,19 @@ Eigen::VectorXd ExtendedKalman::predict(
     double timestep, const Eigen::VectorXd& curState,
     [[maybe_unused]] const std::optional<Eigen::VectorXd> controlInput,
     const BayesPredictParams* params) {
-    if (params != nullptr && !utilities:: instanceof
-        <BayesPredictParams>(params)) {
-        throw exceptions::BadParams("Params must be BayesPredictParams");
-    }
+    GNCPY_ALLOC_SCOPE("ExtendedKalman::predict");
+    GNCPY_TRACE_SCOPE("ExtendedKalman::predict");
+    const dynamics::StateTransParams* stateTransParams =
+        params != nullptr ? params->stateTransParams.get() : nullptr;
+    m_dyn.bind(m_dynObj);
 
-    Eigen::VectorXd nextState = dynamicsModel()->propagateState(
-        timestep, curState, params->stateTransParams.get());
+    Eigen::VectorXd nextState =
+        m_dynObj->propagateState(timestep, curState, stateTransParams);
 
     Eigen::MatrixXd stateMat;
-    if (utilities:: instanceof
-        <dynamics::INonLinearDynamics>(dynamicsModel())) {
-        stateMat = std::dynamic_pointer_cast<dynamics::INonLinearDynamics>(
-                       dynamicsModel())
-                       ->getStateMat(timestep, curState,
-                                     params->stateTransParams.get());
-    } else if (utilities:: instanceof
-               <dynamics::ILinearDynamics>(dynamicsModel())) {
-        stateMat = std::dynamic_pointer_cast<dynamics::ILinearDynamics>(
-                       dynamicsModel())
-                       ->getStateMat(timestep, params->stateTransParams.get());
-    } else {
-        throw exceptions::TypeError("Unknown dynamics type");
+    {
+        GNCPY_TRACE_SCOPE("ExtendedKalman::predict/getStateMat");
+        stateMat = m_dyn.getStateMat(timestep, curState, stateTransParams);
     }
 
     if (m_continuousCov) {
@@ -45,6 +38,69 @@ Eigen::VectorXd ExtendedKalman::predict(
     return nextState;
 }
 
+Eigen::VectorXd ExtendedKalman::correct(double timestep,
+                                        const Eigen::VectorXd& meas,
+                                        const Eigen::VectorXd& curState,
+                                        double& measFitProb,
+                                        const BayesCorrectParams* params) {
+    GNCPY_ALLOC_SCOPE("ExtendedKalman::correct");
+    GNCPY_TRACE_SCOPE("ExtendedKalman::correct");
+    m_lastIterations = 1;
+    if (m_maxIterations <= 1) {
+        return Kalman::correct(timestep, meas, curState, measFitProb, params);
+    }
+    const measurements::MeasParams* measParams =
+        params != nullptr ? params->measParams.get() : nullptr;
+    const measurements::IMeasModel& measObj = viewMeasurementModel();
+
+    Eigen::VectorXd iterState = curState;
+    Eigen::VectorXd estMeas = measObj.measure(curState, measParams);
+    Eigen::MatrixXd measMat = measObj.getMeasMat(curState, measParams);
+    Eigen::MatrixXd inovCov = calcInovCov(measMat, viewCov());
+    measFitProb = math::calcGaussianPDF(meas, estMeas, inovCov);
+
+    Eigen::MatrixXd kalmanGain;
+    while (true) {
+        kalmanGain = inovCov.partialPivLu()
+                         .solve(measMat * viewCov().transpose())
+                         .transpose();
+        Eigen::VectorXd nextState =
+            curState + kalmanGain * (meas - estMeas -
+                                     measMat * (curState - iterState));
+        double step = (nextState - iterState).norm();
+        iterState = nextState;
+
+        if (step <= m_iterTol || m_lastIterations >= m_maxIterations) {
+            break;
+        }
+        m_lastIterations++;
+
+        estMeas = measObj.measure(iterState, measParams);
+        if (step > m_jacReuseTol) {
+            measMat = measObj.getMeasMat(iterState, measParams);
+            inovCov = calcInovCov(measMat, viewCov());
+        }
+    }
+
+    getCov() -= kalmanGain * measMat * viewCov();
+
+    return iterState;
+}
+
+void ExtendedKalman::setIterations(unsigned int maxIterations,
+                                   double tolerance,
+                                   double jacobianReuseTolerance) {
+    if (maxIterations < 1) {
+        throw exceptions::BadParams("Must use at least one iteration");
+    }
+    if (tolerance < 0.0 || jacobianReuseTolerance < 0.0) {
+        throw exceptions::BadParams("Tolerances can not be negative");
+    }
+    m_maxIterations = maxIterations;
+    m_iterTol = tolerance;
+    m_jacReuseTol = jacobianReuseTolerance;
+}
+
 void ExtendedKalman::setStateModel(std::shared_ptr<dynamics::IDynamics> dynObj,
                                    Eigen::MatrixXd procNoise) {
     if (!dynObj) {
@@ -61,6 +117,7 @@ void ExtendedKalman::setStateModel(std::shared_ptr<dynamics::IDynamics> dynObj,
     }
 
     m_dynObj = dynObj;
+    m_dyn.bind(m_dynObj);
     m_procNoise = procNoise;
 }
 
@@ -76,18 +133,13 @@ void ExtendedKalman::setMeasurementModel(
         throw exceptions::BadParams("Measurement noise must be square");
     }
 
-    if (utilities :: instanceof <measurements::ILinearMeasModel>(measObj)) {
-        m_measObj =
-            std::dynamic_pointer_cast<measurements::ILinearMeasModel>(measObj);
-        m_measNoise = measNoise;
+    if (!utilities:: instanceof <measurements::ILinearMeasModel>(measObj) &&
+        !utilities:: instanceof <measurements::INonLinearMeasModel>(measObj)) {
+        throw exceptions::TypeError("Unknown measurement model type");
     }
 
-    if (utilities :: instanceof <measurements::INonLinearMeasModel>(measObj)) {
-        m_measObj =
-            std::dynamic_pointer_cast<measurements::INonLinearMeasModel>(
-                measObj);
-        m_measNoise = measNoise;
-    }
+    m_measObj = measObj;
+    m_measNoise = measNoise;
 }
 
 inline std::shared_ptr<dynamics::IDynamics> ExtendedKalman::dynamicsModel()
@@ -108,4 +160,11 @@ inline std::shared_ptr<measurements::IMeasModel> ExtendedKalman::measurementMode
     }
 }
 
+const measurements::IMeasModel& ExtendedKalman::viewMeasurementModel() const {
+    if (!m_measObj) {
+        throw exceptions::TypeError("Measurement model is unset");
+    }
+    return *m_measObj;
+}
+
 }  // namespace lager::gncpy::filters
@@ -0,0 +1,155 @@
+#include "gncpy/filters/FusionScheduler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "gncpy/Exceptions.h"
+
+namespace lager::gncpy::filters {
+
+FusionScheduler::FusionScheduler(size_t numThreads) : m_pool(numThreads) {}
+
+FusionScheduler::TrackId FusionScheduler::addTrack(
+    std::shared_ptr<IBayesFilter> filter, double time,
+    const Eigen::VectorXd& state,
+    std::shared_ptr<const BayesPredictParams> predParams, StepHook setStep) {
+    if (!filter) {
+        throw exceptions::TypeError("filter can not be nullptr");
+    }
+    auto trk = std::make_unique<Track>();
+    trk->filter = filter;
+    trk->dynObj = filter->dynamicsModel();
+    trk->predParams =
+        predParams ? predParams : std::make_shared<const BayesPredictParams>();
+    trk->setStep = std::move(setStep);
+    trk->time = time;
+    trk->state = state;
+
+    std::unique_lock<std::shared_mutex> lk(m_tracksMut);
+    TrackId id = m_nextId++;
+    m_tracks.emplace(id, std::move(trk));
+    return id;
+}
+
+void FusionScheduler::setModelStep(dynamics::IDynamics& dynObj, double dt) {
+    if (!dynObj.setFixedStep(dt)) {
+        throw exceptions::BadParams(
+            "Dynamics model does not step by a stored dt");
+    }
+}
+
+FusionScheduler::Track& FusionScheduler::track(TrackId id) const {
+    std::shared_lock<std::shared_mutex> lk(m_tracksMut);
+    auto it = m_tracks.find(id);
+    if (it == m_tracks.end()) {
+        throw exceptions::BadParams("Unknown track id");
+    }
+    // tracks are never removed so the reference stays valid
+    return *it->second;
+}
+
+void FusionScheduler::submit(TrackId id, double time, Eigen::VectorXd meas,
+                             std::shared_ptr<const BayesCorrectParams> params) {
+    Track& trk = track(id);
+    Measurement m{time, m_nextSeq++, std::move(meas),
+                  params ? params
+                         : std::make_shared<const BayesCorrectParams>()};
+
+    std::lock_guard<std::mutex> lk(trk.pendingMut);
+    trk.pending.push_back(std::move(m));
+}
+
+size_t FusionScheduler::process(double horizon) {
+    std::lock_guard<std::mutex> processLk(m_processMut);
+
+    std::vector<Track*> work;
+    {
+        std::shared_lock<std::shared_mutex> lk(m_tracksMut);
+        for (auto& [id, trk] : m_tracks) {
+            std::lock_guard<std::mutex> pendingLk(trk->pendingMut);
+            if (!trk->pending.empty()) {
+                work.push_back(trk.get());
+            }
+        }
+    }
+
+    std::atomic<size_t> numFused = 0;
+    for (Track* trk : work) {
+        m_pool.submit([this, trk, horizon, &numFused]() {
+            numFused += processTrack(*trk, horizon);
+        });
+    }
+    m_pool.wait();
+
+    return numFused;
+}
+
+size_t FusionScheduler::processTrack(Track& trk, double horizon) {
+    std::vector<Measurement> batch;
+    {
+        std::lock_guard<std::mutex> lk(trk.pendingMut);
+        auto split = std::partition(
+            trk.pending.begin(), trk.pending.end(),
+            [horizon](const Measurement& m) { return m.time <= horizon; });
+        batch.assign(std::make_move_iterator(trk.pending.begin()),
+                     std::make_move_iterator(split));
+        trk.pending.erase(trk.pending.begin(), split);
+    }
+    std::sort(batch.begin(), batch.end(),
+              [](const Measurement& a, const Measurement& b) {
+                  return a.time < b.time || (a.time == b.time && a.seq < b.seq);
+              });
+
+    std::lock_guard<std::mutex> lk(trk.stateMut);
+    size_t numFused = 0;
+    double prob;
+    for (const auto& m : batch) {
+        if (m.time < trk.time - timeTolerance) {
+            m_numDropped++;
+            continue;
+        }
+        if (m.time > trk.time + timeTolerance) {
+            // the models step by a stored dt rather than by the timestamps
+            const double gap = m.time - trk.time;
+            if (trk.setStep) {
+                trk.setStep(*trk.dynObj, gap);
+            } else if (auto step = trk.dynObj->fixedStep();
+                       step && std::abs(*step - gap) > timeTolerance) {
+                // only this measurement can not be reached, later ones may
+                m_numRejected++;
+                continue;
+            }
+            trk.state = trk.filter->predict(trk.time, trk.state, std::nullopt,
+                                            trk.predParams.get());
+            trk.time = m.time;
+            m_numPredicts++;
+        }
+        trk.state = trk.filter->correct(m.time, m.meas, trk.state, prob,
+                                        m.params.get());
+        numFused++;
+    }
+    m_numCorrects += numFused;
+
+    return numFused;
+}
+
+double FusionScheduler::trackTime(TrackId id) const {
+    Track& trk = track(id);
+    std::lock_guard<std::mutex> lk(trk.stateMut);
+    return trk.time;
+}
+
+Eigen::VectorXd FusionScheduler::trackState(TrackId id) const {
+    Track& trk = track(id);
+    std::lock_guard<std::mutex> lk(trk.stateMut);
+    return trk.state;
+}
+
+Eigen::MatrixXd FusionScheduler::trackCov(TrackId id) const {
+    Track& trk = track(id);
+    std::lock_guard<std::mutex> lk(trk.stateMut);
+    return trk.filter->viewCov();
+}
+
+}  // namespace lager::gncpy::filters
@@ -0,0 +1,396 @@
+#include "gncpy/filters/GMPHD.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+
+#include "gncpy/Exceptions.h"
+#include "gncpy/Utilities.h"
+#include "gncpy/utilities/Allocation.h"
+#include "gncpy/utilities/Trace.h"
+
+namespace lager::gncpy::filters {
+
+namespace {
+
+// packs up to 3 cell indices into a single hash key, collisions only add extra
+// candidates which are rejected by the distance check
+int64_t cellKey(const int64_t* cells, size_t numDims) {
+    int64_t key = 0;
+    for (size_t d = 0; d < numDims; d++) {
+        key = (key << 21) | (cells[d] & 0x1FFFFF);
+    }
+    return key;
+}
+
+// far beyond any real cell so that hi - lo + 1 can not overflow
+constexpr double MAX_CELL = 4.5e15;
+
+}  // namespace
+
+void GMPHD::predict(double timestep, const BayesPredictParams* params) {
+    GNCPY_ALLOC_SCOPE("GMPHD::predict");
+    GNCPY_TRACE_SCOPE("GMPHD::predict");
+    if (!m_dynObj) {
+        throw exceptions::TypeError("Dynamics model is unset");
+    }
+    const dynamics::StateTransParams* stateTransParams =
+        params != nullptr ? params->stateTransParams.get() : nullptr;
+
+    const Eigen::Index numComps = m_mixture.size();
+    if (numComps > 0) {
+        const Eigen::Index n = m_mixture.stateDim();
+        Eigen::MatrixXd stateMat =
+            m_dynObj->getStateMat(timestep, stateTransParams);
+
+        m_mixture.weights() *= probSurvival;
+        m_mixture.means() = stateMat * m_mixture.means();
+
+        Eigen::MatrixXd propCovs = stateMat * m_mixture.covs();
+        for (Eigen::Index j = 0; j < numComps; j++) {
+            m_mixture.cov(j).noalias() =
+                propCovs.middleCols(j * n, n) * stateMat.transpose();
+            m_mixture.cov(j) += m_procNoise;
+        }
+    }
+
+    m_mixture.append(m_birth);
+}
+
+void GMPHD::correct([[maybe_unused]] double timestep,
+                    const Eigen::MatrixXd& meas,
+                    const BayesCorrectParams* params) {
+    GNCPY_ALLOC_SCOPE("GMPHD::correct");
+    GNCPY_TRACE_SCOPE("GMPHD::correct");
+    if (!m_measObj) {
+        throw exceptions::TypeError("Measurement model is unset");
+    }
+    const measurements::MeasParams* measParams =
+        params != nullptr ? params->measParams.get() : nullptr;
+
+    const Eigen::Index numComps = m_mixture.size();
+    if (numComps == 0) {
+        return;
+    }
+    const Eigen::Index n = m_mixture.stateDim();
+    const Eigen::Index numMeas = meas.cols();
+
+    GaussianMixture out(n);
+    out.resize(numComps * (numMeas + 1));
+
+    // missed detection terms
+    out.weights().head(numComps) = (1.0 - probDetection) * m_mixture.weights();
+    out.means().leftCols(numComps) = m_mixture.means();
+    out.covs().leftCols(numComps * n) = m_mixture.covs();
+
+    if (numMeas == 0) {
+        m_mixture = std::move(out);
+        return;
+    }
+
+    Eigen::MatrixXd measMat =
+        m_measObj->getMeasMat(m_mixture.mean(0), measParams);
+    if (meas.rows() != measMat.rows()) {
+        throw exceptions::BadParams(
+            "Measurement size does not match the measurement model");
+    }
+    if (m_measNoise.rows() != measMat.rows()) {
+        throw exceptions::BadParams(
+            "Measurement noise size does not match the measurement model");
+    }
+    const double logNorm =
+        -0.5 * static_cast<double>(measMat.rows()) * std::log(2.0 * M_PI);
+
+    Eigen::MatrixXd estMeas = measMat * m_mixture.means();
+    Eigen::MatrixXd likelihood(numComps, numMeas);
+    for (Eigen::Index j = 0; j < numComps; j++) {
+        Eigen::MatrixXd covMeasT = m_mixture.cov(j) * measMat.transpose();
+        Eigen::MatrixXd inovCov = measMat * covMeasT + m_measNoise;
+        Eigen::LLT<Eigen::MatrixXd> llt(inovCov);
+        if (llt.info() != Eigen::Success) {
+            throw exceptions::BadParams(
+                "Innovation covariance is not positive definite");
+        }
+
+        Eigen::MatrixXd kalmanGain =
+            llt.solve(covMeasT.transpose()).transpose();
+        Eigen::MatrixXd inov = meas.colwise() - estMeas.col(j);
+        Eigen::MatrixXd whiteInov = llt.matrixL().solve(inov);
+        // the factor's diagonal is read in place, no dense copy of L
+        double logDet = 2.0 * llt.matrixLLT().diagonal().array().log().sum();
+
+        likelihood.row(j) =
+            (probDetection * m_mixture.weight(j)) *
+            (logNorm - 0.5 * logDet -
+             0.5 * whiteInov.colwise().squaredNorm().array())
+                .exp()
+                .matrix();
+
+        Eigen::MatrixXd updCov =
+            m_mixture.cov(j) - kalmanGain * covMeasT.transpose();
+        Eigen::MatrixXd updMeans =
+            (kalmanGain * inov).colwise() + m_mixture.mean(j);
+        for (Eigen::Index z = 0; z < numMeas; z++) {
+            Eigen::Index ind = numComps * (z + 1) + j;
+            out.mean(ind) = updMeans.col(z);
+            out.cov(ind) = updCov;
+        }
+    }
+
+    Eigen::RowVectorXd denom =
+        likelihood.colwise().sum().array() + clutterDensity;
+    for (Eigen::Index z = 0; z < numMeas; z++) {
+        out.weights().segment(numComps * (z + 1), numComps) =
+            likelihood.col(z) / denom(z);
+    }
+
+    m_mixture = std::move(out);
+}
+
+void GMPHD::prune() {
+    GNCPY_TRACE_SCOPE("GMPHD::prune");
+    Eigen::Index keep = 0;
+    for (Eigen::Index j = 0; j < m_mixture.size(); j++) {
+        if (m_mixture.weight(j) < pruneThreshold) {
+            continue;
+        }
+        if (keep != j) {
+            m_mixture.weight(keep) = m_mixture.weight(j);
+            m_mixture.mean(keep) = m_mixture.mean(j);
+            m_mixture.cov(keep) = m_mixture.cov(j);
+        }
+        keep++;
+    }
+    m_mixture.resize(keep);
+}
+
+void GMPHD::merge() {
+    GNCPY_TRACE_SCOPE("GMPHD::merge");
+    const Eigen::Index numComps = m_mixture.size();
+    if (numComps < 2) {
+        return;
+    }
+    const Eigen::Index n = m_mixture.stateDim();
+    const size_t numDims = m_mergeInds.size();
+    for (auto ind : m_mergeInds) {
+        if (ind >= n) {
+            throw exceptions::BadParams(
+                "Merge index is larger than the state dimension");
+        }
+        if (!m_mixture.means().row(ind).allFinite()) {
+            throw exceptions::BadParams("Component means must be finite");
+        }
+    }
+
+    // the largest eigenvalue is bounded by the trace so this radius contains
+    // every component within the Mahalanobis threshold
+    Eigen::VectorXd radius(numComps);
+    for (Eigen::Index j = 0; j < numComps; j++) {
+        radius(j) = std::sqrt(mergeThreshold * m_mixture.cov(j).trace());
+    }
+    std::vector<double> sortedRad(radius.data(), radius.data() + numComps);
+    std::nth_element(sortedRad.begin(), sortedRad.begin() + numComps / 2,
+                     sortedRad.end());
+    const double cellSize =
+        std::max(sortedRad[numComps / 2], std::numeric_limits<double>::min());
+
+    // casting a NaN or out of range value is undefined, a huge radius only
+    // pushes the search to the linear scan
+    auto toCell = [cellSize](double val) {
+        const double cell = std::floor(val / cellSize);
+        if (std::isnan(cell)) {
+            return int64_t(0);
+        }
+        return static_cast<int64_t>(std::clamp(cell, -MAX_CELL, MAX_CELL));
+    };
+
+    std::unordered_map<int64_t, std::vector<Eigen::Index>> grid;
+    grid.reserve(numComps);
+    int64_t cells[3];
+    for (Eigen::Index j = 0; j < numComps; j++) {
+        for (size_t d = 0; d < numDims; d++) {
+            cells[d] = toCell(m_mixture.mean(j)(m_mergeInds[d]));
+        }
+        grid[cellKey(cells, numDims)].push_back(j);
+    }
+
+    std::vector<Eigen::Index> order(numComps);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [this](auto a, auto b) {
+        return m_mixture.weight(a) > m_mixture.weight(b);
+    });
+
+    std::vector<char> alive(numComps, 1);
+    std::vector<Eigen::Index> group;
+    GaussianMixture out(n);
+    out.reserve(numComps);
+
+    for (auto ii : order) {
+        if (!alive[ii]) {
+            continue;
+        }
+
+        group.clear();
+        Eigen::LLT<Eigen::MatrixXd> llt(m_mixture.cov(ii));
+        auto check = [&](Eigen::Index j) {
+            if (!alive[j]) {
+                return;
+            }
+            Eigen::VectorXd diff = m_mixture.mean(j) - m_mixture.mean(ii);
+            if (diff.dot(llt.solve(diff)) <= mergeThreshold) {
+                group.push_back(j);
+                alive[j] = 0;
+            }
+        };
+
+        int64_t lo[3];
+        int64_t hi[3];
+        double numCells = 1.0;
+        for (size_t d = 0; d < numDims; d++) {
+            double center = m_mixture.mean(ii)(m_mergeInds[d]);
+            lo[d] = toCell(center - radius(ii));
+            hi[d] = toCell(center + radius(ii));
+            numCells *= static_cast<double>(hi[d] - lo[d] + 1);
+        }
+
+        if (llt.info() != Eigen::Success) {
+            group.push_back(ii);
+            alive[ii] = 0;
+        } else if (numCells >= static_cast<double>(numComps)) {
+            // visiting the cells would cost more than a linear scan
+            for (Eigen::Index j = 0; j < numComps; j++) {
+                check(j);
+            }
+        } else {
+            std::copy(lo, lo + numDims, cells);
+            while (true) {
+                auto it = grid.find(cellKey(cells, numDims));
+                if (it != grid.end()) {
+                    for (auto j : it->second) {
+                        check(j);
+                    }
+                }
+                size_t d = 0;
+                for (; d < numDims; d++) {
+                    if (++cells[d] <= hi[d]) {
+                        break;
+                    }
+                    cells[d] = lo[d];
+                }
+                if (d == numDims) {
+                    break;
+                }
+            }
+        }
+
+        double wSum = 0.0;
+        Eigen::VectorXd mean = Eigen::VectorXd::Zero(n);
+        for (auto j : group) {
+            wSum += m_mixture.weight(j);
+            mean += m_mixture.weight(j) * m_mixture.mean(j);
+        }
+        mean /= wSum;
+        Eigen::MatrixXd cov = Eigen::MatrixXd::Zero(n, n);
+        for (auto j : group) {
+            Eigen::VectorXd diff = mean - m_mixture.mean(j);
+            cov += m_mixture.weight(j) *
+                   (m_mixture.cov(j) + diff * diff.transpose());
+        }
+        cov /= wSum;
+
+        out.add(wSum, mean, cov);
+    }
+
+    m_mixture = std::move(out);
+}
+
+void GMPHD::cap() {
+    GNCPY_TRACE_SCOPE("GMPHD::cap");
+    const Eigen::Index numComps = m_mixture.size();
+    if (numComps <= maxComponents) {
+        return;
+    }
+    std::vector<Eigen::Index> order(numComps);
+    std::iota(order.begin(), order.end(), 0);
+    std::partial_sort(order.begin(), order.begin() + maxComponents,
+                      order.end(), [this](auto a, auto b) {
+                          return m_mixture.weight(a) > m_mixture.weight(b);
+                      });
+
+    GaussianMixture out(m_mixture.stateDim());
+    out.reserve(maxComponents);
+    for (Eigen::Index ii = 0; ii < maxComponents; ii++) {
+        auto j = order[ii];
+        out.add(m_mixture.weight(j), m_mixture.mean(j), m_mixture.cov(j));
+    }
+    m_mixture = std::move(out);
+}
+
+void GMPHD::cleanup() {
+    prune();
+    merge();
+    cap();
+}
+
+std::vector<Eigen::VectorXd> GMPHD::extractStates() const {
+    std::vector<Eigen::VectorXd> states;
+    for (Eigen::Index j = 0; j < m_mixture.size(); j++) {
+        if (m_mixture.weight(j) <= extractThreshold) {
+            continue;
+        }
+        auto copies = std::max<long>(1, std::lround(m_mixture.weight(j)));
+        for (long ii = 0; ii < copies; ii++) {
+            states.emplace_back(m_mixture.mean(j));
+        }
+    }
+    return states;
+}
+
+void GMPHD::setStateModel(std::shared_ptr<dynamics::IDynamics> dynObj,
+                          Eigen::MatrixXd procNoise) {
+    if (!dynObj || !utilities:: instanceof
+        <dynamics::ILinearDynamics>(dynObj)) {
+        throw exceptions::TypeError(
+            "dynObj must be a derived class of ILinearDynamics");
+    }
+    if (procNoise.rows() != procNoise.cols()) {
+        throw exceptions::BadParams("Process noise must be square");
+    }
+    if (procNoise.rows() !=
+        static_cast<long int>(dynObj->stateNames().size())) {
+        throw exceptions::BadParams(
+            "Process nosie size does not match they dynamics model "
+            "dimension");
+    }
+
+    m_dynObj = std::dynamic_pointer_cast<dynamics::ILinearDynamics>(dynObj);
+    m_procNoise = procNoise;
+}
+
+void GMPHD::setMeasurementModel(
+    std::shared_ptr<measurements::IMeasModel> measObj,
+    Eigen::MatrixXd measNoise) {
+    if (!measObj || !utilities:: instanceof
+        <measurements::ILinearMeasModel>(measObj)) {
+        throw exceptions::TypeError(
+            "measObj must be a derived class of ILinearMeasModel");
+    }
+    if (measNoise.rows() != measNoise.cols()) {
+        throw exceptions::BadParams("Measurement noise must be square");
+    }
+
+    m_measObj =
+        std::dynamic_pointer_cast<measurements::ILinearMeasModel>(measObj);
+    m_measNoise = measNoise;
+}
+
+void GMPHD::setMergeIndices(const std::vector<uint8_t>& inds) {
+    if (inds.empty() || inds.size() > 3) {
+        throw exceptions::BadParams("Between 1 and 3 merge indices required");
+    }
+    m_mergeInds = inds;
+}
+
+}  // namespace lager::gncpy::filters
@@ -0,0 +1,64 @@
+#include "gncpy/filters/GaussianMixture.h"
+
+#include <algorithm>
+
+#include "gncpy/Exceptions.h"
+
+namespace lager::gncpy::filters {
+
+void GaussianMixture::reserve(Eigen::Index capacity) {
+    if (capacity <= m_weights.size()) {
+        return;
+    }
+    m_weights.conservativeResize(capacity);
+    m_means.conservativeResize(m_stateDim, capacity);
+    m_covs.conservativeResize(m_stateDim, m_stateDim * capacity);
+}
+
+void GaussianMixture::resize(Eigen::Index numComponents) {
+    reserve(numComponents);
+    m_size = numComponents;
+}
+
+void GaussianMixture::add(double weight, const Eigen::VectorXd& mean,
+                          const Eigen::MatrixXd& cov) {
+    if (m_size == 0 && m_weights.size() == 0 && m_stateDim == 0) {
+        m_stateDim = mean.size();
+    }
+    if (mean.size() != m_stateDim || cov.rows() != m_stateDim ||
+        cov.cols() != m_stateDim) {
+        throw exceptions::BadParams(
+            "Component size does not match the mixture state dimension");
+    }
+    if (m_size == m_weights.size()) {
+        reserve(std::max<Eigen::Index>(4, 2 * m_size));
+    }
+    m_weights(m_size) = weight;
+    m_means.col(m_size) = mean;
+    m_covs.middleCols(m_size * m_stateDim, m_stateDim) = cov;
+    m_size++;
+}
+
+void GaussianMixture::append(const GaussianMixture& other) {
+    if (other.empty()) {
+        return;
+    }
+    if (m_size == 0 && m_stateDim == 0) {
+        m_stateDim = other.stateDim();
+    }
+    if (other.stateDim() != m_stateDim) {
+        throw exceptions::BadParams(
+            "Mixtures must have the same state dimension");
+    }
+    Eigen::Index start = m_size;
+    if (m_size + other.size() > m_weights.size()) {
+        reserve(std::max(m_size + other.size(), 2 * m_size));
+    }
+    m_size += other.size();
+    m_weights.segment(start, other.size()) = other.weights();
+    m_means.middleCols(start, other.size()) = other.means();
+    m_covs.middleCols(start * m_stateDim, other.size() * m_stateDim) =
+        other.covs();
+}
+
+}  // namespace lager::gncpy::filters
@@ -0,0 +1,234 @@
+#include "gncpy/filters/InformationFilter.h"
+
+#include "gncpy/Exceptions.h"
+#include "gncpy/Utilities.h"
+#include "gncpy/dynamics/ILinearDynamics.h"
+#include "gncpy/math/Math.h"
+#include "gncpy/measurements/ILinearMeasModel.h"
+#include "gncpy/utilities/Allocation.h"
+#include "gncpy/utilities/Trace.h"
+
+namespace lager::gncpy::filters {
+
+namespace {
+
+Eigen::MatrixXd invertSymmetric(const Eigen::MatrixXd& mat) {
+    return mat.ldlt().solve(
+        Eigen::MatrixXd::Identity(mat.rows(), mat.cols()));
+}
+
+}  // namespace
+
+InfoContribution& InfoContribution::operator+=(const InfoContribution& other) {
+    if (info.size() == 0) {
+        info = other.info;
+        vec = other.vec;
+    } else {
+        info += other.info;
+        vec += other.vec;
+    }
+    return *this;
+}
+
+Eigen::VectorXd InformationFilter::predict(
+    double timestep, const Eigen::VectorXd& curState,
+    [[maybe_unused]] const std::optional<Eigen::VectorXd> controlInput,
+    const BayesPredictParams* params) {
+    GNCPY_ALLOC_SCOPE("InformationFilter::predict");
+    GNCPY_TRACE_SCOPE("InformationFilter::predict");
+    Eigen::MatrixXd stateMat;
+    {
+        GNCPY_TRACE_SCOPE("InformationFilter::predict/getStateMat");
+        stateMat = getStateMat(timestep, curState, params);
+    }
+    getCov() = stateMat * viewCov() * stateMat.transpose() + m_procNoise;
+
+    return dynamicsModel()->propagateState(
+        timestep, curState,
+        params != nullptr ? params->stateTransParams.get() : nullptr);
+}
+
+Eigen::VectorXd InformationFilter::correct([[maybe_unused]] double timestep,
+                                           const Eigen::VectorXd& meas,
+                                           const Eigen::VectorXd& curState,
+                                           double& measFitProb,
+                                           const BayesCorrectParams* params) {
+    GNCPY_ALLOC_SCOPE("InformationFilter::correct");
+    GNCPY_TRACE_SCOPE("InformationFilter::correct");
+    const measurements::MeasParams* measParams =
+        params != nullptr ? params->measParams.get() : nullptr;
+    const measurements::IMeasModel& measObj = viewMeasurementModel();
+    Eigen::VectorXd estMeas = measObj.measure(curState, measParams);
+    Eigen::MatrixXd measMat = measObj.getMeasMat(curState, measParams);
+
+    // the contribution reuses the linearization of the fit probability
+    InfoContribution contrib =
+        contribution(meas, curState, estMeas, measMat);
+    measFitProb = math::calcGaussianPDF(
+        meas, estMeas, measMat * viewCov() * measMat.transpose() + m_measNoise);
+
+    return fuse(curState, contrib);
+}
+
+InfoContribution InformationFilter::contribution(
+    const Eigen::VectorXd& meas, const Eigen::VectorXd& curState,
+    const BayesCorrectParams* params) const {
+    const measurements::MeasParams* measParams =
+        params != nullptr ? params->measParams.get() : nullptr;
+    const measurements::IMeasModel& measObj = viewMeasurementModel();
+    return contribution(meas, curState, measObj.measure(curState, measParams),
+                        measObj.getMeasMat(curState, measParams));
+}
+
+InfoContribution InformationFilter::contribution(
+    const Eigen::VectorXd& meas, const Eigen::VectorXd& curState,
+    const Eigen::VectorXd& estMeas, const Eigen::MatrixXd& measMat) const {
+    GNCPY_TRACE_SCOPE("InformationFilter::contribution");
+    if (measMat.rows() != m_measNoiseInv.rows()) {
+        throw exceptions::BadParams(
+            "Measurement size does not match the measurement noise");
+    }
+    Eigen::MatrixXd weighted = measMat.transpose() * m_measNoiseInv;
+
+    InfoContribution out;
+    out.info = weighted * measMat;
+    out.vec = weighted * (meas - estMeas + measMat * curState);
+    return out;
+}
+
+Eigen::VectorXd InformationFilter::fuse(const Eigen::VectorXd& curState,
+                                        const InfoContribution& total) {
+    GNCPY_TRACE_SCOPE("InformationFilter::fuse");
+    if (total.info.size() == 0) {
+        return curState;
+    }
+    Eigen::VectorXd infoVec = viewInfo() * curState + total.vec;
+    getInfo() += total.info;
+
+    return m_info.ldlt().solve(infoVec);
+}
+
+void InformationFilter::setStateModel(
+    std::shared_ptr<dynamics::IDynamics> dynObj, Eigen::MatrixXd procNoise) {
+    if (!dynObj || !utilities:: instanceof
+        <dynamics::ILinearDynamics>(dynObj)) {
+        throw exceptions::TypeError(
+            "dynObj must be a derived class of ILinearDynamics");
+    }
+    setModels(dynObj, procNoise);
+}
+
+void InformationFilter::setMeasurementModel(
+    std::shared_ptr<measurements::IMeasModel> measObj,
+    Eigen::MatrixXd measNoise) {
+    if (!measObj || !utilities:: instanceof
+        <measurements::ILinearMeasModel>(measObj)) {
+        throw exceptions::TypeError(
+            "measObj must be a derived class of ILinearMeasModel");
+    }
+    setMeasModel(measObj, measNoise);
+}
+
+void InformationFilter::setModels(std::shared_ptr<dynamics::IDynamics> dynObj,
+                                  Eigen::MatrixXd procNoise) {
+    if (!dynObj) {
+        throw exceptions::TypeError("dynObj can not be nullptr");
+    }
+    if (procNoise.rows() != procNoise.cols()) {
+        throw exceptions::BadParams("Process noise must be square");
+    }
+    if (procNoise.rows() !=
+        static_cast<long int>(dynObj->stateNames().size())) {
+        throw exceptions::BadParams(
+            "Process nosie size does not match they dynamics model "
+            "dimension");
+    }
+
+    m_dynObj = dynObj;
+    m_procNoise = procNoise;
+}
+
+void InformationFilter::setMeasModel(
+    std::shared_ptr<measurements::IMeasModel> measObj,
+    Eigen::MatrixXd measNoise) {
+    if (!measObj) {
+        throw exceptions::TypeError("measObj is required");
+    }
+    if (measNoise.rows() != measNoise.cols()) {
+        throw exceptions::BadParams("Measurement noise must be square");
+    }
+    Eigen::LLT<Eigen::MatrixXd> llt(measNoise);
+    if (llt.info() != Eigen::Success) {
+        throw exceptions::BadParams(
+            "Measurement noise must be positive definite");
+    }
+
+    m_measObj = measObj;
+    m_measNoise = measNoise;
+    m_measNoiseInv = llt.solve(
+        Eigen::MatrixXd::Identity(measNoise.rows(), measNoise.cols()));
+}
+
+Eigen::MatrixXd InformationFilter::getStateMat(
+    double timestep, [[maybe_unused]] const Eigen::VectorXd& curState,
+    const BayesPredictParams* params) const {
+    return std::static_pointer_cast<dynamics::ILinearDynamics>(dynamicsModel())
+        ->getStateMat(timestep, params != nullptr
+                                    ? params->stateTransParams.get()
+                                    : nullptr);
+}
+
+std::shared_ptr<dynamics::IDynamics> InformationFilter::dynamicsModel() const {
+    if (m_dynObj) {
+        return m_dynObj;
+    } else {
+        throw exceptions::TypeError("Dynamics model is unset");
+    }
+}
+
+const measurements::IMeasModel& InformationFilter::viewMeasurementModel()
+    const {
+    if (!m_measObj) {
+        throw exceptions::TypeError("Measurement model is unset");
+    }
+    return *m_measObj;
+}
+
+std::shared_ptr<measurements::IMeasModel> InformationFilter::measurementModel()
+    const {
+    if (m_measObj) {
+        return m_measObj;
+    } else {
+        throw exceptions::TypeError("Measurement model is unset");
+    }
+}
+
+Eigen::MatrixXd& InformationFilter::getCov() {
+    viewCov();
+    m_infoValid = false;
+    return IBayesFilter::getCov();
+}
+
+const Eigen::MatrixXd& InformationFilter::viewCov() {
+    if (!m_covValid) {
+        IBayesFilter::getCov() = invertSymmetric(m_info);
+        m_covValid = true;
+    }
+    return IBayesFilter::viewCov();
+}
+
+Eigen::MatrixXd& InformationFilter::getInfo() {
+    viewInfo();
+    m_covValid = false;
+    return m_info;
+}
+
+const Eigen::MatrixXd& InformationFilter::viewInfo() {
+    if (!m_infoValid) {
+        m_info = invertSymmetric(IBayesFilter::viewCov());
+        m_infoValid = true;
+    }
+    return m_info;
+}
+
+}  // namespace lager::gncpy::filters
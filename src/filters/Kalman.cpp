@@ -2,6 +2,8 @@
 
 #include "gncpy/Exceptions.h"
 #include "gncpy/Utilities.h"
+#include "gncpy/utilities/Allocation.h"
+#include "gncpy/utilities/Trace.h"
 
 namespace lager::gncpy::filters {
 
@@ -9,16 +11,20 @@ Eigen::VectorXd Kalman::predict(
     double timestep, const Eigen::VectorXd& curState,
     [[maybe_unused]] const std::optional<Eigen::VectorXd> controlInput,
     const BayesPredictParams* params) {
-    if (params != nullptr && !utilities:: instanceof
-        <BayesPredictParams>(params)) {
-        throw exceptions::BadParams("Params must be BayesPredictParams");
+    GNCPY_ALLOC_SCOPE("Kalman::predict");
+    GNCPY_TRACE_SCOPE("Kalman::predict");
+    const dynamics::StateTransParams* stateTransParams =
+        params != nullptr ? params->stateTransParams.get() : nullptr;
+    const dynamics::ILinearDynamics& dynObj = viewDynamicsModel();
+
+    Eigen::MatrixXd stateMat;
+    {
+        GNCPY_TRACE_SCOPE("Kalman::predict/getStateMat");
+        stateMat = dynObj.getStateMat(timestep, stateTransParams);
     }
-    Eigen::MatrixXd stateMat =
-        m_dynObj->getStateMat(timestep, params->stateTransParams.get());
     getCov() = stateMat * viewCov() * stateMat.transpose() + m_procNoise;
 
-    return m_dynObj->propagateState(timestep, curState,
-                                    params->stateTransParams.get());
+    return dynObj.propagateState(timestep, curState, stateTransParams);
 }
 
 Eigen::VectorXd Kalman::correct([[maybe_unused]] double timestep,
@@ -26,20 +32,22 @@ Eigen::VectorXd Kalman::correct([[maybe_unused]] double timestep,
                                 const Eigen::VectorXd& curState,
                                 double& measFitProb,
                                 const BayesCorrectParams* params) {
-    if (params != nullptr && !utilities:: instanceof
-        <BayesCorrectParams>(params)) {
-        throw exceptions::BadParams("Params must be BayesCorrectParams");
-    }
+    GNCPY_ALLOC_SCOPE("Kalman::correct");
+    GNCPY_TRACE_SCOPE("Kalman::correct");
+    const measurements::MeasParams* measParams =
+        params != nullptr ? params->measParams.get() : nullptr;
+    const measurements::IMeasModel& measObj = viewMeasurementModel();
 
-    Eigen::VectorXd estMeas =
-        measurementModel()->measure(curState, params->measParams.get());
-    Eigen::MatrixXd measMat =
-        measurementModel()->getMeasMat(curState, params->measParams.get());
+    Eigen::VectorXd estMeas = measObj.measure(curState, measParams);
+    Eigen::MatrixXd measMat = measObj.getMeasMat(curState, measParams);
 
-    Eigen::MatrixXd inovCov = measMat * viewCov() * measMat.transpose();
+    Eigen::MatrixXd inovCov = calcInovCov(measMat, viewCov());
 
-    Eigen::MatrixXd kalmanGain =
-        viewCov() * measMat.transpose() * inovCov.inverse();
+    Eigen::MatrixXd kalmanGain;
+    {
+        GNCPY_TRACE_SCOPE("Kalman::correct/inovInverse");
+        kalmanGain = viewCov() * measMat.transpose() * inovCov.inverse();
+    }
 
     Eigen::VectorXd inov = meas - estMeas;
     getCov() -= kalmanGain * measMat * viewCov();
@@ -49,6 +57,11 @@ Eigen::VectorXd Kalman::correct([[maybe_unused]] double timestep,
     return curState + kalmanGain * inov;
 }
 
+Eigen::MatrixXd Kalman::calcInovCov(const Eigen::MatrixXd& measMat,
+                                    const Eigen::MatrixXd& cov) const {
+    return measMat * cov * measMat.transpose();
+}
+
 void Kalman::setStateModel(std::shared_ptr<dynamics::IDynamics> dynObj,
                            Eigen::MatrixXd procNoise) {
     if (!dynObj || !utilities:: instanceof
@@ -105,4 +118,18 @@ inline std::shared_ptr<measurements::IMeasModel> Kalman::measurementModel()
     }
 }
 
+const measurements::IMeasModel& Kalman::viewMeasurementModel() const {
+    if (!m_measObj) {
+        throw exceptions::TypeError("Measurement model is unset");
+    }
+    return *m_measObj;
+}
+
+const dynamics::ILinearDynamics& Kalman::viewDynamicsModel() const {
+    if (!m_dynObj) {
+        throw exceptions::TypeError("Dynamics model is unset");
+    }
+    return *m_dynObj;
+}
+
 }  // namespace lager::gncpy::filters
@@ -0,0 +1,174 @@
+#include "gncpy/filters/KalmanBank.h"
+
+#include "gncpy/Exceptions.h"
+#include "gncpy/Utilities.h"
+#include "gncpy/utilities/Allocation.h"
+#include "gncpy/utilities/Trace.h"
+
+namespace lager::gncpy::filters {
+
+template <typename T>
+void KalmanBank<T>::setStateModel(std::shared_ptr<dynamics::IDynamics> dynObj,
+                                  const Eigen::MatrixXd& procNoise) {
+    if (!dynObj || !utilities:: instanceof
+        <dynamics::ILinearDynamics>(dynObj)) {
+        throw exceptions::TypeError(
+            "dynObj must be a derived class of ILinearDynamics");
+    }
+    if (procNoise.rows() != procNoise.cols()) {
+        throw exceptions::BadParams("Process noise must be square");
+    }
+    if (procNoise.rows() !=
+        static_cast<Eigen::Index>(dynObj->stateNames().size())) {
+        throw exceptions::BadParams(
+            "Process noise size does not match the dynamics model dimension");
+    }
+
+    m_dynObj = std::dynamic_pointer_cast<dynamics::ILinearDynamics>(dynObj);
+    m_procNoise = procNoise.cast<T>();
+}
+
+template <typename T>
+void KalmanBank<T>::setMeasurementModel(
+    std::shared_ptr<measurements::IMeasModel> measObj,
+    const Eigen::MatrixXd& measNoise) {
+    if (!measObj || !utilities:: instanceof
+        <measurements::ILinearMeasModel>(measObj)) {
+        throw exceptions::TypeError(
+            "measObj must be a derived class of ILinearMeasModel");
+    }
+    if (measNoise.rows() != measNoise.cols()) {
+        throw exceptions::BadParams("Measurement noise must be square");
+    }
+
+    m_measObj =
+        std::dynamic_pointer_cast<measurements::ILinearMeasModel>(measObj);
+    m_measNoise = measNoise.cast<T>();
+}
+
+template <typename T>
+void KalmanBank<T>::setTracks(const Eigen::Ref<const Matrix>& states,
+                              const Eigen::Ref<const Matrix>& covs) {
+    if (covs.rows() != states.rows() ||
+        covs.cols() != states.rows() * states.cols()) {
+        throw exceptions::BadParams(
+            "Covariances must be one square block per state column");
+    }
+    m_states = states;
+    m_covs = covs;
+}
+
+template <typename T>
+void KalmanBank<T>::predict(double timestep,
+                            const dynamics::StateTransParams* params) {
+    GNCPY_ALLOC_SCOPE("KalmanBank::predict");
+    GNCPY_TRACE_SCOPE("KalmanBank::predict");
+    m_stateMat =
+        viewDynamicsModel().getStateMat(timestep, params).template cast<T>();
+    const Eigen::Index n = stateDim();
+    if (m_stateMat.rows() != n || m_stateMat.cols() != n ||
+        m_procNoise.rows() != n) {
+        throw exceptions::BadParams(
+            "Dynamics model dimension does not match the tracks");
+    }
+
+    m_nextStates.noalias() = m_stateMat * m_states;
+    m_states.swap(m_nextStates);
+
+    // F P_i for every track at once, the transposed blocks are P_i F^T by
+    // symmetry so a second product gives F P_i F^T
+    m_work.noalias() = m_stateMat * m_covs;
+    for (Eigen::Index ii = 0; ii < numTracks(); ii++) {
+        m_covs.middleCols(ii * n, n) =
+            m_work.middleCols(ii * n, n).transpose();
+    }
+    m_work.noalias() = m_stateMat * m_covs;
+    m_covs.swap(m_work);
+    for (Eigen::Index ii = 0; ii < numTracks(); ii++) {
+        m_covs.middleCols(ii * n, n) += m_procNoise;
+    }
+}
+
+template <typename T>
+void KalmanBank<T>::correct([[maybe_unused]] double timestep,
+                            const Eigen::Ref<const Matrix>& meas,
+                            const measurements::MeasParams* params) {
+    GNCPY_ALLOC_SCOPE("KalmanBank::correct");
+    GNCPY_TRACE_SCOPE("KalmanBank::correct");
+    if (numTracks() == 0) {
+        return;
+    }
+    const measurements::ILinearMeasModel& measObj = viewMeasurementModel();
+    const Eigen::Index n = stateDim();
+
+    // linear models do not depend on the state, any track will do
+    m_modelState = m_states.col(0).template cast<double>();
+    m_measMat = measObj.getMeasMat(m_modelState, params).template cast<T>();
+    const Eigen::Index m = m_measMat.rows();
+    if (m_measMat.cols() != n || m_measNoise.rows() != m ||
+        meas.rows() != m || meas.cols() != numTracks()) {
+        throw exceptions::BadParams(
+            "Measurements do not match the measurement model and tracks");
+    }
+
+    m_inov = meas;
+    m_inov.noalias() -= m_measMat * m_states;
+
+    // H P_i for every track at once
+    m_measCovs.noalias() = m_measMat * m_covs;
+
+    // factorize every innovation covariance before touching any track, so
+    // a failure leaves the whole bank unchanged
+    m_inovFactors.resize(m, m * numTracks());
+    for (Eigen::Index ii = 0; ii < numTracks(); ii++) {
+        m_inovCov.noalias() =
+            m_measCovs.middleCols(ii * n, n) * m_measMat.transpose();
+        m_inovCov += m_measNoise;
+        m_llt.compute(m_inovCov);
+        if (m_llt.info() != Eigen::Success) {
+            throw exceptions::BadParams(
+                "Innovation covariance is not positive definite");
+        }
+        m_inovFactors.middleCols(ii * m, m) = m_llt.matrixL();
+    }
+
+    for (Eigen::Index ii = 0; ii < numTracks(); ii++) {
+        auto measCov = m_measCovs.middleCols(ii * n, n);
+        const auto factor = m_inovFactors.middleCols(ii * m, m)
+                                .template triangularView<Eigen::Lower>();
+
+        // K = P H^T S^-1, so K^T = S^-1 H P and the updates only need
+        // solves against S = L L^T
+        m_weightedInov = m_inov.col(ii);
+        factor.solveInPlace(m_weightedInov);
+        factor.transpose().solveInPlace(m_weightedInov);
+        m_states.col(ii).noalias() += measCov.transpose() * m_weightedInov;
+        m_weightedMeasCov = measCov;
+        factor.solveInPlace(m_weightedMeasCov);
+        factor.transpose().solveInPlace(m_weightedMeasCov);
+        m_covs.middleCols(ii * n, n).noalias() -=
+            measCov.transpose() * m_weightedMeasCov;
+    }
+}
+
+template <typename T>
+const dynamics::ILinearDynamics& KalmanBank<T>::viewDynamicsModel() const {
+    if (!m_dynObj) {
+        throw exceptions::TypeError("Dynamics model is unset");
+    }
+    return *m_dynObj;
+}
+
+template <typename T>
+const measurements::ILinearMeasModel& KalmanBank<T>::viewMeasurementModel()
+    const {
+    if (!m_measObj) {
+        throw exceptions::TypeError("Measurement model is unset");
+    }
+    return *m_measObj;
+}
+
+template class KalmanBank<float>;
+template class KalmanBank<double>;
+
+}  // namespace lager::gncpy::filters
@@ -0,0 +1,222 @@
+#include "gncpy/filters/OOSMKalman.h"
+
+#include <cmath>
+
+#include "gncpy/Exceptions.h"
+#include "gncpy/dynamics/ILinearDynamics.h"
+#include "gncpy/math/Math.h"
+
+namespace lager::gncpy::filters {
+
+namespace {
+
+const measurements::MeasParams* measParamsOf(const BayesCorrectParams* p) {
+    return p != nullptr ? p->measParams.get() : nullptr;
+}
+
+}  // namespace
+
+OOSMKalman::OOSMKalman(std::shared_ptr<Kalman> filter, size_t maxHistory)
+    : m_filter(filter), m_maxHistory(maxHistory) {
+    if (!m_filter) {
+        throw exceptions::TypeError("filter can not be nullptr");
+    }
+    if (m_maxHistory < 1) {
+        throw exceptions::BadParams("History must hold at least one step");
+    }
+}
+
+void OOSMKalman::initialize(double time, const Eigen::VectorXd& state) {
+    if (!m_filter) {
+        throw exceptions::TypeError("filter is unset");
+    }
+    Step step;
+    step.time = time;
+    step.predParams = std::make_shared<const BayesPredictParams>();
+    step.predState = state;
+    step.predCov = std::make_shared<const Eigen::MatrixXd>(m_filter->viewCov());
+    step.state = state;
+    step.cov = step.predCov;
+
+    m_history.clear();
+    m_history.push_back(std::move(step));
+}
+
+const Eigen::VectorXd& OOSMKalman::predict(
+    double timestep, std::shared_ptr<const BayesPredictParams> params) {
+    if (m_history.empty()) {
+        throw exceptions::TypeError("OOSMKalman must be initialized first");
+    }
+    if (timestep <= m_history.back().time) {
+        throw exceptions::BadParams(
+            "Prediction time must be after the current step");
+    }
+    const Step& prev = m_history.back();
+
+    Step step;
+    step.time = timestep;
+    step.predParams =
+        params ? params : std::make_shared<const BayesPredictParams>();
+
+    m_filter->getCov() = *prev.cov;
+    step.predState = m_filter->predict(prev.time, prev.state, std::nullopt,
+                                       step.predParams.get());
+    step.predCov = std::make_shared<const Eigen::MatrixXd>(m_filter->viewCov());
+    step.state = step.predState;
+    step.cov = step.predCov;
+
+    m_history.push_back(std::move(step));
+    while (m_history.size() > m_maxHistory) {
+        m_history.pop_front();
+    }
+
+    return m_history.back().state;
+}
+
+const Eigen::VectorXd& OOSMKalman::correct(
+    double timestep, const Eigen::VectorXd& meas, double& measFitProb,
+    std::shared_ptr<const BayesCorrectParams> params) {
+    if (m_history.empty()) {
+        throw exceptions::TypeError("OOSMKalman must be initialized first");
+    }
+    if (timestep > m_history.back().time + timeTolerance) {
+        throw exceptions::BadParams(
+            "Measurement is newer than the current step, predict first");
+    }
+
+    size_t stepInd = m_history.size();
+    while (stepInd > 0) {
+        stepInd--;
+        if (std::abs(m_history[stepInd].time - timestep) <= timeTolerance) {
+            break;
+        }
+        if (m_history[stepInd].time < timestep || stepInd == 0) {
+            throw exceptions::BadParams(
+                "Measurement time does not match a step in the history");
+        }
+    }
+
+    Measurement m{meas, params ? params
+                               : std::make_shared<const BayesCorrectParams>()};
+
+    const size_t last = m_history.size() - 1;
+    if (stepInd == last) {
+        applyMeas(m_history[last], m, measFitProb);
+        m_history[last].meas.push_back(std::move(m));
+    } else if (!(useRetrodiction && stepInd + 1 == last &&
+                 retrodict(stepInd, m, measFitProb))) {
+        m_history[stepInd].meas.push_back(std::move(m));
+        replay(stepInd, measFitProb);
+        m_numRollbacks++;
+    }
+
+    return m_history.back().state;
+}
+
+void OOSMKalman::applyMeas(Step& step, const Measurement& m,
+                           double& measFitProb) {
+    m_filter->getCov() = *step.cov;
+    step.state = m_filter->correct(step.time, m.meas, step.state, measFitProb,
+                                   m.params.get());
+    step.cov = std::make_shared<const Eigen::MatrixXd>(m_filter->viewCov());
+}
+
+bool OOSMKalman::retrodict(size_t stepInd, const Measurement& lateMeas,
+                           double& measFitProb) {
+    Step& sk = m_history[stepInd + 1];
+    Step& sd = m_history[stepInd];
+    auto linDyn = std::dynamic_pointer_cast<dynamics::ILinearDynamics>(
+        m_filter->dynamicsModel());
+    // the snapshot at d must not hold an earlier retrodicted measurement,
+    // the cross covariances below only account for the measurements at k
+    if (!linDyn || sk.meas.size() > 1 || !sd.complete) {
+        return false;
+    }
+    auto measObj = m_filter->measurementModel();
+
+    Eigen::MatrixXd stateMat = linDyn->getStateMat(
+        sd.time, sk.predParams->stateTransParams.get());
+    Eigen::PartialPivLU<Eigen::MatrixXd> stateLu(stateMat);
+    const Eigen::MatrixXd& procNoise = m_filter->processNoise();
+    const Eigen::MatrixXd& covKK = *sk.cov;
+
+    // cross covariances between the state at k and the process noise from d
+    // to k, see algorithm A1
+    Eigen::MatrixXd covXV = procNoise;
+    Eigen::MatrixXd covVV = procNoise;
+    Eigen::VectorXd retroState = sk.state;
+    if (sk.meas.size() == 1) {
+        const auto* params = measParamsOf(sk.meas[0].params.get());
+        Eigen::MatrixXd measMat = measObj->getMeasMat(sk.predState, params);
+        Eigen::PartialPivLU<Eigen::MatrixXd> inovLu(
+            m_filter->calcInovCov(measMat, *sk.predCov));
+        Eigen::VectorXd inov =
+            sk.meas[0].meas - measObj->measure(sk.predState, params);
+        Eigen::MatrixXd gainTerm = inovLu.solve(measMat) * procNoise;
+
+        covXV -= *sk.predCov * measMat.transpose() * gainTerm;
+        covVV -= procNoise * measMat.transpose() * gainTerm;
+        retroState -= procNoise * measMat.transpose() * inovLu.solve(inov);
+    }
+
+    Eigen::MatrixXd retroMat = stateLu.inverse();
+    retroState = retroMat * retroState;
+    Eigen::MatrixXd retroCov = retroMat *
+                               (covKK + covVV - covXV - covXV.transpose()) *
+                               retroMat.transpose();
+
+    const auto* params = measParamsOf(lateMeas.params.get());
+    Eigen::MatrixXd measMat = measObj->getMeasMat(retroState, params);
+    Eigen::VectorXd estMeas = measObj->measure(retroState, params);
+    Eigen::MatrixXd inovCov = m_filter->calcInovCov(measMat, retroCov);
+    Eigen::MatrixXd crossCov =
+        (covKK - covXV) * retroMat.transpose() * measMat.transpose();
+    Eigen::MatrixXd gain =
+        inovCov.partialPivLu().solve(crossCov.transpose()).transpose();
+
+    sk.state += gain * (lateMeas.meas - estMeas);
+    sk.cov = std::make_shared<const Eigen::MatrixXd>(
+        covKK - gain * crossCov.transpose());
+    measFitProb = math::calcGaussianPDF(lateMeas.meas, estMeas, inovCov);
+
+    // the snapshot at d does not include this measurement, a later roll back
+    // must start before it
+    sd.meas.push_back(lateMeas);
+    sd.complete = false;
+    m_numRetrodictions++;
+
+    return true;
+}
+
+void OOSMKalman::replay(size_t stepInd, double& measFitProb) {
+    size_t start = stepInd;
+    while (start > 0 && !m_history[start].complete) {
+        start--;
+    }
+
+    for (size_t ii = start; ii < m_history.size(); ii++) {
+        Step& step = m_history[ii];
+        if (ii > start) {
+            const Step& prev = m_history[ii - 1];
+            m_filter->getCov() = *prev.cov;
+            step.predState = m_filter->predict(prev.time, prev.state,
+                                               std::nullopt,
+                                               step.predParams.get());
+            step.predCov =
+                std::make_shared<const Eigen::MatrixXd>(m_filter->viewCov());
+        }
+        step.state = step.predState;
+        step.cov = step.predCov;
+
+        double prob = 0.0;
+        for (const auto& m : step.meas) {
+            applyMeas(step, m, prob);
+        }
+        if (ii == stepInd) {
+            measFitProb = prob;
+        }
+        step.complete = true;
+    }
+}
+
+}  // namespace lager::gncpy::filters
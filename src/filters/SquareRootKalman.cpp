@@ -0,0 +1,231 @@
+#include "gncpy/filters/SquareRootKalman.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "gncpy/Exceptions.h"
+#include "gncpy/Utilities.h"
+#include "gncpy/dynamics/ILinearDynamics.h"
+#include "gncpy/measurements/ILinearMeasModel.h"
+#include "gncpy/utilities/Allocation.h"
+#include "gncpy/utilities/Trace.h"
+
+namespace lager::gncpy::filters {
+
+namespace {
+
+// lower triangular L with L L^T = A A^T, found from the QR decomposition of
+// the transposed (wide) array A
+Eigen::MatrixXd triangularize(const Eigen::MatrixXd& arr) {
+    Eigen::HouseholderQR<Eigen::MatrixXd> qr(arr.transpose());
+    return qr.matrixQR()
+        .topRows(arr.rows())
+        .triangularView<Eigen::Upper>()
+        .transpose();
+}
+
+}  // namespace
+
+Eigen::VectorXd SquareRootKalman::predict(
+    double timestep, const Eigen::VectorXd& curState,
+    [[maybe_unused]] const std::optional<Eigen::VectorXd> controlInput,
+    const BayesPredictParams* params) {
+    GNCPY_ALLOC_SCOPE("SquareRootKalman::predict");
+    GNCPY_TRACE_SCOPE("SquareRootKalman::predict");
+    Eigen::MatrixXd stateMat;
+    {
+        GNCPY_TRACE_SCOPE("SquareRootKalman::predict/getStateMat");
+        stateMat = getStateMat(timestep, curState, params);
+    }
+    const Eigen::MatrixXd& sqrtCov = viewSqrtCov();
+
+    Eigen::MatrixXd arr(sqrtCov.rows(),
+                        sqrtCov.cols() + m_sqrtProcNoise.cols());
+    arr << stateMat * sqrtCov, m_sqrtProcNoise;
+    {
+        GNCPY_TRACE_SCOPE("SquareRootKalman::predict/triangularize");
+        getSqrtCov() = triangularize(arr);
+    }
+
+    return dynamicsModel()->propagateState(
+        timestep, curState,
+        params != nullptr ? params->stateTransParams.get() : nullptr);
+}
+
+Eigen::VectorXd SquareRootKalman::correct([[maybe_unused]] double timestep,
+                                          const Eigen::VectorXd& meas,
+                                          const Eigen::VectorXd& curState,
+                                          double& measFitProb,
+                                          const BayesCorrectParams* params) {
+    GNCPY_ALLOC_SCOPE("SquareRootKalman::correct");
+    GNCPY_TRACE_SCOPE("SquareRootKalman::correct");
+    const measurements::MeasParams* measParams =
+        params != nullptr ? params->measParams.get() : nullptr;
+    Eigen::VectorXd estMeas = measurementModel()->measure(curState, measParams);
+    Eigen::MatrixXd measMat =
+        measurementModel()->getMeasMat(curState, measParams);
+
+    const Eigen::Index n = curState.size();
+    const Eigen::Index m = estMeas.size();
+    if (m != m_sqrtMeasNoise.rows()) {
+        throw exceptions::BadParams(
+            "Measurement size does not match the measurement noise");
+    }
+    const Eigen::MatrixXd& sqrtCov = viewSqrtCov();
+
+    // pre-array [R^1/2, H S; 0, S] is triangularized into
+    // [Se, 0; P H^T Se^-T, S+] where Se Se^T is the innovation covariance
+    Eigen::MatrixXd arr = Eigen::MatrixXd::Zero(m + n, m + n);
+    arr.topLeftCorner(m, m) = m_sqrtMeasNoise;
+    arr.topRightCorner(m, n) = measMat * sqrtCov;
+    arr.bottomRightCorner(n, n) = sqrtCov;
+    Eigen::MatrixXd post;
+    {
+        GNCPY_TRACE_SCOPE("SquareRootKalman::correct/triangularize");
+        post = triangularize(arr);
+    }
+
+    auto sqrtInovCov = post.topLeftCorner(m, m).triangularView<Eigen::Lower>();
+    Eigen::VectorXd whitened = sqrtInovCov.solve(meas - estMeas);
+
+    double logDet = 0.0;
+    for (Eigen::Index ii = 0; ii < m; ii++) {
+        logDet += std::log(std::abs(post(ii, ii)));
+    }
+    measFitProb = std::exp(-0.5 * whitened.squaredNorm() - logDet -
+                           0.5 * m * std::log(2.0 * M_PI));
+
+    getSqrtCov() = post.bottomRightCorner(n, n);
+    return curState + post.bottomLeftCorner(n, m) * whitened;
+}
+
+void SquareRootKalman::setStateModel(
+    std::shared_ptr<dynamics::IDynamics> dynObj, Eigen::MatrixXd procNoise) {
+    if (!dynObj || !utilities:: instanceof
+        <dynamics::ILinearDynamics>(dynObj)) {
+        throw exceptions::TypeError(
+            "dynObj must be a derived class of ILinearDynamics");
+    }
+    setModels(dynObj, procNoise);
+}
+
+void SquareRootKalman::setMeasurementModel(
+    std::shared_ptr<measurements::IMeasModel> measObj,
+    Eigen::MatrixXd measNoise) {
+    if (!measObj || !utilities:: instanceof
+        <measurements::ILinearMeasModel>(measObj)) {
+        throw exceptions::TypeError(
+            "measObj must be a derived class of ILinearMeasModel");
+    }
+    setMeasModel(measObj, measNoise);
+}
+
+void SquareRootKalman::setModels(std::shared_ptr<dynamics::IDynamics> dynObj,
+                                 Eigen::MatrixXd procNoise) {
+    if (!dynObj) {
+        throw exceptions::TypeError("dynObj can not be nullptr");
+    }
+    if (procNoise.rows() != procNoise.cols()) {
+        throw exceptions::BadParams("Process noise must be square");
+    }
+    if (procNoise.rows() !=
+        static_cast<long int>(dynObj->stateNames().size())) {
+        throw exceptions::BadParams(
+            "Process nosie size does not match they dynamics model "
+            "dimension");
+    }
+
+    // process noise is often singular so use a pivoted LDL^T factor, only
+    // Q = L L^T matters here not the shape of L
+    Eigen::LDLT<Eigen::MatrixXd> ldlt(procNoise);
+    Eigen::VectorXd diag = ldlt.vectorD();
+    if (ldlt.info() != Eigen::Success ||
+        diag.minCoeff() < -1e-12 * std::max(1.0, diag.maxCoeff())) {
+        throw exceptions::BadParams(
+            "Process noise must be positive semi-definite");
+    }
+    Eigen::MatrixXd lower = ldlt.matrixL();
+    lower *= diag.cwiseMax(0.0).cwiseSqrt().asDiagonal();
+
+    m_dynObj = dynObj;
+    m_sqrtProcNoise = ldlt.transpositionsP().transpose() * lower;
+}
+
+void SquareRootKalman::setMeasModel(
+    std::shared_ptr<measurements::IMeasModel> measObj,
+    Eigen::MatrixXd measNoise) {
+    if (!measObj) {
+        throw exceptions::TypeError("measObj is required");
+    }
+    if (measNoise.rows() != measNoise.cols()) {
+        throw exceptions::BadParams("Measurement noise must be square");
+    }
+    Eigen::LLT<Eigen::MatrixXd> llt(measNoise);
+    if (llt.info() != Eigen::Success) {
+        throw exceptions::BadParams(
+            "Measurement noise must be positive definite");
+    }
+
+    m_measObj = measObj;
+    m_sqrtMeasNoise = llt.matrixL();
+}
+
+Eigen::MatrixXd SquareRootKalman::getStateMat(
+    double timestep, [[maybe_unused]] const Eigen::VectorXd& curState,
+    const BayesPredictParams* params) const {
+    return std::static_pointer_cast<dynamics::ILinearDynamics>(dynamicsModel())
+        ->getStateMat(timestep, params != nullptr
+                                    ? params->stateTransParams.get()
+                                    : nullptr);
+}
+
+std::shared_ptr<dynamics::IDynamics> SquareRootKalman::dynamicsModel() const {
+    if (m_dynObj) {
+        return m_dynObj;
+    } else {
+        throw exceptions::TypeError("Dynamics model is unset");
+    }
+}
+
+std::shared_ptr<measurements::IMeasModel> SquareRootKalman::measurementModel()
+    const {
+    if (m_measObj) {
+        return m_measObj;
+    } else {
+        throw exceptions::TypeError("Measurement model is unset");
+    }
+}
+
+Eigen::MatrixXd& SquareRootKalman::getCov() {
+    viewCov();
+    m_sqrtCovValid = false;
+    return IBayesFilter::getCov();
+}
+
+const Eigen::MatrixXd& SquareRootKalman::viewCov() {
+    if (!m_covValid) {
+        IBayesFilter::getCov() = m_sqrtCov * m_sqrtCov.transpose();
+        m_covValid = true;
+    }
+    return IBayesFilter::viewCov();
+}
+
+Eigen::MatrixXd& SquareRootKalman::getSqrtCov() {
+    viewSqrtCov();
+    m_covValid = false;
+    return m_sqrtCov;
+}
+
+const Eigen::MatrixXd& SquareRootKalman::viewSqrtCov() {
+    if (!m_sqrtCovValid) {
+        Eigen::LLT<Eigen::MatrixXd> llt(IBayesFilter::viewCov());
+        if (llt.info() != Eigen::Success) {
+            throw exceptions::BadParams("Covariance must be positive definite");
+        }
+        m_sqrtCov = llt.matrixL();
+        m_sqrtCovValid = true;
+    }
+    return m_sqrtCov;
+}
+
+}  // namespace lager::gncpy::filters
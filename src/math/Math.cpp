@@ -1,5 +1,13 @@
 #include "gncpy/math/Math.h"
 
+#include <algorithm>
+#include <limits>
+#include <string>
+
+#include "gncpy/Exceptions.h"
+#include "gncpy/utilities/Allocation.h"
+#include "gncpy/utilities/Trace.h"
+
 namespace lager::gncpy::math {
 
 Eigen::VectorXd getGradient(
@@ -28,6 +36,7 @@ Eigen::VectorXd getGradient(
 Eigen::MatrixXd getJacobian(
     const Eigen::VectorXd& x,
     const std::vector<std::function<double(const Eigen::VectorXd&)>>& fncLst) {
+    GNCPY_TRACE_SCOPE("math::getJacobian");
     Eigen::MatrixXd out(fncLst.size(), x.size());
     size_t row = 0;
     size_t col = 0;
@@ -47,6 +56,7 @@ Eigen::MatrixXd getJacobian(
     const Eigen::VectorXd& x,
     std::function<Eigen::VectorXd(const Eigen::VectorXd&)> const& fnc,
     size_t numFunOutputs) {
+    GNCPY_TRACE_SCOPE("math::getJacobian");
     Eigen::MatrixXd out(numFunOutputs, x.size());
     size_t col = 0;
 
@@ -64,8 +74,33 @@ Eigen::MatrixXd getJacobian(
     return out;
 }
 
+void checkJacobian(const Eigen::MatrixXd& analytic,
+                   const Eigen::MatrixXd& numerical, const char* name,
+                   double tol) {
+    if (analytic.rows() != numerical.rows() ||
+        analytic.cols() != numerical.cols()) {
+        throw exceptions::BadParams((std::string("Analytic Jacobian of ") +
+                                     name + " has the wrong size")
+                                        .c_str());
+    }
+    if (analytic.size() == 0) {
+        return;
+    }
+    const double scale = std::max(1.0, numerical.cwiseAbs().maxCoeff());
+    const double err = (analytic - numerical).cwiseAbs().maxCoeff();
+    if (!(err <= tol * scale)) {
+        throw exceptions::BadParams(
+            (std::string("Analytic Jacobian of ") + name +
+             " does not match the numerical Jacobian, max error " +
+             std::to_string(err))
+                .c_str());
+    }
+}
+
 double calcGaussianPDF(const Eigen::VectorXd& x, const Eigen::VectorXd& m,
                        const Eigen::MatrixXd& cov) {
+    GNCPY_ALLOC_SCOPE("math::calcGaussianPDF");
+    GNCPY_TRACE_SCOPE("math::calcGaussianPDF");
     size_t nDim = x.size();
     double val;
     if (nDim > 1) {
@@ -81,4 +116,97 @@ double calcGaussianPDF(const Eigen::VectorXd& x, const Eigen::VectorXd& m,
     return std::exp(val);
 }
 
+namespace {
+
+// regularized lower incomplete gamma function P(a, x), Numerical Recipes
+// series below a + 1 and Lentz continued fraction above
+double regularizedGammaP(double a, double x) {
+    const double eps = 1e-15;
+    const int maxIter = 100000;
+    if (x <= 0.0) {
+        return 0.0;
+    }
+    const double logPre = a * std::log(x) - x - std::lgamma(a);
+    if (x < a + 1.0) {
+        double ap = a;
+        double del = 1.0 / a;
+        double sum = del;
+        for (int ii = 0; ii < maxIter; ii++) {
+            ap += 1.0;
+            del *= x / ap;
+            sum += del;
+            if (std::abs(del) < std::abs(sum) * eps) {
+                break;
+            }
+        }
+        return sum * std::exp(logPre);
+    }
+
+    const double tiny = 1e-300;
+    double b = x + 1.0 - a;
+    double c = 1.0 / tiny;
+    double d = 1.0 / b;
+    double h = d;
+    for (int ii = 1; ii < maxIter; ii++) {
+        const double an = -ii * (ii - a);
+        b += 2.0;
+        d = an * d + b;
+        if (std::abs(d) < tiny) {
+            d = tiny;
+        }
+        c = b + an / c;
+        if (std::abs(c) < tiny) {
+            c = tiny;
+        }
+        d = 1.0 / d;
+        const double del = d * c;
+        h *= del;
+        if (std::abs(del - 1.0) < eps) {
+            break;
+        }
+    }
+    return 1.0 - std::exp(logPre) * h;
+}
+
+}  // namespace
+
+double chiSquareCDF(double x, double dof) {
+    if (dof <= 0.0) {
+        throw exceptions::BadParams("Degrees of freedom must be positive");
+    }
+    return regularizedGammaP(0.5 * dof, 0.5 * x);
+}
+
+double chiSquareQuantile(double prob, double dof) {
+    if (dof <= 0.0) {
+        throw exceptions::BadParams("Degrees of freedom must be positive");
+    }
+    if (prob < 0.0 || prob > 1.0) {
+        throw exceptions::BadParams("Probability must be in [0, 1]");
+    }
+    if (prob == 0.0) {
+        return 0.0;
+    }
+    if (prob == 1.0) {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    // bracket the quantile then bisect, the CDF is monotonic
+    double lo = 0.0;
+    double hi = std::max(1.0, dof);
+    while (chiSquareCDF(hi, dof) < prob) {
+        lo = hi;
+        hi *= 2.0;
+    }
+    for (int ii = 0; ii < 200 && hi - lo > 1e-12 * hi; ii++) {
+        const double mid = 0.5 * (lo + hi);
+        if (chiSquareCDF(mid, dof) < prob) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    return 0.5 * (lo + hi);
+}
+
 }  // namespace lager::gncpy::math
@@ -4,7 +4,15 @@
 
 namespace lager::gncpy::matrix {
 
-template class Matrix<float>;
-template class Matrix<double>;
+// the common state sizes are compiled once here, other sizes are
+// instantiated where they are used
+template class Matrix<float, 2, 2>;
+template class Matrix<float, 3, 3>;
+template class Matrix<float, 4, 4>;
+template class Matrix<float, 6, 6>;
+template class Matrix<double, 2, 2>;
+template class Matrix<double, 3, 3>;
+template class Matrix<double, 4, 4>;
+template class Matrix<double, 6, 6>;
 
 }  // namespace lager::gncpy::matrix
@@ -2,7 +2,13 @@
 
 namespace lager::gncpy::matrix {
 
-template class Vector<float>;
-template class Vector<double>;
+template class Vector<float, 2>;
+template class Vector<float, 3>;
+template class Vector<float, 4>;
+template class Vector<float, 6>;
+template class Vector<double, 2>;
+template class Vector<double, 3>;
+template class Vector<double, 4>;
+template class Vector<double, 6>;
 
 }  // namespace lager::gncpy::matrix
@@ -1,9 +1,12 @@
 #include "gncpy/measurements/ILinearMeasModel.h"
 
+#include "gncpy/utilities/Trace.h"
+
 namespace lager::gncpy::measurements {
 
 Eigen::VectorXd ILinearMeasModel::measure(const Eigen::VectorXd& state,
                                           const MeasParams* params) const {
+    GNCPY_TRACE_SCOPE("ILinearMeasModel::measure");
     return getMeasMat(state, params) * state;
 }
 
@@ -1,11 +1,15 @@
 #include "gncpy/measurements/INonLinearMeasModel.h"
 
+#include <utility>
+
 #include "gncpy/math/Math.h"
+#include "gncpy/utilities/Trace.h"
 
 namespace lager::gncpy::measurements {
 
 Eigen::VectorXd INonLinearMeasModel::measure(const Eigen::VectorXd& state,
                                              const MeasParams* params) const {
+    GNCPY_TRACE_SCOPE("INonLinearMeasModel::measure");
     Eigen::VectorXd out(getMeasFuncLst().size());
     size_t ind = 0;
     for (auto const& h : getMeasFuncLst(params)) {
@@ -16,6 +20,20 @@ Eigen::VectorXd INonLinearMeasModel::measure(const Eigen::VectorXd& state,
 }
 
 Eigen::MatrixXd INonLinearMeasModel::getMeasMat(
+    const Eigen::VectorXd& state, const MeasParams* params) const {
+    GNCPY_TRACE_SCOPE("INonLinearMeasModel::getMeasMat");
+    std::optional<Eigen::MatrixXd> analytic = analyticMeasMat(state, params);
+    if (!analytic) {
+        return getNumericalMeasMat(state, params);
+    }
+#ifdef GNCPY_CHECK_JACOBIANS
+    math::checkJacobian(*analytic, getNumericalMeasMat(state, params),
+                        "measurement model");
+#endif
+    return std::move(*analytic);
+}
+
+Eigen::MatrixXd INonLinearMeasModel::getNumericalMeasMat(
     const Eigen::VectorXd& state, const MeasParams* params) const {
     return math::getJacobian(state, getMeasFuncLst(params));
 }
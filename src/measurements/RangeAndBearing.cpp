@@ -1,48 +1,69 @@
 #include "gncpy/measurements/RangeAndBearing.h"
 
 #include "gncpy/Exceptions.h"
-#include "gncpy/Utilities.h"
 
 namespace lager::gncpy::measurements {
 
+Eigen::VectorXd RangeAndBearing::measure(const Eigen::VectorXd& state,
+                                         const MeasParams* params) const {
+    const RangeAndBearingParams& rbParams = castParams(params);
+    return Eigen::Vector2d(range(state, rbParams), bearing(state, rbParams));
+}
+
 std::vector<std::function<double(const Eigen::VectorXd&)>>
 RangeAndBearing::getMeasFuncLst(const MeasParams* params) const {
-    auto h1 = [this, params](const Eigen::VectorXd& x) {
-        return this->range(x, params);
+    // the parameters are checked once here and not by every evaluation
+    const RangeAndBearingParams& rbParams = castParams(params);
+    auto h1 = [&rbParams](const Eigen::VectorXd& x) {
+        return range(x, rbParams);
     };
-    auto h2 = [this, params](const Eigen::VectorXd& x) {
-        return this->bearing(x, params);
+    auto h2 = [&rbParams](const Eigen::VectorXd& x) {
+        return bearing(x, rbParams);
     };
     return std::vector<std::function<double(const Eigen::VectorXd&)>>({h1, h2});
 }
 
-double RangeAndBearing::range(const Eigen::VectorXd& state,
-                              const MeasParams* params) const {
-    if (!params) {
-        throw exceptions::BadParams("Range and Bearing requires parameters.");
+std::optional<Eigen::MatrixXd> RangeAndBearing::analyticMeasMat(
+    const Eigen::VectorXd& state, const MeasParams* params) const {
+    const RangeAndBearingParams& rbParams = castParams(params);
+    const double x = state(rbParams.xInd);
+    const double y = state(rbParams.yInd);
+    const double rangeSq = x * x + y * y;
+    if (rangeSq == 0.0) {
+        return std::nullopt;
     }
-    if (!utilities:: instanceof <RangeAndBearingParams>(params)) {
-        throw exceptions::BadParams(
-            "params type must be RangeAndBearingParams.");
-    }
-    auto ptr = dynamic_cast<const RangeAndBearingParams*>(params);
+    const double rng = sqrt(rangeSq);
 
-    return sqrt(state(ptr->xInd) * state(ptr->xInd) +
-                state(ptr->yInd) * state(ptr->yInd));
+    Eigen::MatrixXd out = Eigen::MatrixXd::Zero(2, state.size());
+    out(0, rbParams.xInd) = x / rng;
+    out(0, rbParams.yInd) = y / rng;
+    out(1, rbParams.xInd) = -y / rangeSq;
+    out(1, rbParams.yInd) = x / rangeSq;
+    return out;
 }
 
-double RangeAndBearing::bearing(const Eigen::VectorXd& state,
-                                const MeasParams* params) const {
+const RangeAndBearingParams& RangeAndBearing::castParams(
+    const MeasParams* params) {
     if (!params) {
         throw exceptions::BadParams("Range and Bearing requires parameters.");
     }
-    if (!utilities:: instanceof <RangeAndBearingParams>(params)) {
+    auto ptr = dynamic_cast<const RangeAndBearingParams*>(params);
+    if (!ptr) {
         throw exceptions::BadParams(
             "params type must be RangeAndBearingParams.");
     }
-    auto ptr = dynamic_cast<const RangeAndBearingParams*>(params);
+    return *ptr;
+}
 
-    return atan2(state(ptr->yInd), state(ptr->xInd));
+double RangeAndBearing::range(const Eigen::VectorXd& state,
+                              const RangeAndBearingParams& params) {
+    return sqrt(state(params.xInd) * state(params.xInd) +
+                state(params.yInd) * state(params.yInd));
+}
+
+double RangeAndBearing::bearing(const Eigen::VectorXd& state,
+                                const RangeAndBearingParams& params) {
+    return atan2(state(params.yInd), state(params.xInd));
 }
 
 }  // namespace lager::gncpy::measurements
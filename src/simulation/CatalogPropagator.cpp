@@ -0,0 +1,52 @@
+#include "gncpy/simulation/CatalogPropagator.h"
+
+#include "gncpy/utilities/Trace.h"
+
+namespace lager::gncpy::simulation {
+
+namespace {
+
+// smallest number of objects worth handing to a worker
+constexpr size_t MIN_CHUNK = 256;
+
+}  // namespace
+
+CatalogPropagator::CatalogPropagator(size_t numThreads) : m_pool(numThreads) {}
+
+void CatalogPropagator::propagate(const dynamics::TwoBodyJ2& dynObj,
+                                  double timestep,
+                                  Eigen::Ref<Eigen::MatrixXd> states,
+                                  size_t numSteps) {
+    GNCPY_TRACE_SCOPE("CatalogPropagator::propagate");
+    auto propagateRange = [&, timestep, numSteps](Eigen::Index start,
+                                                  Eigen::Index end) {
+        auto chunk = states.middleRows(start, end - start);
+        double time = timestep;
+        for (size_t step = 0; step < numSteps; step++) {
+            dynObj.propagateBatch(time, chunk);
+            time += dynObj.dt();
+        }
+    };
+    m_pool.parallelFor(states.rows(), MIN_CHUNK, propagateRange);
+}
+
+void CatalogPropagator::propagate(const dynamics::Keplerian& dynObj,
+                                  double timestep,
+                                  Eigen::Ref<Eigen::MatrixXd> states,
+                                  size_t numSteps) {
+    GNCPY_TRACE_SCOPE("CatalogPropagator::propagate");
+    auto propagateRange = [&, timestep, numSteps](Eigen::Index start,
+                                                  Eigen::Index end) {
+        auto chunk = states.middleRows(start, end - start);
+        const Eigen::VectorXd dts =
+            Eigen::VectorXd::Constant(end - start, dynObj.dt());
+        double time = timestep;
+        for (size_t step = 0; step < numSteps; step++) {
+            dynObj.propagateBatch(time, chunk, dts);
+            time += dynObj.dt();
+        }
+    };
+    m_pool.parallelFor(states.rows(), MIN_CHUNK, propagateRange);
+}
+
+}  // namespace lager::gncpy::simulation
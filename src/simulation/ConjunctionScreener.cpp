@@ -0,0 +1,370 @@
+#include "gncpy/simulation/ConjunctionScreener.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+
+#include "gncpy/Exceptions.h"
+#include "gncpy/dynamics/Keplerian.h"
+#include "gncpy/dynamics/TwoBodyJ2.h"
+#include "gncpy/utilities/Trace.h"
+
+namespace lager::gncpy::simulation {
+
+namespace {
+
+// smallest number of objects worth handing to a worker
+constexpr size_t MIN_CHUNK = 256;
+
+// halves the slice down to well below a microsecond for any sane slice
+constexpr int TCA_ITERS = 50;
+
+// largest magnitude of the velocity weights of the cubic Hermite basis
+constexpr double HERMITE_VEL_WEIGHT = 4.0 / 27.0;
+
+// reach classes each double the reach of the one below, the last one takes
+// everything faster
+constexpr int NUM_REACH_CLASSES = 32;
+
+using Cell = std::array<int64_t, 3>;
+
+struct CellHash {
+    size_t operator()(const Cell& cell) const noexcept {
+        return static_cast<size_t>(cell[0] * 73856093) ^
+               static_cast<size_t>(cell[1] * 19349663) ^
+               static_cast<size_t>(cell[2] * 83492791);
+    }
+};
+
+// relative position and velocity of a pair at both ends of a slice
+struct RelativeMotion {
+    Eigen::Vector3d p0;
+    Eigen::Vector3d v0;
+    Eigen::Vector3d p1;
+    Eigen::Vector3d v1;
+    double dt;
+
+    // cubic Hermite interpolation at a fraction of the slice
+    void at(double tau, Eigen::Vector3d& pos, Eigen::Vector3d& vel) const {
+        const double tau2 = tau * tau;
+        const double tau3 = tau2 * tau;
+        pos = (2.0 * tau3 - 3.0 * tau2 + 1.0) * p0 +
+              (tau3 - 2.0 * tau2 + tau) * dt * v0 +
+              (3.0 * tau2 - 2.0 * tau3) * p1 + (tau3 - tau2) * dt * v1;
+        vel = (6.0 * tau2 - 6.0 * tau) / dt * p0 +
+              (3.0 * tau2 - 4.0 * tau + 1.0) * v0 +
+              (6.0 * tau - 6.0 * tau2) / dt * p1 +
+              (3.0 * tau2 - 2.0 * tau) * v1;
+    }
+
+    double rangeRate(double tau) const {
+        Eigen::Vector3d pos;
+        Eigen::Vector3d vel;
+        at(tau, pos, vel);
+        return pos.dot(vel);
+    }
+};
+
+// Finds the closest approach inside the slice from the sign change of the
+// range rate. The window edges count when the pair is receding at the start
+// or still closing at the end.
+bool closestApproach(const RelativeMotion& rel, bool firstSlice,
+                     bool lastSlice, double& tau) {
+    const double start = rel.p0.dot(rel.v0);
+    const double end = rel.p1.dot(rel.v1);
+    if (start < 0.0 && end >= 0.0) {
+        double low = 0.0;
+        double high = 1.0;
+        for (int iter = 0; iter < TCA_ITERS; iter++) {
+            const double mid = 0.5 * (low + high);
+            if (rel.rangeRate(mid) < 0.0) {
+                low = mid;
+            } else {
+                high = mid;
+            }
+        }
+        tau = 0.5 * (low + high);
+        return true;
+    }
+    if (firstSlice && start >= 0.0) {
+        tau = 0.0;
+        return true;
+    }
+    if (lastSlice && end < 0.0) {
+        tau = 1.0;
+        return true;
+    }
+    return false;
+}
+
+int reachClass(double reach, double threshold) {
+    int cls = 0;
+    double bound = threshold;
+    while (cls + 1 < NUM_REACH_CLASSES && !(reach <= bound)) {
+        bound *= 2.0;
+        cls++;
+    }
+    return cls;
+}
+
+void sortByTime(std::vector<Conjunction>& found) {
+    std::sort(found.begin(), found.end(),
+              [](const Conjunction& lhs, const Conjunction& rhs) {
+                  if (lhs.time != rhs.time) {
+                      return lhs.time < rhs.time;
+                  }
+                  if (lhs.first != rhs.first) {
+                      return lhs.first < rhs.first;
+                  }
+                  return lhs.second < rhs.second;
+              });
+}
+
+}  // namespace
+
+ConjunctionScreener::ConjunctionScreener(double threshold, size_t numThreads)
+    : m_pool(numThreads) {
+    setThreshold(threshold);
+}
+
+void ConjunctionScreener::setThreshold(double threshold) {
+    if (threshold <= 0.0) {
+        throw exceptions::BadParams("Screening threshold must be positive");
+    }
+    m_threshold = threshold;
+}
+
+std::vector<Conjunction> ConjunctionScreener::screen(
+    const dynamics::IDynamics& dynObj, double startTime, double sliceDt,
+    const Eigen::MatrixXd& states, size_t numSlices) {
+    GNCPY_TRACE_SCOPE("ConjunctionScreener::screen");
+    if (states.cols() != 6) {
+        throw exceptions::BadParams(
+            "States must be [x, y, z, vx, vy, vz], one object per row");
+    }
+    if (sliceDt <= 0.0) {
+        throw exceptions::BadParams("Slice length must be positive");
+    }
+    // a model stepping by anything else would put the slices at wrong times
+    const std::optional<double> step = dynObj.fixedStep();
+    if (step && *step != sliceDt) {
+        throw exceptions::BadParams(
+            "Slice length must match the step of the dynamics");
+    }
+    std::vector<Conjunction> out;
+    if (states.rows() == 0 || numSlices == 0) {
+        return out;
+    }
+
+    // one slice per worker is propagated and screened at a time, the last
+    // entry of a block becomes the first of the next
+    const size_t blockSize = std::max<size_t>(m_pool.size(), 1);
+    std::vector<Eigen::MatrixXd> block(std::min(blockSize, numSlices) + 1,
+                                       Eigen::MatrixXd(states.rows(), 6));
+    block[0] = states;
+    for (size_t first = 0; first < numSlices; first += blockSize) {
+        const size_t count = std::min(blockSize, numSlices - first);
+        propagateBlock(dynObj, startTime, sliceDt, first, count, block);
+        screenBlock(block, count, first, numSlices, startTime, sliceDt, out);
+        std::swap(block[0], block[count]);
+    }
+    sortByTime(out);
+    return out;
+}
+
+void ConjunctionScreener::propagateBlock(const dynamics::IDynamics& dynObj,
+                                         double startTime, double sliceDt,
+                                         size_t firstSlice, size_t count,
+                                         std::vector<Eigen::MatrixXd>& block) {
+    const Eigen::Index num = block[0].rows();
+    const auto* twoBody = dynamic_cast<const dynamics::TwoBodyJ2*>(&dynObj);
+    const auto* kepler = dynamic_cast<const dynamics::Keplerian*>(&dynObj);
+
+    // every task owns a range of rows in each entry of the block
+    auto propagateRange = [&](Eigen::Index start, Eigen::Index end) {
+        Eigen::VectorXd state(6);
+        for (size_t kk = 0; kk < count; kk++) {
+            const double time =
+                startTime + static_cast<double>(firstSlice + kk) * sliceDt;
+            auto prev = block[kk].middleRows(start, end - start);
+            auto next = block[kk + 1].middleRows(start, end - start);
+            next = prev;
+            if (twoBody != nullptr) {
+                twoBody->propagateBatch(time, next);
+            } else if (kepler != nullptr) {
+                kepler->propagateBatch(time, next);
+            } else {
+                for (Eigen::Index ii = 0; ii < next.rows(); ii++) {
+                    state = prev.row(ii).transpose();
+                    next.row(ii) =
+                        dynObj.propagateState(time, state).transpose();
+                }
+            }
+        }
+    };
+
+    m_pool.parallelFor(num, MIN_CHUNK, propagateRange);
+}
+
+std::vector<Conjunction> ConjunctionScreener::screenEphemeris(
+    const std::vector<Eigen::MatrixXd>& ephemeris, double startTime,
+    double sliceDt) {
+    GNCPY_TRACE_SCOPE("ConjunctionScreener::screenEphemeris");
+    if (sliceDt <= 0.0) {
+        throw exceptions::BadParams("Slice length must be positive");
+    }
+    if (ephemeris.size() < 2) {
+        return {};
+    }
+    const Eigen::Index num = ephemeris[0].rows();
+    for (const Eigen::MatrixXd& entry : ephemeris) {
+        if (entry.rows() != num || entry.cols() != 6) {
+            throw exceptions::BadParams(
+                "Every ephemeris entry must hold the same 6 element states");
+        }
+    }
+    std::vector<Conjunction> out;
+    if (num == 0) {
+        return out;
+    }
+    const size_t numSlices = ephemeris.size() - 1;
+    screenBlock(ephemeris, numSlices, 0, numSlices, startTime, sliceDt, out);
+    sortByTime(out);
+    return out;
+}
+
+void ConjunctionScreener::screenBlock(
+    const std::vector<Eigen::MatrixXd>& block, size_t count,
+    size_t firstSlice, size_t numSlices, double startTime, double sliceDt,
+    std::vector<Conjunction>& out) {
+    const Eigen::Index num = block[0].rows();
+    const double thresholdSq = m_threshold * m_threshold;
+
+    auto screenSlice = [&](size_t kk, std::vector<Conjunction>& found) {
+        const size_t slice = firstSlice + kk;
+        const Eigen::MatrixXd& first = block[kk];
+        const Eigen::MatrixXd& second = block[kk + 1];
+
+        // bounds how far each object's interpolated path strays from its
+        // start, endpoint speeds alone miss a fast pass inside the slice
+        const Eigen::VectorXd reach =
+            (second.leftCols<3>() - first.leftCols<3>()).rowwise().norm() +
+            HERMITE_VEL_WEIGHT * sliceDt *
+                (first.rightCols<3>().rowwise().norm() +
+                 second.rightCols<3>().rowwise().norm());
+
+        // objects are hashed by reach class so a few fast movers do not
+        // widen the cells of every slow one
+        std::vector<int> classes(static_cast<size_t>(num));
+        std::array<double, NUM_REACH_CLASSES> classReach{};
+        for (Eigen::Index ii = 0; ii < num; ii++) {
+            const int cls = reachClass(reach(ii), m_threshold);
+            classes[static_cast<size_t>(ii)] = cls;
+            classReach[cls] = std::max(classReach[cls], reach(ii));
+        }
+        std::array<double, NUM_REACH_CLASSES> pads{};
+        for (int cls = 0; cls < NUM_REACH_CLASSES; cls++) {
+            pads[cls] = m_threshold + 2.0 * classReach[cls];
+        }
+        auto cellOf = [&](Eigen::Index ii, int cls) {
+            Cell cell;
+            for (int dd = 0; dd < 3; dd++) {
+                cell[dd] = static_cast<int64_t>(
+                    std::floor(first(ii, dd) / pads[cls]));
+            }
+            return cell;
+        };
+
+        std::array<std::unordered_map<Cell, std::vector<Eigen::Index>,
+                                      CellHash>,
+                   NUM_REACH_CLASSES>
+            grids;
+        for (Eigen::Index ii = 0; ii < num; ii++) {
+            const int cls = classes[static_cast<size_t>(ii)];
+            grids[cls][cellOf(ii, cls)].push_back(ii);
+        }
+
+        RelativeMotion rel;
+        rel.dt = sliceDt;
+        auto checkPair = [&](Eigen::Index ii, Eigen::Index jj) {
+            rel.p0 = (first.row(jj).head<3>() - first.row(ii).head<3>())
+                         .transpose();
+            const double pad = m_threshold + reach(ii) + reach(jj);
+            if (rel.p0.squaredNorm() > pad * pad) {
+                return;
+            }
+            rel.v0 = (first.row(jj).tail<3>() - first.row(ii).tail<3>())
+                         .transpose();
+            rel.p1 = (second.row(jj).head<3>() - second.row(ii).head<3>())
+                         .transpose();
+            rel.v1 = (second.row(jj).tail<3>() - second.row(ii).tail<3>())
+                         .transpose();
+
+            double tau;
+            if (!closestApproach(rel, slice == 0, slice + 1 == numSlices,
+                                 tau)) {
+                return;
+            }
+            Eigen::Vector3d pos;
+            Eigen::Vector3d vel;
+            rel.at(tau, pos, vel);
+            if (pos.squaredNorm() > thresholdSq) {
+                return;
+            }
+            Conjunction conj;
+            conj.first = ii;
+            conj.second = jj;
+            conj.time =
+                startTime + (static_cast<double>(slice) + tau) * sliceDt;
+            conj.distance = pos.norm();
+            conj.relativeSpeed = vel.norm();
+            found.push_back(conj);
+        };
+
+        // each pair is checked once, in the grid of the class with the
+        // larger reach, whose cells cover the padding of both objects
+        for (Eigen::Index ii = 0; ii < num; ii++) {
+            const int own = classes[static_cast<size_t>(ii)];
+            for (int cls = own; cls < NUM_REACH_CLASSES; cls++) {
+                if (grids[cls].empty()) {
+                    continue;
+                }
+                const Cell cell = cellOf(ii, cls);
+                for (int64_t dx = -1; dx <= 1; dx++) {
+                    for (int64_t dy = -1; dy <= 1; dy++) {
+                        for (int64_t dz = -1; dz <= 1; dz++) {
+                            auto it = grids[cls].find(Cell{
+                                cell[0] + dx, cell[1] + dy, cell[2] + dz});
+                            if (it == grids[cls].end()) {
+                                continue;
+                            }
+                            for (Eigen::Index jj : it->second) {
+                                if (cls != own || jj > ii) {
+                                    checkPair(std::min(ii, jj),
+                                              std::max(ii, jj));
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    };
+
+    std::vector<std::vector<Conjunction>> perSlice(count);
+    for (size_t kk = 0; kk < count; kk++) {
+        m_pool.submit([&screenSlice, &perSlice, kk]() {
+            screenSlice(kk, perSlice[kk]);
+        });
+    }
+    m_pool.wait();
+
+    for (const std::vector<Conjunction>& found : perSlice) {
+        out.insert(out.end(), found.begin(), found.end());
+    }
+}
+
+}  // namespace lager::gncpy::simulation
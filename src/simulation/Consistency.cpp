@@ -0,0 +1,90 @@
+#include "gncpy/simulation/Consistency.h"
+
+#include "gncpy/Exceptions.h"
+#include "gncpy/math/Math.h"
+
+namespace lager::gncpy::simulation {
+
+namespace {
+
+// smallest number of samples worth handing to a worker
+constexpr size_t MIN_CHUNK = 64;
+
+}  // namespace
+
+Consistency::Consistency(size_t numThreads) : m_pool(numThreads) {}
+
+Eigen::MatrixXd Consistency::normalizedSquares(const Eigen::MatrixXd& vecs,
+                                               const Eigen::MatrixXd& covs,
+                                               size_t numSteps) {
+    const Eigen::Index dim = vecs.rows();
+    const Eigen::Index num = vecs.cols();
+    if (covs.rows() != dim || covs.cols() != dim * num) {
+        throw exceptions::BadParams(
+            "Covariances must be stacked side by side, one per sample");
+    }
+    if (numSteps == 0 || num % static_cast<Eigen::Index>(numSteps) != 0) {
+        throw exceptions::BadParams(
+            "Number of samples must be a multiple of the number of steps");
+    }
+
+    // column i of a step by run matrix is sample i of the run major layout
+    Eigen::MatrixXd out(static_cast<Eigen::Index>(numSteps),
+                        num / static_cast<Eigen::Index>(numSteps));
+    double* outData = out.data();
+
+    auto solveRange = [&, dim](Eigen::Index start, Eigen::Index end) {
+        Eigen::LLT<Eigen::MatrixXd> llt(dim);
+        Eigen::VectorXd whitened(dim);
+        for (Eigen::Index ii = start; ii < end; ii++) {
+            llt.compute(covs.middleCols(ii * dim, dim));
+            if (llt.info() != Eigen::Success) {
+                throw exceptions::BadParams(
+                    "Covariance is not positive definite");
+            }
+            whitened = vecs.col(ii);
+            llt.matrixL().solveInPlace(whitened);
+            outData[ii] = whitened.squaredNorm();
+        }
+    };
+
+    m_pool.parallelFor(num, MIN_CHUNK, solveRange);
+
+    return out;
+}
+
+ConsistencyStats Consistency::evaluate(const Eigen::MatrixXd& values,
+                                       size_t dim, double confidence) {
+    if (values.size() == 0 || dim == 0) {
+        throw exceptions::BadParams("Values and dimension must be non-empty");
+    }
+    if (confidence <= 0.0 || confidence >= 1.0) {
+        throw exceptions::BadParams("Confidence must be in (0, 1)");
+    }
+    const double numRuns = static_cast<double>(values.cols());
+    const double numSamples = static_cast<double>(values.size());
+    const double lowProb = 0.5 * (1.0 - confidence);
+    const double highProb = 0.5 * (1.0 + confidence);
+
+    // the sum over N samples is chi-square with N * dim degrees of freedom
+    ConsistencyStats stats;
+    stats.mean = values.rowwise().mean();
+    const double runDof = numRuns * static_cast<double>(dim);
+    stats.lower = math::chiSquareQuantile(lowProb, runDof) / numRuns;
+    stats.upper = math::chiSquareQuantile(highProb, runDof) / numRuns;
+    stats.fractionInside =
+        static_cast<double>(
+            ((stats.mean.array() >= stats.lower) &&
+             (stats.mean.array() <= stats.upper))
+                .count()) /
+        static_cast<double>(stats.mean.size());
+
+    const double timeDof = numSamples * static_cast<double>(dim);
+    stats.timeAverage = values.mean();
+    stats.timeLower = math::chiSquareQuantile(lowProb, timeDof) / numSamples;
+    stats.timeUpper = math::chiSquareQuantile(highProb, timeDof) / numSamples;
+
+    return stats;
+}
+
+}  // namespace lager::gncpy::simulation
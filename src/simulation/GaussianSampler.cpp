@@ -0,0 +1,72 @@
+#include "gncpy/simulation/GaussianSampler.h"
+
+#include <utility>
+
+#include "gncpy/Exceptions.h"
+
+namespace lager::gncpy::simulation {
+
+GaussianSampler::GaussianSampler(const Eigen::MatrixXd& cov) {
+    setCovariance(cov);
+}
+
+GaussianSampler::GaussianSampler(Eigen::VectorXd mean,
+                                 const Eigen::MatrixXd& cov) {
+    setCovariance(cov);
+    setMean(std::move(mean));
+}
+
+void GaussianSampler::setCovariance(const Eigen::MatrixXd& cov) {
+    if (cov.rows() != cov.cols()) {
+        throw exceptions::BadParams("Covariance must be square");
+    }
+    Eigen::LLT<Eigen::MatrixXd> llt(cov);
+    if (llt.info() == Eigen::Success) {
+        m_factor = llt.matrixL();
+    } else {
+        // semi definite, S = P^T L sqrt(D)
+        Eigen::LDLT<Eigen::MatrixXd> ldlt(cov);
+        if (ldlt.info() != Eigen::Success || !ldlt.isPositive()) {
+            throw exceptions::BadParams(
+                "Covariance must be positive semi definite");
+        }
+        Eigen::MatrixXd lower = ldlt.matrixL();
+        m_factor =
+            ldlt.transpositionsP().transpose() *
+            (lower * ldlt.vectorD().cwiseMax(0.0).cwiseSqrt().asDiagonal());
+    }
+    if (m_mean.size() != cov.rows()) {
+        m_mean = Eigen::VectorXd::Zero(cov.rows());
+    }
+}
+
+void GaussianSampler::setMean(Eigen::VectorXd mean) {
+    if (mean.size() != m_factor.rows()) {
+        throw exceptions::BadParams("Mean does not match the covariance size");
+    }
+    m_mean = std::move(mean);
+}
+
+Eigen::VectorXd GaussianSampler::sample(Philox& rng) const {
+    Eigen::VectorXd out = m_mean;
+    addNoise(rng, out);
+    return out;
+}
+
+Eigen::MatrixXd GaussianSampler::sample(Philox& rng, Eigen::Index num) const {
+    Eigen::MatrixXd out = m_mean.replicate(1, num);
+    addNoise(rng, out);
+    return out;
+}
+
+void GaussianSampler::addNoise(Philox& rng,
+                               Eigen::Ref<Eigen::MatrixXd> vals) const {
+    if (vals.rows() != m_factor.rows()) {
+        throw exceptions::BadParams("Values do not match the sampler size");
+    }
+    Eigen::MatrixXd normals(vals.rows(), vals.cols());
+    rng.fillNormal(normals.data(), static_cast<size_t>(normals.size()));
+    vals.noalias() += m_factor * normals;
+}
+
+}  // namespace lager::gncpy::simulation
@@ -0,0 +1,161 @@
+#include "gncpy/simulation/MonteCarlo.h"
+
+#include <cmath>
+#include <optional>
+#include <utility>
+
+#include "gncpy/Exceptions.h"
+#include "gncpy/simulation/GaussianSampler.h"
+#include "gncpy/simulation/Random.h"
+
+namespace lager::gncpy::simulation {
+
+Eigen::VectorXd MonteCarloResult::rmse(size_t step) const {
+    Eigen::VectorXd sumSq = Eigen::VectorXd::Zero(m_errors.rows());
+    for (size_t run = 0; run < m_numRuns; run++) {
+        sumSq += error(run, step).cwiseAbs2();
+    }
+    return (sumSq / static_cast<double>(m_numRuns)).cwiseSqrt();
+}
+
+MonteCarlo::MonteCarlo(size_t numThreads) : m_pool(numThreads) {}
+
+void MonteCarlo::setTruthModel(std::shared_ptr<dynamics::IDynamics> dynObj,
+                               Eigen::MatrixXd procNoise) {
+    if (!dynObj) {
+        throw exceptions::TypeError("dynObj can not be nullptr");
+    }
+    m_dynObj = dynObj;
+    m_procNoise = std::move(procNoise);
+}
+
+void MonteCarlo::setMeasurementModel(
+    std::shared_ptr<measurements::IMeasModel> measObj,
+    Eigen::MatrixXd measNoise) {
+    if (!measObj) {
+        throw exceptions::TypeError("measObj can not be nullptr");
+    }
+    m_measObj = measObj;
+    m_measNoise = std::move(measNoise);
+}
+
+void MonteCarlo::setFilterFactory(FilterFactory factory) {
+    m_factory = std::move(factory);
+}
+
+void MonteCarlo::setInitialConditions(Eigen::VectorXd state,
+                                      Eigen::MatrixXd cov) {
+    if (cov.rows() != state.size() || cov.cols() != state.size()) {
+        throw exceptions::BadParams(
+            "Initial covariance does not match the state size");
+    }
+    m_initState = std::move(state);
+    m_initCov = std::move(cov);
+}
+
+void MonteCarlo::setPredictParams(
+    std::shared_ptr<filters::BayesPredictParams> params) {
+    m_predParams = params;
+}
+
+void MonteCarlo::setCorrectParams(
+    std::shared_ptr<filters::BayesCorrectParams> params) {
+    m_corrParams = params;
+}
+
+MonteCarloResult MonteCarlo::run(size_t numRuns, size_t numSteps, double dt,
+                                 uint64_t seed, double startTime) {
+    if (!m_dynObj || !m_measObj || !m_factory) {
+        throw exceptions::TypeError(
+            "Truth model, measurement model, and filter factory must be set");
+    }
+    if (m_initState.size() == 0) {
+        throw exceptions::BadParams("Initial conditions must be set");
+    }
+    const Eigen::Index stateDim = m_initState.size();
+    if (m_procNoise.rows() != stateDim) {
+        throw exceptions::BadParams(
+            "Process noise does not match the state size");
+    }
+
+    const GaussianSampler initSampler(m_initState, m_initCov);
+    const GaussianSampler procSampler(m_procNoise);
+    const GaussianSampler measSampler(m_measNoise);
+
+    MonteCarloResult res;
+    res.m_numRuns = numRuns;
+    res.m_numSteps = numSteps;
+    res.m_times.resize(numSteps);
+    for (size_t step = 0; step < numSteps; step++) {
+        res.m_times[step] = startTime + static_cast<double>(step + 1) * dt;
+    }
+    res.m_errors.resize(stateDim, numRuns * numSteps);
+    res.m_nees.resize(numSteps, numRuns);
+    res.m_nis.resize(numSteps, numRuns);
+
+    const dynamics::StateTransParams* stateTransParams =
+        m_predParams ? m_predParams->stateTransParams.get() : nullptr;
+    const measurements::MeasParams* measParams =
+        m_corrParams ? m_corrParams->measParams.get() : nullptr;
+
+    auto runOne = [&, this](size_t run) {
+        Philox rng(seed, run);
+        std::unique_ptr<filters::IBayesFilter> filt = m_factory();
+        if (!filt) {
+            throw exceptions::TypeError("Filter factory returned nullptr");
+        }
+        filt->getCov() = m_initCov;
+
+        // NIS describes the filter under test, which may not use the truth
+        // measurement model
+        const std::shared_ptr<measurements::IMeasModel> filtMeasObj =
+            filt->measurementModel();
+        const Eigen::MatrixXd filtMeasNoise = filt->measurementNoise();
+
+        Eigen::VectorXd truth = initSampler.sample(rng);
+        Eigen::VectorXd est = m_initState;
+
+        double time = startTime;
+        double measFitProb;
+        for (size_t step = 0; step < numSteps; step++) {
+            truth = m_dynObj->propagateState(time, truth, stateTransParams);
+            procSampler.addNoise(rng, truth);
+
+            Eigen::VectorXd meas = m_measObj->measure(truth, measParams);
+            if (meas.size() != measSampler.dim()) {
+                throw exceptions::BadParams(
+                    "Measurement noise does not match the measurement size");
+            }
+            measSampler.addNoise(rng, meas);
+
+            est = filt->predict(time, est, std::nullopt, m_predParams.get());
+            time = res.m_times[step];
+
+            const Eigen::MatrixXd measMat =
+                filtMeasObj->getMeasMat(est, measParams);
+            const Eigen::MatrixXd inovCov =
+                measMat * filt->viewCov() * measMat.transpose() +
+                filtMeasNoise;
+            const Eigen::VectorXd inov =
+                meas - filtMeasObj->measure(est, measParams);
+            res.m_nis(step, run) = inov.dot(inovCov.ldlt().solve(inov));
+
+            est = filt->correct(time, meas, est, measFitProb,
+                                m_corrParams.get());
+
+            auto err = res.m_errors.col(run * numSteps + step);
+            err = truth - est;
+            res.m_nees(step, run) =
+                err.dot(filt->viewCov().ldlt().solve(err.eval()));
+        }
+    };
+
+    for (size_t run = 0; run < numRuns; run++) {
+        m_pool.submit([&runOne, run]() { runOne(run); });
+    }
+    m_pool.wait();
+
+    return res;
+}
+
+}  // namespace lager::gncpy::simulation
@@ -0,0 +1,87 @@
+#include "gncpy/simulation/Random.h"
+
+#include <Eigen/Dense>
+#include <cmath>
+
+namespace lager::gncpy::simulation {
+
+namespace {
+
+constexpr uint32_t PHILOX_M0 = 0xD2511F53;
+constexpr uint32_t PHILOX_M1 = 0xCD9E8D57;
+constexpr uint32_t PHILOX_W0 = 0x9E3779B9;
+constexpr uint32_t PHILOX_W1 = 0xBB67AE85;
+
+inline void mulhilo(uint32_t a, uint32_t b, uint32_t& hi, uint32_t& lo) {
+    uint64_t prod = static_cast<uint64_t>(a) * b;
+    hi = static_cast<uint32_t>(prod >> 32);
+    lo = static_cast<uint32_t>(prod);
+}
+
+inline double toUniform(uint32_t hi, uint32_t lo) {
+    return static_cast<double>(
+               ((static_cast<uint64_t>(hi) << 32) | lo) >> 11) *
+           0x1.0p-53;
+}
+
+}  // namespace
+
+std::array<uint32_t, 4> Philox::generate(uint64_t counter) const noexcept {
+    std::array<uint32_t, 4> ctr{static_cast<uint32_t>(counter),
+                                static_cast<uint32_t>(counter >> 32),
+                                static_cast<uint32_t>(m_stream),
+                                static_cast<uint32_t>(m_stream >> 32)};
+    std::array<uint32_t, 2> key = m_key;
+    for (int round = 0; round < 10; round++) {
+        if (round > 0) {
+            key[0] += PHILOX_W0;
+            key[1] += PHILOX_W1;
+        }
+        uint32_t hi0;
+        uint32_t lo0;
+        uint32_t hi1;
+        uint32_t lo1;
+        mulhilo(PHILOX_M0, ctr[0], hi0, lo0);
+        mulhilo(PHILOX_M1, ctr[2], hi1, lo1);
+        ctr = {hi1 ^ ctr[1] ^ key[0], lo1, hi0 ^ ctr[3] ^ key[1], lo0};
+    }
+    return ctr;
+}
+
+void Philox::normalBatch(double* out) noexcept {
+    constexpr int half = static_cast<int>(NORMAL_BATCH / 2);
+    using Batch = Eigen::Array<double, half, 1>;
+
+    // one block gives two uniforms and so two normals
+    Batch u1;
+    Batch u2;
+    for (int ii = 0; ii < half; ii++) {
+        const std::array<uint32_t, 4> block = generate(m_counter++);
+        u1(ii) = 1.0 - toUniform(block[0], block[1]);
+        u2(ii) = toUniform(block[2], block[3]);
+    }
+
+    const Batch rad = (-2.0 * u1.log()).sqrt();
+    const Batch ang = (2.0 * M_PI) * u2;
+    Eigen::Map<Batch> first(out);
+    Eigen::Map<Batch> second(out + half);
+    first = rad * ang.cos();
+    second = rad * ang.sin();
+}
+
+void Philox::fillNormal(double* out, std::size_t n) noexcept {
+    std::size_t ind = 0;
+    while (ind < n && m_normInd < NORMAL_BATCH) {
+        out[ind++] = m_normals[m_normInd++];
+    }
+    // whole batches go straight to the output
+    while (n - ind >= NORMAL_BATCH) {
+        normalBatch(out + ind);
+        ind += NORMAL_BATCH;
+    }
+    while (ind < n) {
+        out[ind++] = normal();
+    }
+}
+
+}  // namespace lager::gncpy::simulation
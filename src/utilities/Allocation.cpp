@@ -0,0 +1,87 @@
+#include "gncpy/utilities/Allocation.h"
+
+#include <Eigen/Core>
+
+namespace lager::gncpy::utilities {
+
+namespace {
+
+// plain constant initialized thread locals, these are touched from inside the
+// allocator so they must never allocate themselves
+thread_local AllocStats t_stats;
+thread_local unsigned int t_forbidden = 0;
+thread_local uint64_t t_violations = 0;
+
+std::atomic<AllocSite*> g_sites = nullptr;
+
+}  // namespace
+
+void recordAllocation(std::size_t bytes) noexcept {
+    t_stats.allocations++;
+    t_stats.bytes += bytes;
+    if (t_forbidden > 0) {
+        t_violations++;
+    }
+}
+
+void recordDeallocation() noexcept { t_stats.deallocations++; }
+
+AllocStats threadAllocStats() noexcept { return t_stats; }
+
+uint64_t threadAllocViolations() noexcept { return t_violations; }
+
+AllocStats AllocCounter::stats() const noexcept {
+    AllocStats out;
+    out.allocations = t_stats.allocations - m_start.allocations;
+    out.deallocations = t_stats.deallocations - m_start.deallocations;
+    out.bytes = t_stats.bytes - m_start.bytes;
+    return out;
+}
+
+NoAllocGuard::NoAllocGuard() noexcept : m_eigenAllowed(true) {
+    t_forbidden++;
+#ifdef EIGEN_RUNTIME_NO_MALLOC
+    m_eigenAllowed = Eigen::internal::is_malloc_allowed();
+    Eigen::internal::set_is_malloc_allowed(false);
+#endif
+}
+
+NoAllocGuard::~NoAllocGuard() {
+    t_forbidden--;
+#ifdef EIGEN_RUNTIME_NO_MALLOC
+    Eigen::internal::set_is_malloc_allowed(m_eigenAllowed);
+#endif
+}
+
+AllocSite::AllocSite(const char* name) noexcept : name(name) {
+    next = g_sites.load();
+    while (!g_sites.compare_exchange_weak(next, this)) {
+    }
+}
+
+AllocSiteScope::~AllocSiteScope() {
+    m_site.calls++;
+    m_site.allocations += t_stats.allocations - m_start.allocations;
+    m_site.bytes += t_stats.bytes - m_start.bytes;
+}
+
+std::vector<AllocSiteReport> allocReport() {
+    std::vector<AllocSiteReport> out;
+    for (AllocSite* site = g_sites.load(); site != nullptr;
+         site = site->next) {
+        out.push_back(AllocSiteReport{site->name, site->calls,
+                                      site->allocations, site->bytes});
+    }
+    return out;
+}
+
+void resetAllocReport() noexcept {
+    for (AllocSite* site = g_sites.load(); site != nullptr;
+         site = site->next) {
+        site->calls = 0;
+        site->allocations = 0;
+        site->bytes = 0;
+    }
+}
+
+}  // namespace lager::gncpy::utilities
@@ -0,0 +1,243 @@
+#include "gncpy/utilities/Checkpoint.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <tuple>
+
+#include "gncpy/Exceptions.h"
+
+namespace lager::gncpy::utilities {
+
+namespace {
+
+constexpr char MAGIC[8] = {'G', 'N', 'C', 'P', 'Y', 'C', 'K', 'P'};
+constexpr uint32_t ORDER_MARK = 0x01020304;
+constexpr std::size_t ALIGNMENT = 64;
+
+struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint64_t numEntries;
+    uint64_t indexOffset;
+    uint64_t fileSize;
+    uint8_t reserved[24];
+};
+static_assert(sizeof(Header) == 64);
+static_assert(sizeof(CheckpointEntry) == 40);
+
+inline std::size_t alignUp(std::size_t val, std::size_t alignment) {
+    return (val + alignment - 1) / alignment * alignment;
+}
+
+inline bool entryLess(const CheckpointEntry& a, const CheckpointEntry& b) {
+    return std::tie(a.id, a.field) < std::tie(b.id, b.field);
+}
+
+inline std::size_t recordBytes(const CheckpointEntry& entry) {
+    return entry.type == CheckpointEntry::MATRIX
+               ? entry.rows * entry.cols * sizeof(double)
+               : entry.rows;
+}
+
+// checked by division so a corrupt size can not overflow past the limit
+inline bool recordFits(const CheckpointEntry& entry, uint64_t limit) {
+    if (entry.offset > limit) {
+        return false;
+    }
+    const uint64_t avail = limit - entry.offset;
+    if (entry.type != CheckpointEntry::MATRIX) {
+        return entry.rows <= avail;
+    }
+    if (entry.offset % alignof(double) != 0 || entry.rows > avail ||
+        entry.cols > avail) {
+        return false;
+    }
+    return entry.cols == 0 ||
+           entry.rows <= avail / entry.cols / sizeof(double);
+}
+
+}  // namespace
+
+void CheckpointWriter::addMatrix(uint64_t id, CheckpointField field,
+                                 const Eigen::MatrixXd& mat) {
+    CheckpointEntry entry{id,
+                          static_cast<uint32_t>(field),
+                          CheckpointEntry::MATRIX,
+                          0,
+                          static_cast<uint64_t>(mat.rows()),
+                          static_cast<uint64_t>(mat.cols())};
+    m_records.push_back(Record{entry, mat.data(), 0});
+}
+
+void CheckpointWriter::addVector(uint64_t id, CheckpointField field,
+                                 const Eigen::VectorXd& vec) {
+    CheckpointEntry entry{id,
+                          static_cast<uint32_t>(field),
+                          CheckpointEntry::MATRIX,
+                          0,
+                          static_cast<uint64_t>(vec.size()),
+                          1};
+    m_records.push_back(Record{entry, vec.data(), 0});
+}
+
+void CheckpointWriter::addBlob(uint64_t id, CheckpointField field,
+                               std::string bytes) {
+    CheckpointEntry entry{id,
+                          static_cast<uint32_t>(field),
+                          CheckpointEntry::BLOB,
+                          0,
+                          bytes.size(),
+                          0};
+    m_records.push_back(Record{entry, nullptr, m_blobs.size()});
+    m_blobs.push_back(std::move(bytes));
+}
+
+void CheckpointWriter::write(const std::string& path) const {
+    std::vector<Record> records = m_records;
+    std::sort(records.begin(), records.end(),
+              [](const Record& a, const Record& b) {
+                  return entryLess(a.entry, b.entry);
+              });
+    for (std::size_t ii = 1; ii < records.size(); ii++) {
+        if (!entryLess(records[ii - 1].entry, records[ii].entry)) {
+            throw exceptions::BadParams("Duplicate checkpoint record");
+        }
+    }
+
+    std::size_t offset = sizeof(Header);
+    for (auto& rec : records) {
+        offset = alignUp(offset, ALIGNMENT);
+        rec.entry.offset = offset;
+        offset += recordBytes(rec.entry);
+    }
+    const std::size_t indexOffset = alignUp(offset, ALIGNMENT);
+    const std::size_t fileSize =
+        indexOffset + records.size() * sizeof(CheckpointEntry);
+
+    const std::string tmpPath = path + ".tmp";
+    {
+        MappedFile file = MappedFile::create(tmpPath, fileSize);
+        std::byte* base = file.data();
+
+        auto* index = reinterpret_cast<CheckpointEntry*>(base + indexOffset);
+        for (std::size_t ii = 0; ii < records.size(); ii++) {
+            const Record& rec = records[ii];
+            const void* src = rec.entry.type == CheckpointEntry::MATRIX
+                                  ? static_cast<const void*>(rec.data)
+                                  : m_blobs[rec.blob].data();
+            std::memcpy(base + rec.entry.offset, src, recordBytes(rec.entry));
+            index[ii] = rec.entry;
+        }
+
+        // header goes last so a truncated file is never seen as valid
+        Header header{};
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = Checkpoint::VERSION;
+        header.byteOrder = ORDER_MARK;
+        header.numEntries = records.size();
+        header.indexOffset = indexOffset;
+        header.fileSize = fileSize;
+        std::memcpy(base, &header, sizeof(header));
+
+        file.sync();
+    }
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        throw exceptions::IOError("Failed to move checkpoint into place");
+    }
+}
+
+Checkpoint Checkpoint::open(const std::string& path) {
+    Checkpoint out;
+    out.m_file = MappedFile::openRead(path);
+
+    if (out.m_file.size() < sizeof(Header)) {
+        throw exceptions::IOError("File is too small to be a checkpoint");
+    }
+    Header header;
+    std::memcpy(&header, out.m_file.data(), sizeof(header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+        throw exceptions::IOError("File is not a checkpoint");
+    }
+    if (header.byteOrder != ORDER_MARK) {
+        throw exceptions::IOError("Checkpoint was written with another "
+                                  "byte order");
+    }
+    if (header.version > VERSION) {
+        throw exceptions::IOError("Checkpoint version is not supported");
+    }
+    if (header.fileSize != out.m_file.size() ||
+        header.indexOffset % alignof(CheckpointEntry) != 0 ||
+        header.indexOffset > header.fileSize ||
+        header.numEntries > (header.fileSize - header.indexOffset) /
+                                sizeof(CheckpointEntry)) {
+        throw exceptions::IOError("Checkpoint is truncated or corrupt");
+    }
+
+    out.m_version = header.version;
+    out.m_entries = std::span<const CheckpointEntry>(
+        reinterpret_cast<const CheckpointEntry*>(out.m_file.data() +
+                                                 header.indexOffset),
+        header.numEntries);
+    for (std::size_t ii = 0; ii < out.m_entries.size(); ii++) {
+        if (!recordFits(out.m_entries[ii], header.indexOffset)) {
+            throw exceptions::IOError("Checkpoint record is out of bounds");
+        }
+        // lookups binary search the index
+        if (ii > 0 && !entryLess(out.m_entries[ii - 1], out.m_entries[ii])) {
+            throw exceptions::IOError("Checkpoint index is not sorted");
+        }
+    }
+
+    return out;
+}
+
+bool Checkpoint::contains(uint64_t id, CheckpointField field) const {
+    CheckpointEntry key{id, static_cast<uint32_t>(field), 0, 0, 0, 0};
+    return std::binary_search(m_entries.begin(), m_entries.end(), key,
+                              entryLess);
+}
+
+Eigen::Map<const Eigen::MatrixXd> Checkpoint::matrix(
+    uint64_t id, CheckpointField field) const {
+    const CheckpointEntry& entry = find(id, field, CheckpointEntry::MATRIX);
+    return Eigen::Map<const Eigen::MatrixXd>(
+        reinterpret_cast<const double*>(m_file.data() + entry.offset),
+        static_cast<Eigen::Index>(entry.rows),
+        static_cast<Eigen::Index>(entry.cols));
+}
+
+Eigen::Map<const Eigen::VectorXd> Checkpoint::vector(
+    uint64_t id, CheckpointField field) const {
+    const CheckpointEntry& entry = find(id, field, CheckpointEntry::MATRIX);
+    if (entry.cols != 1) {
+        throw exceptions::TypeError("Checkpoint record is not a vector");
+    }
+    return Eigen::Map<const Eigen::VectorXd>(
+        reinterpret_cast<const double*>(m_file.data() + entry.offset),
+        static_cast<Eigen::Index>(entry.rows));
+}
+
+std::string_view Checkpoint::blob(uint64_t id, CheckpointField field) const {
+    const CheckpointEntry& entry = find(id, field, CheckpointEntry::BLOB);
+    return std::string_view(
+        reinterpret_cast<const char*>(m_file.data() + entry.offset),
+        entry.rows);
+}
+
+const CheckpointEntry& Checkpoint::find(uint64_t id, CheckpointField field,
+                                        uint32_t type) const {
+    CheckpointEntry key{id, static_cast<uint32_t>(field), 0, 0, 0, 0};
+    auto it =
+        std::lower_bound(m_entries.begin(), m_entries.end(), key, entryLess);
+    if (it == m_entries.end() || entryLess(key, *it)) {
+        throw exceptions::BadParams("Checkpoint record not found");
+    }
+    if (it->type != type) {
+        throw exceptions::TypeError("Checkpoint record has the wrong type");
+    }
+    return *it;
+}
+
+}  // namespace lager::gncpy::utilities
@@ -0,0 +1,124 @@
+#include "gncpy/utilities/MappedFile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <utility>
+
+#include "gncpy/Exceptions.h"
+
+namespace lager::gncpy::utilities {
+
+MappedFile::~MappedFile() { close(); }
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : m_fd(std::exchange(other.m_fd, -1)),
+      m_data(std::exchange(other.m_data, nullptr)),
+      m_size(std::exchange(other.m_size, 0)),
+      m_writable(std::exchange(other.m_writable, false)) {}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        close();
+        m_fd = std::exchange(other.m_fd, -1);
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+        m_writable = std::exchange(other.m_writable, false);
+    }
+    return *this;
+}
+
+MappedFile MappedFile::openRead(const std::string& path) {
+    MappedFile out;
+    out.m_fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (out.m_fd < 0) {
+        throw exceptions::IOError("Failed to open file for reading");
+    }
+    struct stat info;
+    if (::fstat(out.m_fd, &info) != 0) {
+        throw exceptions::IOError("Failed to get the file size");
+    }
+    out.m_size = static_cast<std::size_t>(info.st_size);
+    out.map();
+    return out;
+}
+
+MappedFile MappedFile::openWrite(const std::string& path) {
+    MappedFile out;
+    out.m_fd = ::open(path.c_str(), O_RDWR | O_CLOEXEC);
+    if (out.m_fd < 0) {
+        throw exceptions::IOError("Failed to open file for writing");
+    }
+    struct stat info;
+    if (::fstat(out.m_fd, &info) != 0) {
+        throw exceptions::IOError("Failed to get the file size");
+    }
+    out.m_writable = true;
+    out.m_size = static_cast<std::size_t>(info.st_size);
+    out.map();
+    return out;
+}
+
+MappedFile MappedFile::create(const std::string& path, std::size_t size) {
+    MappedFile out;
+    out.m_fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC,
+                      0644);
+    if (out.m_fd < 0) {
+        throw exceptions::IOError("Failed to create file");
+    }
+    out.m_writable = true;
+    out.resize(size);
+    return out;
+}
+
+void MappedFile::resize(std::size_t size) {
+    if (!m_writable) {
+        throw exceptions::IOError("File is not open for writing");
+    }
+    if (m_data != nullptr) {
+        ::munmap(m_data, m_size);
+        m_data = nullptr;
+    }
+    if (::ftruncate(m_fd, static_cast<off_t>(size)) != 0) {
+        throw exceptions::IOError("Failed to resize file");
+    }
+    m_size = size;
+    map();
+}
+
+void MappedFile::sync() {
+    if (m_data != nullptr && m_writable &&
+        ::msync(m_data, m_size, MS_SYNC) != 0) {
+        throw exceptions::IOError("Failed to sync file");
+    }
+}
+
+void MappedFile::close() noexcept {
+    if (m_data != nullptr) {
+        ::munmap(m_data, m_size);
+        m_data = nullptr;
+    }
+    if (m_fd >= 0) {
+        ::close(m_fd);
+        m_fd = -1;
+    }
+    m_size = 0;
+    m_writable = false;
+}
+
+void MappedFile::map() {
+    // mmap of an empty range is an error, leave the mapping empty instead
+    if (m_size == 0) {
+        return;
+    }
+    int prot = m_writable ? PROT_READ | PROT_WRITE : PROT_READ;
+    void* ptr = ::mmap(nullptr, m_size, prot, MAP_SHARED, m_fd, 0);
+    if (ptr == MAP_FAILED) {
+        throw exceptions::IOError("Failed to map file");
+    }
+    m_data = static_cast<std::byte*>(ptr);
+}
+
+}  // namespace lager::gncpy::utilities
@@ -0,0 +1,137 @@
+#include "gncpy/utilities/ThreadPool.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace lager::gncpy::utilities {
+
+namespace {
+
+// pool and queue index of the calling thread, null if it is not a worker
+thread_local const ThreadPool* t_pool = nullptr;
+thread_local size_t t_ind = 0;
+
+}  // namespace
+
+ThreadPool::ThreadPool(size_t numThreads) {
+    if (numThreads == 0) {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for (size_t ii = 0; ii < numThreads; ii++) {
+        m_queues.emplace_back(std::make_unique<TaskQueue>());
+    }
+    m_workers.reserve(numThreads);
+    for (size_t ii = 0; ii < numThreads; ii++) {
+        m_workers.emplace_back([this, ii]() { workerLoop(ii); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lk(m_mut);
+        m_stop = true;
+    }
+    m_taskCv.notify_all();
+    for (auto& w : m_workers) {
+        w.join();
+    }
+}
+
+void ThreadPool::submit(std::function<void()> task) {
+    size_t ind = t_pool == this ? t_ind : m_next++ % m_queues.size();
+    m_pending++;
+    {
+        // counted under the pool lock so a worker can not miss the wake up,
+        // and before the push so a worker popping the task first can not
+        // take the count below zero
+        std::lock_guard<std::mutex> lk(m_mut);
+        m_queued++;
+    }
+    {
+        std::lock_guard<std::mutex> lk(m_queues[ind]->mut);
+        m_queues[ind]->tasks.push_back(std::move(task));
+    }
+    m_taskCv.notify_one();
+}
+
+void ThreadPool::wait() {
+    std::unique_lock<std::mutex> lk(m_mut);
+    m_doneCv.wait(lk, [this]() { return m_pending == 0; });
+    if (m_error) {
+        std::exception_ptr err = std::exchange(m_error, nullptr);
+        lk.unlock();
+        std::rethrow_exception(err);
+    }
+}
+
+void ThreadPool::parallelFor(size_t num, size_t minChunk,
+                             const std::function<void(size_t, size_t)>& fnc) {
+    if (num == 0) {
+        return;
+    }
+    const size_t numChunks = std::clamp<size_t>(
+        num / std::max<size_t>(minChunk, 1), 1, 4 * m_workers.size());
+    const size_t chunk = (num + numChunks - 1) / numChunks;
+    for (size_t start = 0; start < num; start += chunk) {
+        const size_t end = std::min(num, start + chunk);
+        submit([&fnc, start, end]() { fnc(start, end); });
+    }
+    wait();
+}
+
+bool ThreadPool::tryPop(size_t ind, std::function<void()>& task) {
+    {
+        std::lock_guard<std::mutex> lk(m_queues[ind]->mut);
+        auto& own = m_queues[ind]->tasks;
+        if (!own.empty()) {
+            task = std::move(own.back());
+            own.pop_back();
+            m_queued--;
+            return true;
+        }
+    }
+    for (size_t off = 1; off < m_queues.size(); off++) {
+        auto& q = *m_queues[(ind + off) % m_queues.size()];
+        std::lock_guard<std::mutex> lk(q.mut);
+        if (!q.tasks.empty()) {
+            task = std::move(q.tasks.front());
+            q.tasks.pop_front();
+            m_queued--;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::workerLoop(size_t ind) {
+    t_pool = this;
+    t_ind = ind;
+
+    std::function<void()> task;
+    while (true) {
+        if (tryPop(ind, task)) {
+            try {
+                task();
+            } catch (...) {
+                std::lock_guard<std::mutex> lk(m_mut);
+                if (!m_error) {
+                    m_error = std::current_exception();
+                }
+            }
+            task = nullptr;
+            if (--m_pending == 0) {
+                std::lock_guard<std::mutex> lk(m_mut);
+                m_doneCv.notify_all();
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lk(m_mut);
+        m_taskCv.wait(lk, [this]() { return m_stop || m_queued > 0; });
+        if (m_stop && m_queued == 0) {
+            return;
+        }
+    }
+}
+
+}  // namespace lager::gncpy::utilities
@@ -0,0 +1,128 @@
+#include "gncpy/utilities/Trace.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <iomanip>
+#include <ios>
+
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define GNCPY_TRACE_PROBE(name, ns) DTRACE_PROBE2(gncpy, stage, name, ns)
+#else
+#define GNCPY_TRACE_PROBE(name, ns) static_cast<void>(0)
+#endif
+
+namespace lager::gncpy::utilities {
+
+namespace {
+
+std::atomic<TraceStage*> g_stages = nullptr;
+
+}  // namespace
+
+double TraceStageReport::meanNs() const {
+    return calls > 0 ? static_cast<double>(totalNs) / calls : 0.0;
+}
+
+uint64_t TraceStageReport::percentileNs(double fraction) const {
+    // nearest rank, at least the first call
+    uint64_t rank = std::max<uint64_t>(
+        1, static_cast<uint64_t>(std::ceil(fraction * calls)));
+    uint64_t seen = 0;
+    for (std::size_t ii = 0; ii < TRACE_BUCKETS; ii++) {
+        seen += histogram[ii];
+        if (seen >= rank) {
+            return ii + 1 < TRACE_BUCKETS ? uint64_t(1) << ii : maxNs;
+        }
+    }
+    return 0;
+}
+
+TraceStage::TraceStage(const char* name) noexcept : name(name) {
+    next = g_stages.load();
+    while (!g_stages.compare_exchange_weak(next, this)) {
+    }
+}
+
+void TraceStage::record(uint64_t ns) noexcept {
+    // USDT marker, attach with perf or bpftrace to usdt:gncpy:stage
+    GNCPY_TRACE_PROBE(name, ns);
+
+    calls.fetch_add(1, std::memory_order_relaxed);
+    totalNs.fetch_add(ns, std::memory_order_relaxed);
+    uint64_t prev = maxNs.load(std::memory_order_relaxed);
+    while (prev < ns && !maxNs.compare_exchange_weak(
+                            prev, ns, std::memory_order_relaxed)) {
+    }
+    std::size_t bucket =
+        std::min<std::size_t>(std::bit_width(ns), TRACE_BUCKETS - 1);
+    histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+std::vector<TraceStageReport> traceReport() {
+    std::vector<TraceStageReport> out;
+    for (TraceStage* stage = g_stages.load(); stage != nullptr;
+         stage = stage->next) {
+        TraceStageReport rep;
+        rep.name = stage->name;
+        rep.calls = stage->calls;
+        rep.totalNs = stage->totalNs;
+        rep.maxNs = stage->maxNs;
+        for (std::size_t ii = 0; ii < TRACE_BUCKETS; ii++) {
+            rep.histogram[ii] = stage->histogram[ii];
+        }
+        out.push_back(rep);
+    }
+    return out;
+}
+
+void resetTraceReport() noexcept {
+    for (TraceStage* stage = g_stages.load(); stage != nullptr;
+         stage = stage->next) {
+        stage->calls = 0;
+        stage->totalNs = 0;
+        stage->maxNs = 0;
+        for (auto& count : stage->histogram) {
+            count = 0;
+        }
+    }
+}
+
+void writeTraceReport(std::ostream& os) {
+    std::vector<TraceStageReport> report = traceReport();
+    std::sort(report.begin(), report.end(),
+              [](const auto& a, const auto& b) { return a.name < b.name; });
+
+    // the table changes the alignment and number format, give the caller
+    // back the stream as it was
+    const std::ios_base::fmtflags flags = os.flags();
+    const std::streamsize precision = os.precision();
+    os << std::left << std::setw(40) << "stage" << std::right
+       << std::setw(10) << "calls" << std::setw(12) << "mean ns"
+       << std::setw(12) << "p50 ns" << std::setw(12) << "p99 ns"
+       << std::setw(12) << "max ns" << "\n";
+    for (const auto& rep : report) {
+        if (rep.calls == 0) {
+            continue;
+        }
+        os << std::left << std::setw(40) << rep.name << std::right
+           << std::setw(10) << rep.calls << std::setw(12) << std::fixed
+           << std::setprecision(0) << rep.meanNs() << std::setw(12)
+           << rep.percentileNs(0.5) << std::setw(12) << rep.percentileNs(0.99)
+           << std::setw(12) << rep.maxNs << "\n";
+        for (std::size_t ii = 0; ii < TRACE_BUCKETS; ii++) {
+            if (rep.histogram[ii] == 0) {
+                continue;
+            }
+            os << "    < " << std::setw(12)
+               << (ii + 1 < TRACE_BUCKETS ? std::to_string(uint64_t(1) << ii)
+                                          : std::string("inf"))
+               << " ns: " << rep.histogram[ii] << "\n";
+        }
+    }
+    os.flags(flags);
+    os.precision(precision);
+}
+
+}  // namespace lager::gncpy::utilities
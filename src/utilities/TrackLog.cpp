@@ -0,0 +1,449 @@
+#include "gncpy/utilities/TrackLog.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <tuple>
+
+#include "gncpy/Exceptions.h"
+
+namespace lager::gncpy::utilities {
+
+namespace {
+
+constexpr char MAGIC[8] = {'G', 'N', 'C', 'P', 'Y', 'L', 'O', 'G'};
+constexpr uint32_t VERSION = 1;
+constexpr uint32_t ORDER_MARK = 0x01020304;
+
+constexpr uint32_t RECORD_TYPE = 1;
+constexpr uint32_t INDEX_TYPE = 2;
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t orderMark;
+    uint64_t lastIndex;
+    uint8_t reserved[40];
+};
+static_assert(sizeof(FileHeader) == 64);
+
+struct BlockHeader {
+    uint32_t type;
+    uint32_t reserved;
+    uint64_t size;
+};
+
+struct RecordHeader {
+    BlockHeader block;
+    uint64_t trackId;
+    double time;
+    uint32_t stateDim;
+    uint32_t covDim;
+};
+static_assert(sizeof(RecordHeader) == 40);
+
+struct IndexHeader {
+    BlockHeader block;
+    uint64_t prevIndex;
+    uint64_t count;
+    double minTime;
+    double maxTime;
+};
+static_assert(sizeof(IndexHeader) == 48);
+static_assert(sizeof(TrackLogIndexEntry) == 24);
+
+inline bool entryLess(const TrackLogIndexEntry& a,
+                      const TrackLogIndexEntry& b) {
+    return std::tie(a.trackId, a.time, a.offset) <
+           std::tie(b.trackId, b.time, b.offset);
+}
+
+// true if the block holds exactly the record's values and fits in avail
+// bytes, checked by division so corrupt dimensions can not wrap around
+inline bool recordFits(const RecordHeader& rec, uint64_t avail) {
+    const uint64_t numVals = rec.stateDim + uint64_t(rec.covDim) * rec.covDim;
+    if (avail < sizeof(RecordHeader) ||
+        numVals > (avail - sizeof(RecordHeader)) / sizeof(double)) {
+        return false;
+    }
+    return rec.block.size == sizeof(RecordHeader) + numVals * sizeof(double);
+}
+
+template <typename T>
+inline void put(std::vector<std::byte>& buf, const T* src, std::size_t n) {
+    std::size_t start = buf.size();
+    buf.resize(start + n * sizeof(T));
+    std::memcpy(buf.data() + start, src, n * sizeof(T));
+}
+
+template <typename T>
+inline T get(const std::byte* base, uint64_t offset) {
+    T out;
+    std::memcpy(&out, base + offset, sizeof(T));
+    return out;
+}
+
+void writeAll(int fd, const std::byte* data, std::size_t size) {
+    while (size > 0) {
+        ssize_t n = ::write(fd, data, size);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw exceptions::IOError("Failed to write track log");
+        }
+        data += n;
+        size -= static_cast<std::size_t>(n);
+    }
+}
+
+}  // namespace
+
+TrackLogWriter::TrackLogWriter(const std::string& path,
+                               std::size_t indexInterval,
+                               std::size_t flushBytes)
+    : m_indexInterval(std::max<std::size_t>(indexInterval, 1)),
+      m_flushBytes(flushBytes) {
+    m_fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+                  0644);
+    if (m_fd < 0) {
+        throw exceptions::IOError("Failed to create track log");
+    }
+
+    FileHeader header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.orderMark = ORDER_MARK;
+    put(m_buffer, &header, 1);
+    m_offset = sizeof(FileHeader);
+
+    m_thread = std::thread(&TrackLogWriter::writerLoop, this);
+}
+
+TrackLogWriter::~TrackLogWriter() {
+    try {
+        close();
+    } catch (...) {
+        // errors are only reported by an explicit close or flush
+    }
+}
+
+void TrackLogWriter::append(uint64_t trackId, double time,
+                            const Eigen::VectorXd& state,
+                            const Eigen::MatrixXd& cov) {
+    if (m_fd < 0) {
+        throw exceptions::IOError("Track log is closed");
+    }
+    if (cov.rows() != cov.cols() ||
+        (cov.size() > 0 && cov.rows() != state.size())) {
+        throw exceptions::BadParams(
+            "Covariance must be empty or match the state size");
+    }
+
+    RecordHeader header{};
+    header.block.type = RECORD_TYPE;
+    header.block.size =
+        sizeof(RecordHeader) + (state.size() + cov.size()) * sizeof(double);
+    header.trackId = trackId;
+    header.time = time;
+    header.stateDim = static_cast<uint32_t>(state.size());
+    header.covDim = static_cast<uint32_t>(cov.rows());
+
+    put(m_buffer, &header, 1);
+    put(m_buffer, state.data(), state.size());
+    put(m_buffer, cov.data(), cov.size());
+
+    m_pending.push_back(TrackLogIndexEntry{trackId, time, m_offset});
+    m_offset += header.block.size;
+    m_numRecords++;
+
+    if (m_pending.size() >= m_indexInterval) {
+        writeIndex();
+    }
+    if (m_buffer.size() >= m_flushBytes) {
+        submit();
+    }
+}
+
+void TrackLogWriter::flush() {
+    if (!m_buffer.empty()) {
+        submit();
+    }
+    std::unique_lock lock(m_mut);
+    m_cv.wait(lock, [this]() { return m_queue.empty() && !m_busy; });
+    if (m_error) {
+        std::rethrow_exception(m_error);
+    }
+}
+
+void TrackLogWriter::close() {
+    if (m_fd < 0) {
+        return;
+    }
+    if (!m_pending.empty()) {
+        writeIndex();
+    }
+    std::exception_ptr err;
+    try {
+        flush();
+    } catch (...) {
+        err = std::current_exception();
+    }
+    {
+        std::lock_guard lock(m_mut);
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    m_thread.join();
+
+    ::fsync(m_fd);
+    ::close(m_fd);
+    m_fd = -1;
+    if (err) {
+        std::rethrow_exception(err);
+    }
+}
+
+void TrackLogWriter::writeIndex() {
+    std::sort(m_pending.begin(), m_pending.end(), entryLess);
+
+    IndexHeader header{};
+    header.block.type = INDEX_TYPE;
+    header.block.size =
+        sizeof(IndexHeader) + m_pending.size() * sizeof(TrackLogIndexEntry);
+    header.prevIndex = m_lastIndex;
+    header.count = m_pending.size();
+    header.minTime = m_pending.front().time;
+    header.maxTime = m_pending.front().time;
+    for (const auto& entry : m_pending) {
+        header.minTime = std::min(header.minTime, entry.time);
+        header.maxTime = std::max(header.maxTime, entry.time);
+    }
+
+    put(m_buffer, &header, 1);
+    put(m_buffer, m_pending.data(), m_pending.size());
+
+    m_lastIndex = m_offset;
+    m_offset += header.block.size;
+    m_pending.clear();
+}
+
+void TrackLogWriter::submit() {
+    Chunk chunk{std::move(m_buffer), m_lastIndex};
+    m_buffer = std::vector<std::byte>();
+    m_buffer.reserve(m_flushBytes);
+    {
+        std::lock_guard lock(m_mut);
+        if (m_error) {
+            std::rethrow_exception(m_error);
+        }
+        m_queue.push_back(std::move(chunk));
+    }
+    m_cv.notify_all();
+}
+
+void TrackLogWriter::writerLoop() {
+    while (true) {
+        Chunk chunk;
+        {
+            std::unique_lock lock(m_mut);
+            m_cv.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+            if (m_queue.empty()) {
+                return;
+            }
+            chunk = std::move(m_queue.front());
+            m_queue.pop_front();
+            m_busy = true;
+        }
+
+        try {
+            writeAll(m_fd, chunk.bytes.data(), chunk.bytes.size());
+            // the header only points at index blocks that are fully written
+            if (chunk.lastIndex != 0 &&
+                ::pwrite(m_fd, &chunk.lastIndex, sizeof(chunk.lastIndex),
+                         offsetof(FileHeader, lastIndex)) !=
+                    sizeof(chunk.lastIndex)) {
+                throw exceptions::IOError("Failed to update track log header");
+            }
+        } catch (...) {
+            std::lock_guard lock(m_mut);
+            if (!m_error) {
+                m_error = std::current_exception();
+            }
+            m_queue.clear();
+        }
+
+        {
+            std::lock_guard lock(m_mut);
+            m_busy = false;
+        }
+        m_cv.notify_all();
+    }
+}
+
+TrackLogReader TrackLogReader::open(const std::string& path) {
+    TrackLogReader out;
+    out.m_file = MappedFile::openRead(path);
+    const std::byte* base = out.m_file.data();
+    const uint64_t fileSize = out.m_file.size();
+
+    if (fileSize < sizeof(FileHeader)) {
+        throw exceptions::IOError("File is too small to be a track log");
+    }
+    auto header = get<FileHeader>(base, 0);
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+        throw exceptions::IOError("File is not a track log");
+    }
+    if (header.orderMark != ORDER_MARK) {
+        throw exceptions::IOError(
+            "Track log was written with another byte order");
+    }
+    if (header.version > VERSION) {
+        throw exceptions::IOError("Track log version is not supported");
+    }
+
+    // walk the index chain back from the newest block, if the chain is
+    // damaged fall back to scanning every record
+    uint64_t tailStart = sizeof(FileHeader);
+    for (uint64_t offset = header.lastIndex; offset != 0;) {
+        IndexHeader index{};
+        const bool fits =
+            offset <= fileSize && fileSize - offset >= sizeof(IndexHeader);
+        if (fits) {
+            index = get<IndexHeader>(base, offset);
+        }
+        // the count is bounded before it is multiplied so it can not wrap
+        if (!fits || index.block.type != INDEX_TYPE ||
+            index.count > (fileSize - offset - sizeof(IndexHeader)) /
+                              sizeof(TrackLogIndexEntry) ||
+            index.block.size != sizeof(IndexHeader) +
+                                    index.count * sizeof(TrackLogIndexEntry) ||
+            index.prevIndex >= offset) {
+            out.m_blocks.clear();
+            out.m_numRecords = 0;
+            tailStart = sizeof(FileHeader);
+            break;
+        }
+        if (offset == header.lastIndex) {
+            tailStart = offset + index.block.size;
+        }
+        out.m_blocks.push_back(Block{
+            index.minTime, index.maxTime,
+            reinterpret_cast<const TrackLogIndexEntry*>(
+                base + offset + sizeof(IndexHeader)),
+            static_cast<std::size_t>(index.count)});
+        out.m_numRecords += index.count;
+        offset = index.prevIndex;
+    }
+    std::reverse(out.m_blocks.begin(), out.m_blocks.end());
+
+    // records after the last index, stop at a partially written record
+    for (uint64_t offset = tailStart;
+         offset + sizeof(BlockHeader) <= fileSize;) {
+        auto block = get<BlockHeader>(base, offset);
+        if (block.size < sizeof(BlockHeader) ||
+            block.size > fileSize - offset) {
+            break;
+        }
+        if (block.type == RECORD_TYPE) {
+            if (block.size < sizeof(RecordHeader)) {
+                break;
+            }
+            auto rec = get<RecordHeader>(base, offset);
+            if (!recordFits(rec, fileSize - offset)) {
+                break;
+            }
+            out.m_tail.push_back(
+                TrackLogIndexEntry{rec.trackId, rec.time, offset});
+        }
+        offset += block.size;
+    }
+    std::sort(out.m_tail.begin(), out.m_tail.end(), entryLess);
+    out.m_numRecords += out.m_tail.size();
+
+    return out;
+}
+
+std::vector<TrackLogRecord> TrackLogReader::query(uint64_t trackId,
+                                                  double startTime,
+                                                  double endTime) const {
+    std::vector<const TrackLogIndexEntry*> found;
+    auto search = [&](const TrackLogIndexEntry* first, std::size_t count) {
+        const TrackLogIndexEntry* last = first + count;
+        TrackLogIndexEntry key{trackId, startTime, 0};
+        for (auto it = std::lower_bound(first, last, key, entryLess);
+             it != last && it->trackId == trackId && it->time <= endTime;
+             ++it) {
+            found.push_back(it);
+        }
+    };
+
+    for (const auto& block : m_blocks) {
+        if (block.maxTime >= startTime && block.minTime <= endTime) {
+            search(block.entries, block.count);
+        }
+    }
+    search(m_tail.data(), m_tail.size());
+
+    return collect(found);
+}
+
+std::vector<TrackLogRecord> TrackLogReader::queryTime(double startTime,
+                                                      double endTime) const {
+    std::vector<const TrackLogIndexEntry*> found;
+    auto search = [&](const TrackLogIndexEntry* first, std::size_t count) {
+        for (std::size_t ii = 0; ii < count; ii++) {
+            if (first[ii].time >= startTime && first[ii].time <= endTime) {
+                found.push_back(first + ii);
+            }
+        }
+    };
+
+    for (const auto& block : m_blocks) {
+        if (block.maxTime >= startTime && block.minTime <= endTime) {
+            search(block.entries, block.count);
+        }
+    }
+    search(m_tail.data(), m_tail.size());
+
+    return collect(found);
+}
+
+TrackLogRecord TrackLogReader::record(uint64_t offset) const {
+    // indexed records are only validated when a query reaches them
+    const std::byte* base = m_file.data();
+    const uint64_t fileSize = m_file.size();
+    if (offset > fileSize || fileSize - offset < sizeof(RecordHeader)) {
+        throw exceptions::IOError("Track log record is out of bounds");
+    }
+    auto rec = get<RecordHeader>(base, offset);
+    if (rec.block.type != RECORD_TYPE || !recordFits(rec, fileSize - offset)) {
+        throw exceptions::IOError("Track log record is corrupt");
+    }
+    const auto* state =
+        reinterpret_cast<const double*>(base + offset + sizeof(RecordHeader));
+    return TrackLogRecord{
+        rec.trackId, rec.time,
+        Eigen::Map<const Eigen::VectorXd>(state, rec.stateDim),
+        Eigen::Map<const Eigen::MatrixXd>(state + rec.stateDim, rec.covDim,
+                                          rec.covDim)};
+}
+
+std::vector<TrackLogRecord> TrackLogReader::collect(
+    std::vector<const TrackLogIndexEntry*>& found) const {
+    std::sort(found.begin(), found.end(), [](const auto* a, const auto* b) {
+        return std::tie(a->time, a->offset) < std::tie(b->time, b->offset);
+    });
+    std::vector<TrackLogRecord> out;
+    out.reserve(found.size());
+    for (const auto* entry : found) {
+        out.push_back(record(entry->offset));
+    }
+    return out;
+}
+
+}  // namespace lager::gncpy::utilities
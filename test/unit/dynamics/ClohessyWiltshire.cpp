@@ -2,6 +2,7 @@
 #include <gncpy/dynamics/Parameters.h>
 #include <gtest/gtest.h>
 #include <gncpy/control/StateControl.h>
+#include <gncpy/Exceptions.h>
 
 #include <math.h>
 #include <Eigen/Dense>
@@ -79,6 +80,43 @@ TEST(CWHOrbit, Control) {
     SUCCEED();
 }
 
+TEST(CWHOrbit, PropagateBatch) {
+    double mean_motion = 1.1e-3;
+    lager::gncpy::dynamics::ClohessyWiltshire dyn(10.0, mean_motion);
+
+    // deputies at mixed timestamps, more than one internal block
+    const Eigen::Index num = 300;
+    Eigen::MatrixXd states = Eigen::MatrixXd::Random(num, 6);
+    states.leftCols(3) *= 100.0;
+    Eigen::VectorXd dts = 5000.0 * (Eigen::VectorXd::Random(num).array() + 1.0);
+
+    Eigen::MatrixXd expected(num, 6);
+    lager::gncpy::dynamics::ClohessyWiltshire single(0.0, mean_motion);
+    for (Eigen::Index ii = 0; ii < num; ii++) {
+        single.setDt(dts(ii));
+        expected.row(ii) =
+            (single.getStateMat(0.0) * states.row(ii).transpose()).transpose();
+    }
+    dyn.propagateBatch(0.0, states, dts);
+
+    for (Eigen::Index ii = 0; ii < num; ii++) {
+        EXPECT_TRUE(states.row(ii).isApprox(expected.row(ii), 1e-12));
+    }
+
+    // a single step matches propagateState
+    Eigen::VectorXd xk(6);
+    xk << 10., -5., 2., 0.1, 0.02, -0.03;
+    Eigen::MatrixXd batch = xk.transpose();
+    dyn.propagateBatch(0.0, batch);
+    EXPECT_TRUE(batch.row(0).transpose().isApprox(dyn.propagateState(0.0, xk),
+                                                  1e-12));
+
+    EXPECT_THROW(dyn.propagateBatch(0.0, states, Eigen::VectorXd(3)),
+                 lager::gncpy::exceptions::BadParams);
+
+    SUCCEED();
+}
+
 TEST(CWHOrbit, serialize) {
     double dt = 0.1;
     double mean_motion = 2 * M_PI;
@@ -0,0 +1,87 @@
+#include <gncpy/dynamics/CoordinatedTurn.h>
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+#include <cmath>
+
+#include "gncpy/Exceptions.h"
+#include "gncpy/math/Math.h"
+
+TEST(CoordinatedTurn, Propagate) {
+    double dt = 0.5;
+    lager::gncpy::dynamics::CoordinatedTurn dyn(dt);
+
+    // quarter circle of radius 10 in 4 steps
+    double omega = M_PI / 4.0;
+    Eigen::VectorXd xk(5);
+    xk << 10.0, 0.0, 0.0, 10.0 * omega, omega;
+    for (int kk = 0; kk < 4; kk++) {
+        xk = dyn.propagateState(kk * dt, xk);
+    }
+
+    EXPECT_NEAR(0.0, xk(0), 1e-12);
+    EXPECT_NEAR(10.0, xk(1), 1e-12);
+    EXPECT_NEAR(-10.0 * omega, xk(2), 1e-12);
+    EXPECT_NEAR(0.0, xk(3), 1e-12);
+    EXPECT_DOUBLE_EQ(omega, xk(4));
+
+    SUCCEED();
+}
+
+TEST(CoordinatedTurn, StraightLine) {
+    double dt = 0.1;
+    lager::gncpy::dynamics::CoordinatedTurn dyn(dt);
+
+    Eigen::VectorXd xk(5);
+    xk << 1.0, 2.0, 3.0, -4.0, 0.0;
+    Eigen::VectorXd res = dyn.propagateState(0.0, xk);
+    EXPECT_NEAR(1.3, res(0), 1e-15);
+    EXPECT_NEAR(1.6, res(1), 1e-15);
+    EXPECT_EQ(3.0, res(2));
+    EXPECT_EQ(-4.0, res(3));
+
+    // the series branch meets the closed form at the switch
+    Eigen::VectorXd below = xk;
+    Eigen::VectorXd above = xk;
+    below(4) = 0.01 / dt * (1.0 - 1e-9);
+    above(4) = 0.01 / dt * (1.0 + 1e-9);
+    EXPECT_TRUE(dyn.propagateState(0.0, below)
+                    .isApprox(dyn.propagateState(0.0, above), 1e-9));
+    EXPECT_TRUE(dyn.getStateMat(0.0, below)
+                    .isApprox(dyn.getStateMat(0.0, above), 1e-9));
+
+    SUCCEED();
+}
+
+TEST(CoordinatedTurn, GetStateMat) {
+    double dt = 0.2;
+    lager::gncpy::dynamics::CoordinatedTurn dyn(dt);
+
+    for (double omega : {0.7, -0.3, 1e-6, 0.0}) {
+        Eigen::VectorXd xk(5);
+        xk << 3.0, -1.0, 5.0, 2.0, omega;
+
+        Eigen::MatrixXd exp = lager::gncpy::math::getJacobian(
+            xk,
+            [&dyn](const Eigen::VectorXd& x) {
+                return dyn.propagateState(0.0, x);
+            },
+            5);
+        Eigen::MatrixXd res = dyn.getStateMat(0.0, xk);
+
+        ASSERT_EQ(5, res.rows());
+        ASSERT_EQ(5, res.cols());
+        for (Eigen::Index r = 0; r < 5; r++) {
+            for (Eigen::Index c = 0; c < 5; c++) {
+                EXPECT_NEAR(exp(r, c), res(r, c), 1e-6);
+            }
+        }
+    }
+
+    Eigen::VectorXd bad(4);
+    bad << 0.0, 0.0, 1.0, 1.0;
+    EXPECT_THROW(dyn.getStateMat(0.0, bad),
+                 lager::gncpy::exceptions::BadParams);
+
+    SUCCEED();
+}
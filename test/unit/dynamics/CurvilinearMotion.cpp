@@ -3,6 +3,7 @@
 #include <iostream>
 
 #include <gncpy/dynamics/CurvilinearMotion.h>
+#include <gncpy/math/Math.h>
 #include <gtest/gtest.h>
 
 TEST(Curvilinear, GetStateMat) {
@@ -20,7 +21,7 @@ TEST(Curvilinear, GetStateMat) {
         return out;
     };
 
-    auto res = dyn.getStateMat(0.2, xk, nullptr);
+    auto res = dyn.getContinuousStateMat(0.2, xk, nullptr);
     Eigen::Matrix4d exp = jac(xk);
 
     EXPECT_EQ(exp.rows(), res.rows());
@@ -86,3 +87,42 @@ TEST(Curvilinear, serialize) {
 
     SUCCEED();
 }
+
+TEST(Curvilinear, AnalyticStateMat) {
+    lager::gncpy::dynamics::CurvilinearMotion dyn(0.1);
+
+    Eigen::Vector4d xk;
+    xk << 1., -2., 3., 0.7;
+    auto res = dyn.getContinuousStateMat(0.0, xk);
+    auto exp = dyn.getNumericalStateMat(0.0, xk);
+    EXPECT_TRUE(res.isApprox(exp, 1e-6));
+
+    // the discrete Jacobian differentiates each Runge-Kutta stage with the
+    // continuous closed form
+    const double h = dyn.dt();
+    const Eigen::Matrix4d eye = Eigen::Matrix4d::Identity();
+    auto stage = [&dyn](const Eigen::VectorXd& x) {
+        return dyn.getContinuousStateMat(0.0, x);
+    };
+    const Eigen::VectorXd k0 = dyn.continuousDynamics(0.0, xk);
+    const Eigen::MatrixXd dK0 = stage(xk);
+    const Eigen::VectorXd x1 = xk + 0.5 * h * k0;
+    const Eigen::VectorXd k1 = dyn.continuousDynamics(0.0, x1);
+    const Eigen::MatrixXd dK1 = stage(x1) * (eye + 0.5 * h * dK0);
+    const Eigen::VectorXd x2 = xk + 0.5 * h * k1;
+    const Eigen::VectorXd k2 = dyn.continuousDynamics(0.0, x2);
+    const Eigen::MatrixXd dK2 = stage(x2) * (eye + 0.5 * h * dK1);
+    const Eigen::MatrixXd dK3 = stage(xk + h * k2) * (eye + h * dK2);
+    const Eigen::MatrixXd exact =
+        eye + h / 6.0 * (dK0 + 2.0 * (dK1 + dK2) + dK3);
+    EXPECT_TRUE(dyn.getStateMat(0.0, xk).isApprox(exact, 1e-12));
+
+    // and matches differencing propagateState
+    Eigen::MatrixXd disc = lager::gncpy::math::getJacobian(
+        xk,
+        [&dyn](const Eigen::VectorXd& x) { return dyn.propagateState(0.0, x); },
+        4);
+    EXPECT_TRUE(dyn.getStateMat(0.0, xk).isApprox(disc, 1e-6));
+
+    SUCCEED();
+}
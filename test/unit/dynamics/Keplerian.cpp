@@ -0,0 +1,165 @@
+#include <gncpy/dynamics/Keplerian.h>
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+#include <cmath>
+#include <vector>
+
+#include "gncpy/Exceptions.h"
+#include "gncpy/dynamics/TwoBodyJ2.h"
+
+namespace {
+
+using lager::gncpy::dynamics::Keplerian;
+using lager::gncpy::dynamics::OrbitalElements;
+using lager::gncpy::dynamics::TwoBodyJ2;
+
+OrbitalElements makeElements(double a, double e, double inc, double raan,
+                             double argp, double nu) {
+    OrbitalElements out;
+    out.semiMajorAxis = a;
+    out.eccentricity = e;
+    out.inclination = inc;
+    out.raan = raan;
+    out.argPeriapsis = argp;
+    out.trueAnomaly = nu;
+    return out;
+}
+
+}  // namespace
+
+TEST(Keplerian, SolveKepler) {
+    const Eigen::ArrayXd mean = Eigen::ArrayXd::LinSpaced(201, -10.0, 10.0);
+    for (double e : {0.0, 0.1, 0.5, 0.9, 0.99}) {
+        const Eigen::ArrayXd ecc = Eigen::ArrayXd::Constant(mean.size(), e);
+        const Eigen::ArrayXd res =
+            lager::gncpy::dynamics::solveKepler(mean, ecc);
+        const Eigen::ArrayXd resid = res - ecc * res.sin() - mean;
+        EXPECT_LT(resid.abs().maxCoeff(), 1e-12);
+    }
+    EXPECT_NEAR(M_PI, lager::gncpy::dynamics::solveKepler(M_PI, 0.7), 1e-14);
+
+    EXPECT_THROW(lager::gncpy::dynamics::solveKepler(1.0, 1.0),
+                 lager::gncpy::exceptions::BadParams);
+
+    SUCCEED();
+}
+
+TEST(Keplerian, ElementsRoundTrip) {
+    const double mu = TwoBodyJ2::EARTH_MU;
+    const std::vector<OrbitalElements> cases{
+        makeElements(7.0e6, 0.1, 0.9, 1.2, 0.4, 2.5),
+        makeElements(2.6e7, 0.7, 1.1, 5.0, 4.0, 0.3),
+        // circular, equatorial, and both
+        makeElements(7.2e6, 0.0, 0.5, 0.7, 0.0, 1.9),
+        makeElements(4.2e7, 0.2, 0.0, 0.0, 2.1, 4.0),
+        makeElements(4.2e7, 0.0, 0.0, 0.0, 0.0, 3.3),
+    };
+
+    for (const OrbitalElements& exp : cases) {
+        const Eigen::VectorXd state =
+            lager::gncpy::dynamics::elementsToCartesian(exp, mu);
+        const OrbitalElements res =
+            lager::gncpy::dynamics::cartesianToElements(state, mu);
+
+        EXPECT_NEAR(exp.semiMajorAxis, res.semiMajorAxis,
+                    1e-9 * exp.semiMajorAxis);
+        EXPECT_NEAR(exp.eccentricity, res.eccentricity, 1e-12);
+        EXPECT_NEAR(exp.inclination, res.inclination, 1e-12);
+        EXPECT_NEAR(exp.raan, res.raan, 1e-9);
+        EXPECT_NEAR(exp.argPeriapsis, res.argPeriapsis, 1e-9);
+        EXPECT_NEAR(exp.trueAnomaly, res.trueAnomaly, 1e-9);
+
+        EXPECT_TRUE(lager::gncpy::dynamics::elementsToCartesian(res, mu)
+                        .isApprox(state, 1e-12));
+    }
+
+    SUCCEED();
+}
+
+TEST(Keplerian, MatchesIntegration) {
+    const Eigen::VectorXd x0 = lager::gncpy::dynamics::elementsToCartesian(
+        makeElements(9.0e6, 0.3, 0.8, 0.2, 1.0, 0.5));
+
+    const int numSteps = 1200;
+    TwoBodyJ2 integ(1.0, TwoBodyJ2::EARTH_MU, TwoBodyJ2::EARTH_RADIUS, 0.0);
+    Eigen::VectorXd exp = x0;
+    for (int kk = 0; kk < numSteps; kk++) {
+        exp = integ.propagateState(kk * integ.dt(), exp);
+    }
+
+    Keplerian dyn(numSteps * integ.dt());
+    Eigen::VectorXd res = dyn.propagateState(0.0, x0);
+    EXPECT_LT((exp.head(3) - res.head(3)).norm(), 1e-3);
+    EXPECT_LT((exp.tail(3) - res.tail(3)).norm(), 1e-6);
+
+    SUCCEED();
+}
+
+TEST(Keplerian, LongGap) {
+    const OrbitalElements elem = makeElements(7.5e6, 0.05, 1.4, 3.0, 0.2, 0.1);
+    const Eigen::VectorXd x0 =
+        lager::gncpy::dynamics::elementsToCartesian(elem);
+    const double period = 2.0 * M_PI *
+                          std::sqrt(std::pow(elem.semiMajorAxis, 3) /
+                                    TwoBodyJ2::EARTH_MU);
+
+    // a thousand revolutions cost the same as a short step
+    Keplerian shortStep(1234.0);
+    Keplerian longStep(1000.0 * period + 1234.0);
+    Eigen::VectorXd exp = shortStep.propagateState(0.0, x0);
+    Eigen::VectorXd res = longStep.propagateState(0.0, x0);
+    EXPECT_LT((exp.head(3) - res.head(3)).norm(), 1e-2);
+    EXPECT_LT((exp.tail(3) - res.tail(3)).norm(), 1e-5);
+
+    // propagating backwards recovers the start
+    Keplerian backStep(-1234.0);
+    EXPECT_TRUE(backStep.propagateState(0.0, exp).isApprox(x0, 1e-12));
+
+    SUCCEED();
+}
+
+TEST(Keplerian, PropagateBatch) {
+    Keplerian dyn(300.0);
+
+    const Eigen::Index num = 301;
+    Eigen::MatrixXd states(num, 6);
+    Eigen::VectorXd dts(num);
+    for (Eigen::Index ii = 0; ii < num; ii++) {
+        const double frac = static_cast<double>(ii) / static_cast<double>(num);
+        states.row(ii) = lager::gncpy::dynamics::elementsToCartesian(
+                             makeElements(6.8e6 + 3.0e7 * frac, 0.9 * frac,
+                                          3.0 * frac, 1.0, 2.0, 6.0 * frac))
+                             .transpose();
+        dts(ii) = 10.0 + 1.0e5 * frac;
+    }
+
+    Eigen::MatrixXd exp(num, 6);
+    for (Eigen::Index ii = 0; ii < num; ii++) {
+        Keplerian single(dts(ii));
+        exp.row(ii) = single
+                          .propagateState(
+                              0.0, Eigen::VectorXd(states.row(ii).transpose()))
+                          .transpose();
+    }
+    dyn.propagateBatch(0.0, states, dts);
+
+    for (Eigen::Index ii = 0; ii < num; ii++) {
+        EXPECT_TRUE(states.row(ii).isApprox(exp.row(ii), 1e-14));
+    }
+
+    Eigen::MatrixXd escape(1, 6);
+    escape << 7.0e6, 0.0, 0.0, 0.0, 1.2e4, 0.0;
+    EXPECT_THROW(dyn.propagateBatch(0.0, escape),
+                 lager::gncpy::exceptions::BadParams);
+
+    // exactly at escape speed, 2 / r - v^2 / mu is zero
+    Eigen::MatrixXd parabolic(1, 6);
+    parabolic << 2.0 * dyn.mu(), 0.0, 0.0, 0.0, 1.0, 0.0;
+    EXPECT_THROW(dyn.propagateBatch(0.0, parabolic),
+                 lager::gncpy::exceptions::BadParams);
+    EXPECT_THROW(dyn.propagateBatch(0.0, states, Eigen::VectorXd(2)),
+                 lager::gncpy::exceptions::BadParams);
+
+    SUCCEED();
+}
@@ -0,0 +1,157 @@
+#include <gncpy/dynamics/TwoBodyJ2.h>
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <cmath>
+
+#include "gncpy/Exceptions.h"
+
+namespace {
+
+using lager::gncpy::dynamics::TwoBodyJ2;
+
+// circular orbit of the given radius and inclination at the ascending node
+Eigen::VectorXd circularOrbit(double radius, double inc) {
+    const double speed = std::sqrt(TwoBodyJ2::EARTH_MU / radius);
+    Eigen::VectorXd state(6);
+    state << radius, 0.0, 0.0, 0.0, speed * std::cos(inc),
+        speed * std::sin(inc);
+    return state;
+}
+
+}  // namespace
+
+TEST(TwoBodyJ2, CircularOrbit) {
+    const double radius = 7.0e6;
+    const double period =
+        2.0 * M_PI * std::sqrt(std::pow(radius, 3) / TwoBodyJ2::EARTH_MU);
+    const int numSteps = 600;
+    TwoBodyJ2 dyn(period / numSteps, TwoBodyJ2::EARTH_MU,
+                  TwoBodyJ2::EARTH_RADIUS, 0.0);
+
+    const Eigen::VectorXd x0 = circularOrbit(radius, 0.5);
+    Eigen::VectorXd xk = x0;
+    for (int kk = 0; kk < numSteps; kk++) {
+        xk = dyn.propagateState(kk * dyn.dt(), xk);
+    }
+
+    // back to the start after one period
+    EXPECT_LT((xk.head(3) - x0.head(3)).norm(), 1.0);
+    EXPECT_LT((xk.tail(3) - x0.tail(3)).norm(), 1e-3);
+
+    SUCCEED();
+}
+
+TEST(TwoBodyJ2, NodalRegression) {
+    const double radius = 7.0e6;
+    const double inc = 0.9;
+    const double period =
+        2.0 * M_PI * std::sqrt(std::pow(radius, 3) / TwoBodyJ2::EARTH_MU);
+    TwoBodyJ2 dyn(period / 600);
+
+    Eigen::VectorXd xk = circularOrbit(radius, inc);
+    for (int kk = 0; kk < 600; kk++) {
+        xk = dyn.propagateState(kk * dyn.dt(), xk);
+    }
+
+    // first order secular rate of the right ascension for a circular orbit
+    const double meanMotion = 2.0 * M_PI / period;
+    const double nodeRate = -1.5 * meanMotion * TwoBodyJ2::EARTH_J2 *
+                            std::pow(TwoBodyJ2::EARTH_RADIUS / radius, 2) *
+                            std::cos(inc);
+    const Eigen::Vector3d h =
+        xk.head<3>().cross(Eigen::Vector3d(xk.tail<3>()));
+    const double node = std::atan2(h(0), -h(1));
+    EXPECT_NEAR(nodeRate * period, node, 0.05 * std::abs(nodeRate * period));
+
+    SUCCEED();
+}
+
+TEST(TwoBodyJ2, GetContinuousStateMat) {
+    TwoBodyJ2 dyn(10.0);
+    Eigen::VectorXd xk(6);
+    xk << 4.1e6, -3.2e6, 4.5e6, 3.0e3, 5.5e3, -2.0e3;
+
+    // central differences scaled to each element, positions are ~1e6
+    Eigen::MatrixXd exp(6, 6);
+    for (Eigen::Index c = 0; c < 6; c++) {
+        const double step = 1e-6 * std::abs(xk(c));
+        Eigen::VectorXd plus = xk;
+        Eigen::VectorXd minus = xk;
+        plus(c) += step;
+        minus(c) -= step;
+        exp.col(c) = (dyn.continuousDynamics(0.0, plus) -
+                      dyn.continuousDynamics(0.0, minus)) /
+                     (2.0 * step);
+    }
+    Eigen::MatrixXd res = dyn.getContinuousStateMat(0.0, xk);
+
+    ASSERT_EQ(6, res.rows());
+    ASSERT_EQ(6, res.cols());
+    EXPECT_TRUE(res.topRightCorner(3, 3).isIdentity());
+    for (Eigen::Index r = 3; r < 6; r++) {
+        for (Eigen::Index c = 0; c < 3; c++) {
+            EXPECT_NEAR(exp(r, c), res(r, c), 1e-15);
+        }
+    }
+    EXPECT_TRUE(res.bottomLeftCorner(3, 3).isApprox(
+        res.bottomLeftCorner(3, 3).transpose(), 1e-12));
+
+    SUCCEED();
+}
+
+TEST(TwoBodyJ2, GetStateMat) {
+    TwoBodyJ2 dyn(10.0);
+    Eigen::VectorXd xk(6);
+    xk << 4.1e6, -3.2e6, 4.5e6, 3.0e3, 5.5e3, -2.0e3;
+
+    // the transition of the Runge-Kutta step, not the continuous Jacobian
+    Eigen::MatrixXd exp = dyn.getNumericalDiscreteStateMat(0.0, xk);
+    Eigen::MatrixXd res = dyn.getStateMat(0.0, xk);
+
+    ASSERT_EQ(6, res.rows());
+    ASSERT_EQ(6, res.cols());
+    for (Eigen::Index r = 0; r < 6; r++) {
+        for (Eigen::Index c = 0; c < 6; c++) {
+            EXPECT_NEAR(exp(r, c), res(r, c),
+                        1e-5 * std::max(1.0, std::abs(exp(r, c))));
+        }
+    }
+
+    SUCCEED();
+}
+
+TEST(TwoBodyJ2, PropagateBatch) {
+    TwoBodyJ2 dyn(30.0);
+
+    // more objects than one internal block with a partial last block
+    const Eigen::Index num = 301;
+    Eigen::MatrixXd states(num, 6);
+    for (Eigen::Index ii = 0; ii < num; ii++) {
+        const double radius = 6.8e6 + 1.0e4 * static_cast<double>(ii);
+        states.row(ii) =
+            circularOrbit(radius, 0.01 * static_cast<double>(ii)).transpose();
+    }
+
+    Eigen::MatrixXd exp(num, 6);
+    for (Eigen::Index ii = 0; ii < num; ii++) {
+        exp.row(ii) =
+            dyn.propagateState(0.0, Eigen::VectorXd(states.row(ii).transpose()))
+                .transpose();
+    }
+    dyn.propagateBatch(0.0, states);
+
+    for (Eigen::Index ii = 0; ii < num; ii++) {
+        EXPECT_TRUE(states.row(ii).isApprox(exp.row(ii), 1e-13));
+    }
+
+    Eigen::MatrixXd bad(4, 5);
+    EXPECT_THROW(dyn.propagateBatch(0.0, bad),
+                 lager::gncpy::exceptions::BadParams);
+    Eigen::VectorXd badState(4);
+    EXPECT_THROW(dyn.continuousDynamics(0.0, badState),
+                 lager::gncpy::exceptions::BadParams);
+
+    SUCCEED();
+}
@@ -3,9 +3,14 @@
 #include <gtest/gtest.h>
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <cmath>
 #include <math.h>
 
+#include "gncpy/Exceptions.h"
+#include "gncpy/dynamics/CoordinatedTurn.h"
 #include "gncpy/dynamics/CurvilinearMotion.h"
+#include "gncpy/dynamics/Keplerian.h"
 
 #include "gncpy/measurements/RangeAndBearing.h"
 #include "gncpy/dynamics/Parameters.h"
@@ -72,6 +77,69 @@ TEST(EKFTest, FilterPredict) {
     SUCCEED();
 }
 
+TEST(EKFTest, PredictCoordinatedTurn) {
+    double dt = 0.5;
+    auto dynObj =
+        std::make_shared<lager::gncpy::dynamics::CoordinatedTurn>(dt);
+    Eigen::MatrixXd noise = 0.01 * Eigen::MatrixXd::Identity(5, 5);
+
+    lager::gncpy::filters::ExtendedKalman filt;
+    filt.setStateModel(dynObj, noise);
+    Eigen::MatrixXd cov = Eigen::MatrixXd::Identity(5, 5);
+    filt.getCov() = cov;
+
+    Eigen::VectorXd state(5);
+    state << 0.0, 0.0, 10.0, 0.0, 0.2;
+    auto out = filt.predict(0.0, state, std::nullopt);
+
+    // the covariance is propagated with the discrete Jacobian
+    Eigen::MatrixXd stateMat = dynObj->getStateMat(0.0, state);
+    EXPECT_TRUE(out.isApprox(dynObj->propagateState(0.0, state)));
+    EXPECT_TRUE(filt.viewCov().isApprox(stateMat * cov *
+                                            stateMat.transpose() +
+                                        noise));
+
+    SUCCEED();
+}
+
+TEST(EKFTest, PredictKeplerianLongGap) {
+    // several revolutions in one predict
+    auto dynObj = std::make_shared<lager::gncpy::dynamics::Keplerian>(5.0e4);
+    Eigen::MatrixXd noise = 1e-6 * Eigen::MatrixXd::Identity(6, 6);
+
+    lager::gncpy::dynamics::OrbitalElements elem;
+    elem.semiMajorAxis = 7.5e6;
+    elem.eccentricity = 0.2;
+    elem.inclination = 0.9;
+    elem.raan = 1.1;
+    elem.argPeriapsis = 0.4;
+    elem.trueAnomaly = 2.0;
+    const Eigen::VectorXd state =
+        lager::gncpy::dynamics::elementsToCartesian(elem);
+
+    lager::gncpy::filters::ExtendedKalman filt;
+    filt.setStateModel(dynObj, noise);
+    Eigen::VectorXd sigma(6);
+    sigma << 100.0, 100.0, 100.0, 0.1, 0.1, 0.1;
+    Eigen::MatrixXd cov = sigma.array().square().matrix().asDiagonal();
+    filt.getCov() = cov;
+    filt.predict(0.0, state, std::nullopt);
+
+    // the transition must match a finite difference of propagateState
+    Eigen::MatrixXd stateMat = dynObj->getStateMat(0.0, state);
+    Eigen::MatrixXd exp = dynObj->getNumericalDiscreteStateMat(0.0, state);
+    for (Eigen::Index r = 0; r < 6; r++) {
+        for (Eigen::Index c = 0; c < 6; c++) {
+            EXPECT_NEAR(exp(r, c), stateMat(r, c),
+                        1e-5 * std::max(1.0, std::abs(exp(r, c))));
+        }
+    }
+    EXPECT_TRUE(filt.viewCov().isApprox(
+        stateMat * cov * stateMat.transpose() + noise, 1e-12));
+
+    SUCCEED();
+}
+
 TEST(EKFTest, FilterCorrect) {
     Eigen::Matrix4d noise({{0.01, 0.0, 0.0, 0.0},
                            {0.0, 0.01, 0.0, 0.0},
@@ -113,6 +181,59 @@ TEST(EKFTest, FilterCorrect) {
     SUCCEED();
 }
 
+TEST(EKFTest, IteratedCorrect) {
+    Eigen::Matrix2d noise({{0.01, 0.0}, {0.0, 0.01}});
+    auto measObj =
+        std::make_shared<lager::gncpy::measurements::RangeAndBearing>();
+    auto corrParams = lager::gncpy::filters::BayesCorrectParams();
+    corrParams.measParams =
+        std::make_shared<lager::gncpy::measurements::RangeAndBearingParams>(
+            0, 1);
+
+    const Eigen::Vector4d truth({4.0, 1.0, 1.0, 1.0});
+    const Eigen::Vector4d state({2.0, 3.0, 1.0, 1.0});
+    auto meas = measObj->measure(truth, corrParams.measParams.get());
+
+    double measFitProb;
+    lager::gncpy::filters::ExtendedKalman ekf;
+    ekf.getCov() = Eigen::Matrix4d::Identity();
+    ekf.setMeasurementModel(measObj, noise);
+    auto ekfOut = ekf.correct(0.0, meas, state, measFitProb, &corrParams);
+
+    lager::gncpy::filters::ExtendedKalman iekf;
+    iekf.getCov() = Eigen::Matrix4d::Identity();
+    iekf.setMeasurementModel(measObj, noise);
+    iekf.setIterations(20, 1e-10);
+    double iterProb;
+    auto iekfOut = iekf.correct(0.0, meas, state, iterProb, &corrParams);
+
+    EXPECT_DOUBLE_EQ(measFitProb, iterProb);
+    EXPECT_GT(iekf.lastIterations(), 1);
+    EXPECT_LT(iekf.lastIterations(), 20);
+
+    // relinearizing drives the measurement residual to zero
+    Eigen::VectorXd ekfRes =
+        meas - measObj->measure(ekfOut, corrParams.measParams.get());
+    Eigen::VectorXd iekfRes =
+        meas - measObj->measure(iekfOut, corrParams.measParams.get());
+    EXPECT_GT(ekfRes.norm(), 1e-3);
+    EXPECT_LT(iekfRes.norm(), 1e-8);
+
+    // reusing the Jacobian near convergence reaches the same estimate
+    lager::gncpy::filters::ExtendedKalman reuse;
+    reuse.getCov() = Eigen::Matrix4d::Identity();
+    reuse.setMeasurementModel(measObj, noise);
+    reuse.setIterations(20, 1e-10, 1e-2);
+    auto reuseOut = reuse.correct(0.0, meas, state, iterProb, &corrParams);
+    for (uint8_t ii = 0; ii < 4; ii++) {
+        EXPECT_NEAR(iekfOut(ii), reuseOut(ii), 1e-8);
+    }
+
+    EXPECT_THROW(reuse.setIterations(0),
+                 lager::gncpy::exceptions::BadParams);
+
+    SUCCEED();
+}
 
 TEST(EKFTest, serialize) {
     double dt = 0.2;
@@ -133,6 +254,7 @@ TEST(EKFTest, serialize) {
     lager::gncpy::filters::ExtendedKalman filt;
     filt.getCov() = cov;
     filt.setStateModel(dynObj, pNoise);
+    filt.setIterations(3);
 
     std::cout << "Original class:\n" << filt.toJSON() << std::endl;
     std::stringstream classState = filt.saveClassState();
@@ -148,6 +270,7 @@ TEST(EKFTest, serialize) {
             EXPECT_DOUBLE_EQ(filt.viewCov()(r, c), filt2.viewCov()(r, c));
         }
     }
+    EXPECT_EQ(filt.maxIterations(), filt2.maxIterations());
 
     EXPECT_DOUBLE_EQ(
         std::dynamic_pointer_cast<lager::gncpy::dynamics::CurvilinearMotion>(
@@ -157,5 +280,25 @@ TEST(EKFTest, serialize) {
             filt2.dynamicsModel())
             ->dt());
 
+    // loading over a filter bound to another model must drop the old binding
+    auto turnObj =
+        std::make_shared<lager::gncpy::dynamics::CoordinatedTurn>(dt);
+    lager::gncpy::filters::ExtendedKalman filt3;
+    filt3.getCov() = Eigen::MatrixXd::Identity(5, 5);
+    filt3.setStateModel(turnObj, 0.01 * Eigen::MatrixXd::Identity(5, 5));
+    filt3.predict(0.0, Eigen::VectorXd::Zero(5), std::nullopt);
+    turnObj.reset();
+    {
+        std::stringstream state = filt.saveClassState();
+        cereal::PortableBinaryInputArchive ar(state);
+        ar(filt3);
+    }
+
+    Eigen::Vector4d x({1.0, 2.0, 1.0, M_PI / 4});
+    filt.predict(0.0, x, std::nullopt);
+    EXPECT_TRUE(filt3.predict(0.0, x, std::nullopt)
+                    .isApprox(filt2.predict(0.0, x, std::nullopt)));
+    EXPECT_TRUE(filt3.viewCov().isApprox(filt.viewCov()));
+
     SUCCEED();
 }
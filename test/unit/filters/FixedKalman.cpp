@@ -0,0 +1,145 @@
+#include "gncpy/filters/FixedKalman.h"
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+
+#include "gncpy/math/Math.h"
+#include "gncpy/utilities/Allocation.h"
+
+GNCPY_COUNTING_ALLOCATOR
+
+namespace {
+
+using Filter = lager::gncpy::filters::FixedKalman<double, 4, 2>;
+using FilterF = lager::gncpy::filters::FixedKalman<float, 4, 2>;
+
+// double integrator with the positions observed
+template <class Filt>
+void setModels(Filt& filt) {
+    using T = typename Filt::StateVec::Scalar;
+    const T dt = T(0.5);
+    typename Filt::StateMat stateMat = Filt::StateMat::identity();
+    stateMat(0, 2) = dt;
+    stateMat(1, 3) = dt;
+    typename Filt::MeasMat measMat;
+    measMat(0, 0) = T(1);
+    measMat(1, 1) = T(1);
+    typename Filt::MeasCov measNoise{{T(0.2), T(0.05)}, {T(0.05), T(0.3)}};
+
+    filt.setStateModel(stateMat, T(0.01) * Filt::StateMat::identity());
+    filt.setMeasurementModel(measMat, measNoise);
+    filt.getCov() = T(2) * Filt::StateMat::identity();
+}
+
+template <class Filt>
+typename Filt::MeasVec measurement(int kk) {
+    using T = typename Filt::StateVec::Scalar;
+    return typename Filt::MeasVec{T(0.5 * (kk + 1)), T(-0.4 * (kk + 1))};
+}
+
+template <typename T, std::size_t Rows, std::size_t Cols>
+Eigen::MatrixXd toEigen(
+    const lager::gncpy::matrix::Matrix<T, Rows, Cols>& mat) {
+    Eigen::MatrixXd out(Rows, Cols);
+    for (std::size_t r = 0; r < Rows; r++) {
+        for (std::size_t c = 0; c < Cols; c++) {
+            out(r, c) = static_cast<double>(mat(r, c));
+        }
+    }
+    return out;
+}
+
+}  // namespace
+
+TEST(FixedKalmanTest, MatchesCovarianceForm) {
+    Filter filt;
+    setModels(filt);
+
+    const Eigen::MatrixXd stateMat = toEigen(filt.stateMat());
+    const Eigen::MatrixXd procNoise = toEigen(filt.processNoise());
+    const Eigen::MatrixXd measMat = toEigen(filt.measMat());
+    const Eigen::MatrixXd measNoise = toEigen(filt.measNoise());
+
+    Filter::StateVec state{0.0, 0.0, 1.0, -1.0};
+    Eigen::VectorXd expState = toEigen(state);
+    Eigen::MatrixXd expCov = toEigen(filt.viewCov());
+    for (int kk = 0; kk < 5; kk++) {
+        const Filter::MeasVec meas = measurement<Filter>(kk);
+        double prob;
+        state = filt.predict(state);
+        ASSERT_TRUE(filt.correct(meas, state, prob));
+
+        expState = stateMat * expState;
+        expCov = stateMat * expCov * stateMat.transpose() + procNoise;
+        const Eigen::VectorXd estMeas = measMat * expState;
+        const Eigen::MatrixXd inovCov =
+            measMat * expCov * measMat.transpose() + measNoise;
+        const Eigen::MatrixXd gain =
+            expCov * measMat.transpose() * inovCov.inverse();
+        expState += gain * (toEigen(meas) - estMeas);
+        expCov -= gain * measMat * expCov;
+
+        EXPECT_NEAR(lager::gncpy::math::calcGaussianPDF(toEigen(meas),
+                                                        estMeas, inovCov),
+                    prob, 1e-12);
+    }
+
+    EXPECT_TRUE(toEigen(state).isApprox(expState, 1e-12));
+    EXPECT_TRUE(toEigen(filt.viewCov()).isApprox(expCov, 1e-12));
+
+    // an indefinite innovation covariance leaves the estimate alone
+    const Filter::StateVec before = state;
+    filt.setMeasurementModel(filt.measMat(), -10.0 * filt.measNoise());
+    filt.getCov() = Filter::StateMat();
+    double prob;
+    EXPECT_FALSE(filt.correct(measurement<Filter>(0), state, prob));
+    EXPECT_EQ(before, state);
+    EXPECT_EQ(0.0, prob);
+
+    SUCCEED();
+}
+
+TEST(FixedKalmanTest, SinglePrecision) {
+    Filter exp;
+    FilterF res;
+    setModels(exp);
+    setModels(res);
+
+    Filter::StateVec expState{0.0, 0.0, 1.0, -1.0};
+    FilterF::StateVec resState{0.0f, 0.0f, 1.0f, -1.0f};
+    for (int kk = 0; kk < 20; kk++) {
+        double expProb;
+        float resProb;
+        expState = exp.predict(expState);
+        ASSERT_TRUE(exp.correct(measurement<Filter>(kk), expState, expProb));
+        resState = res.predict(resState);
+        ASSERT_TRUE(res.correct(measurement<FilterF>(kk), resState, resProb));
+    }
+
+    EXPECT_TRUE(toEigen(resState).isApprox(toEigen(expState), 1e-5));
+    EXPECT_TRUE(toEigen(res.viewCov()).isApprox(toEigen(exp.viewCov()), 1e-5));
+
+    SUCCEED();
+}
+
+TEST(FixedKalmanTest, NoAllocation) {
+    FilterF filt;
+    setModels(filt);
+    FilterF::StateVec state{0.0f, 0.0f, 1.0f, -1.0f};
+
+    uint64_t before = lager::gncpy::utilities::threadAllocViolations();
+    {
+        lager::gncpy::utilities::NoAllocGuard guard;
+        lager::gncpy::utilities::AllocCounter counter;
+        float prob;
+        for (int kk = 0; kk < 100; kk++) {
+            state = filt.predict(state);
+            filt.correct(measurement<FilterF>(kk), state, prob);
+        }
+        EXPECT_EQ(0, counter.allocations());
+    }
+    EXPECT_EQ(before, lager::gncpy::utilities::threadAllocViolations());
+
+    SUCCEED();
+}
@@ -0,0 +1,176 @@
+#include "gncpy/filters/FusionScheduler.h"
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+#include <thread>
+#include <vector>
+
+#include "gncpy/Exceptions.h"
+#include "gncpy/dynamics/DoubleIntegrator.h"
+#include "gncpy/filters/Kalman.h"
+#include "KalmanFixtures.h"
+
+namespace {
+
+using kalman_fixtures::makeKalman;
+using kalman_fixtures::makeParams;
+
+}  // namespace
+
+TEST(FusionSchedulerTest, MatchesSerialFilter) {
+    auto posParams = makeParams({0, 1});
+    auto velParams = makeParams({2, 3});
+    Eigen::Vector4d x0(0.0, 0.0, 1.0, 0.5);
+
+    lager::gncpy::filters::FusionScheduler sched(2);
+    auto id = sched.addTrack(makeKalman(), 0.0, x0);
+
+    // submitted out of order, the velocity sensor shares time 2 with the
+    // position sensor so only 3 predictions are needed
+    sched.submit(id, 3.0, Eigen::Vector2d(3.1, 1.4), posParams);
+    sched.submit(id, 1.0, Eigen::Vector2d(0.9, 0.6), posParams);
+    sched.submit(id, 2.0, Eigen::Vector2d(2.0, 1.1), posParams);
+    sched.submit(id, 2.0, Eigen::Vector2d(1.0, 0.4), velParams);
+    EXPECT_EQ(4, sched.process());
+    EXPECT_EQ(3, sched.numPredicts());
+    EXPECT_DOUBLE_EQ(3.0, sched.trackTime(id));
+
+    auto ref = makeKalman();
+    lager::gncpy::filters::BayesPredictParams predParams;
+    Eigen::VectorXd state = x0;
+    double prob;
+    state = ref->predict(0.0, state, std::nullopt, &predParams);
+    state = ref->correct(1.0, Eigen::Vector2d(0.9, 0.6), state, prob,
+                         posParams.get());
+    state = ref->predict(1.0, state, std::nullopt, &predParams);
+    state = ref->correct(2.0, Eigen::Vector2d(2.0, 1.1), state, prob,
+                         posParams.get());
+    state = ref->correct(2.0, Eigen::Vector2d(1.0, 0.4), state, prob,
+                         velParams.get());
+    state = ref->predict(2.0, state, std::nullopt, &predParams);
+    state = ref->correct(3.0, Eigen::Vector2d(3.1, 1.4), state, prob,
+                         posParams.get());
+
+    Eigen::VectorXd schedState = sched.trackState(id);
+    Eigen::MatrixXd schedCov = sched.trackCov(id);
+    for (uint8_t ii = 0; ii < 4; ii++) {
+        EXPECT_DOUBLE_EQ(state(ii), schedState(ii));
+        for (uint8_t jj = 0; jj < 4; jj++) {
+            EXPECT_DOUBLE_EQ(ref->viewCov()(ii, jj), schedCov(ii, jj));
+        }
+    }
+
+    // older than the track
+    sched.submit(id, 1.0, Eigen::Vector2d(0.9, 0.6), posParams);
+    EXPECT_EQ(0, sched.process());
+    EXPECT_EQ(1, sched.numDropped());
+
+    EXPECT_THROW(sched.submit(id + 1, 1.0, Eigen::Vector2d(0.0, 0.0)),
+                 lager::gncpy::exceptions::BadParams);
+
+    SUCCEED();
+}
+
+TEST(FusionSchedulerTest, MultiRate) {
+    using lager::gncpy::filters::FusionScheduler;
+    auto posParams = makeParams({0, 1});
+    Eigen::Vector4d x0(0.0, 0.0, 1.0, 0.5);
+    const std::vector<double> times{0.1, 0.35, 2.0, 12.0};
+
+    // radar and AIS rates, none of the gaps is the unit model step
+    FusionScheduler sched(2);
+    auto id = sched.addTrack(makeKalman(), 0.0, x0, nullptr,
+                             FusionScheduler::setModelStep);
+    for (double time : times) {
+        sched.submit(id, time, Eigen::Vector2d(time, 0.5 * time), posParams);
+    }
+    EXPECT_EQ(times.size(), sched.process());
+
+    auto ref = makeKalman();
+    auto refDyn = std::dynamic_pointer_cast<
+        lager::gncpy::dynamics::DoubleIntegrator>(ref->dynamicsModel());
+    lager::gncpy::filters::BayesPredictParams predParams;
+    Eigen::VectorXd state = x0;
+    double prob;
+    double prev = 0.0;
+    for (double time : times) {
+        refDyn->setDt(time - prev);
+        state = ref->predict(prev, state, std::nullopt, &predParams);
+        state = ref->correct(time, Eigen::Vector2d(time, 0.5 * time), state,
+                             prob, posParams.get());
+        prev = time;
+    }
+    EXPECT_TRUE(sched.trackState(id).isApprox(state, 1e-12));
+    EXPECT_TRUE(sched.trackCov(id).isApprox(ref->viewCov(), 1e-12));
+
+    // without a hook a gap other than the model step is rejected, the rest
+    // of the batch is still fused
+    auto fixed = sched.addTrack(makeKalman(), 0.0, x0);
+    sched.submit(fixed, 1.0, Eigen::Vector2d(1.0, 0.5), posParams);
+    sched.submit(fixed, 1.5, Eigen::Vector2d(1.5, 0.75), posParams);
+    sched.submit(fixed, 2.0, Eigen::Vector2d(2.0, 1.0), posParams);
+    EXPECT_EQ(2, sched.process());
+    EXPECT_EQ(1, sched.numRejected());
+    EXPECT_DOUBLE_EQ(2.0, sched.trackTime(fixed));
+
+    // the model is looked up when the track is added
+    EXPECT_THROW(sched.addTrack(
+                     std::make_shared<lager::gncpy::filters::Kalman>(), 0.0,
+                     x0),
+                 lager::gncpy::exceptions::TypeError);
+
+    SUCCEED();
+}
+
+TEST(FusionSchedulerTest, Horizon) {
+    auto posParams = makeParams({0, 1});
+    lager::gncpy::filters::FusionScheduler sched(1);
+    auto id = sched.addTrack(makeKalman(), 0.0, Eigen::Vector4d::Zero());
+
+    sched.submit(id, 1.0, Eigen::Vector2d(1.0, 0.0), posParams);
+    sched.submit(id, 2.0, Eigen::Vector2d(2.0, 0.0), posParams);
+    EXPECT_EQ(1, sched.process(1.5));
+    EXPECT_DOUBLE_EQ(1.0, sched.trackTime(id));
+    EXPECT_EQ(1, sched.process());
+    EXPECT_DOUBLE_EQ(2.0, sched.trackTime(id));
+
+    SUCCEED();
+}
+
+TEST(FusionSchedulerTest, ConcurrentProducers) {
+    auto posParams = makeParams({0, 1});
+    const int numTracks = 16;
+    const int numSteps = 20;
+
+    lager::gncpy::filters::FusionScheduler sched(4);
+    std::vector<lager::gncpy::filters::FusionScheduler::TrackId> ids;
+    for (int ii = 0; ii < numTracks; ii++) {
+        ids.push_back(
+            sched.addTrack(makeKalman(), 0.0, Eigen::Vector4d(ii, 0, 1, 0)));
+    }
+
+    // two producers feed every track, each owns alternating timesteps
+    auto produce = [&](int offset) {
+        for (int kk = offset; kk <= numSteps; kk += 2) {
+            for (int ii = 0; ii < numTracks; ii++) {
+                sched.submit(ids[ii], kk, Eigen::Vector2d(ii + kk, 0.0),
+                             posParams);
+            }
+        }
+    };
+    std::thread radar(produce, 1);
+    std::thread eo(produce, 2);
+    radar.join();
+    eo.join();
+
+    EXPECT_EQ(numTracks * numSteps, sched.process());
+    EXPECT_EQ(numTracks * numSteps, sched.numPredicts());
+    EXPECT_EQ(0, sched.numDropped());
+    for (int ii = 0; ii < numTracks; ii++) {
+        EXPECT_DOUBLE_EQ(numSteps, sched.trackTime(ids[ii]));
+        EXPECT_NEAR(ii + numSteps, sched.trackState(ids[ii])(0), 1e-6);
+    }
+
+    SUCCEED();
+}
@@ -0,0 +1,153 @@
+#include "gncpy/filters/GMPHD.h"
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <limits>
+
+#include "gncpy/Exceptions.h"
+#include "gncpy/dynamics/DoubleIntegrator.h"
+#include "gncpy/filters/Parameters.h"
+#include "gncpy/measurements/StateObservation.h"
+
+namespace {
+
+lager::gncpy::filters::GMPHD makeFilter(double dt) {
+    auto dynObj =
+        std::make_shared<lager::gncpy::dynamics::DoubleIntegrator>(dt);
+    auto measObj =
+        std::make_shared<lager::gncpy::measurements::StateObservation>();
+
+    lager::gncpy::filters::GMPHD filt;
+    filt.setStateModel(dynObj, 0.01 * Eigen::Matrix4d::Identity());
+    filt.setMeasurementModel(measObj, 0.1 * Eigen::Matrix2d::Identity());
+
+    lager::gncpy::filters::GaussianMixture birth(4);
+    Eigen::Matrix4d birthCov = Eigen::Vector4d(4.0, 4.0, 1.0, 1.0).asDiagonal();
+    birth.add(0.1, Eigen::Vector4d(0.0, 0.0, 1.0, 0.0), birthCov);
+    birth.add(0.1, Eigen::Vector4d(20.0, 20.0, 0.0, -1.0), birthCov);
+    filt.setBirthModel(birth);
+
+    return filt;
+}
+
+}  // namespace
+
+TEST(GMPHDTest, MixtureStorage) {
+    lager::gncpy::filters::GaussianMixture mix(2);
+    for (int ii = 0; ii < 10; ii++) {
+        mix.add(ii, Eigen::Vector2d(ii, -ii), ii * Eigen::Matrix2d::Identity());
+    }
+
+    EXPECT_EQ(10, mix.size());
+    EXPECT_EQ(10, mix.means().cols());
+    EXPECT_EQ(20, mix.covs().cols());
+    EXPECT_DOUBLE_EQ(45.0, mix.totalWeight());
+    EXPECT_DOUBLE_EQ(-7.0, mix.mean(7)(1));
+    EXPECT_DOUBLE_EQ(7.0, mix.cov(7)(1, 1));
+
+    EXPECT_THROW(mix.add(1.0, Eigen::Vector3d::Zero(),
+                         Eigen::Matrix3d::Identity()),
+                 lager::gncpy::exceptions::BadParams);
+
+    SUCCEED();
+}
+
+TEST(GMPHDTest, Merge) {
+    auto filt = makeFilter(1.0);
+    auto& mix = filt.mixture();
+    mix.add(0.5, Eigen::Vector4d(0.0, 0.0, 1.0, 0.0),
+            Eigen::Matrix4d::Identity());
+    mix.add(0.3, Eigen::Vector4d(0.1, 0.1, 1.0, 0.0),
+            Eigen::Matrix4d::Identity());
+    mix.add(0.4, Eigen::Vector4d(50.0, 50.0, 1.0, 0.0),
+            Eigen::Matrix4d::Identity());
+
+    filt.merge();
+
+    ASSERT_EQ(2, filt.viewMixture().size());
+    EXPECT_NEAR(1.2, filt.expectedCardinality(), 1e-12);
+
+    auto& merged = filt.viewMixture();
+    Eigen::Index ind = merged.weight(0) > merged.weight(1) ? 0 : 1;
+    EXPECT_NEAR(0.8, merged.weight(ind), 1e-12);
+    EXPECT_NEAR(0.3 * 0.1 / 0.8, merged.mean(ind)(0), 1e-12);
+
+    // far apart means must not overflow the grid cells
+    mix.add(0.2, Eigen::Vector4d(1.0e300, -1.0e300, 0.0, 0.0),
+            Eigen::Matrix4d::Identity());
+    EXPECT_NO_THROW(filt.merge());
+    EXPECT_EQ(3, filt.viewMixture().size());
+
+    mix.add(0.2,
+            Eigen::Vector4d(std::numeric_limits<double>::quiet_NaN(), 0.0,
+                            0.0, 0.0),
+            Eigen::Matrix4d::Identity());
+    EXPECT_THROW(filt.merge(), lager::gncpy::exceptions::BadParams);
+
+    SUCCEED();
+}
+
+TEST(GMPHDTest, PruneAndCap) {
+    auto filt = makeFilter(1.0);
+    for (int ii = 0; ii < 20; ii++) {
+        filt.mixture().add(ii < 5 ? 1e-8 : 0.01 * ii,
+                           Eigen::Vector4d(10.0 * ii, 0.0, 0.0, 0.0),
+                           Eigen::Matrix4d::Identity());
+    }
+    filt.maxComponents = 10;
+
+    filt.prune();
+    EXPECT_EQ(15, filt.viewMixture().size());
+
+    filt.cap();
+    ASSERT_EQ(10, filt.viewMixture().size());
+    for (Eigen::Index j = 0; j < filt.viewMixture().size(); j++) {
+        EXPECT_GE(filt.viewMixture().weight(j), 0.1 - 1e-12);
+    }
+
+    SUCCEED();
+}
+
+TEST(GMPHDTest, TrackTwoTargets) {
+    double dt = 1.0;
+    auto filt = makeFilter(dt);
+
+    lager::gncpy::filters::BayesPredictParams predParams;
+    lager::gncpy::filters::BayesCorrectParams corrParams;
+    corrParams.measParams =
+        std::make_shared<lager::gncpy::measurements::StateObservationParams>(
+            std::vector<uint8_t>{0, 1});
+
+    Eigen::Vector4d truth0(0.0, 0.0, 1.0, 0.0);
+    Eigen::Vector4d truth1(20.0, 20.0, 0.0, -1.0);
+    for (int kk = 0; kk < 10; kk++) {
+        double t = kk * dt;
+        filt.predict(t, &predParams);
+
+        Eigen::MatrixXd meas(2, 3);
+        meas.col(0) = truth0.head(2);
+        meas.col(1) = truth1.head(2);
+        meas.col(2) << -40.0 + kk, 35.0;  // clutter
+
+        filt.correct(t, meas, &corrParams);
+        filt.cleanup();
+
+        truth0(0) += dt * truth0(2);
+        truth1(1) += dt * truth1(3);
+    }
+
+    EXPECT_NEAR(2.0, filt.expectedCardinality(), 0.3);
+
+    auto states = filt.extractStates();
+    ASSERT_EQ(2, states.size());
+    std::sort(states.begin(), states.end(),
+              [](const auto& a, const auto& b) { return a(0) < b(0); });
+    EXPECT_NEAR(9.0, states[0](0), 0.5);
+    EXPECT_NEAR(0.0, states[0](1), 0.5);
+    EXPECT_NEAR(20.0, states[1](0), 0.5);
+    EXPECT_NEAR(11.0, states[1](1), 0.5);
+
+    SUCCEED();
+}
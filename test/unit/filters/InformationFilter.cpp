@@ -0,0 +1,264 @@
+#include "gncpy/filters/InformationFilter.h"
+
+#include <gtest/gtest.h>
+#include <math.h>
+
+#include <Eigen/Dense>
+#include <vector>
+
+#include "gncpy/Exceptions.h"
+#include "gncpy/dynamics/CurvilinearMotion.h"
+#include "gncpy/dynamics/DoubleIntegrator.h"
+#include "gncpy/filters/ExtendedInformationFilter.h"
+#include "gncpy/filters/Parameters.h"
+#include "gncpy/measurements/RangeAndBearing.h"
+#include "gncpy/measurements/StateObservation.h"
+
+namespace {
+
+// covariance form update including the measurement noise
+void covUpdate(const Eigen::MatrixXd& measMat, const Eigen::MatrixXd& measNoise,
+               const Eigen::VectorXd& inov, Eigen::VectorXd& state,
+               Eigen::MatrixXd& cov) {
+    Eigen::MatrixXd inovCov = measMat * cov * measMat.transpose() + measNoise;
+    Eigen::MatrixXd gain = cov * measMat.transpose() * inovCov.inverse();
+    state += gain * inov;
+    cov -= gain * measMat * cov;
+}
+
+// observes the positions and counts how often the model is evaluated
+class CountingObservation final
+    : public lager::gncpy::measurements::IMeasModel {
+   public:
+    Eigen::VectorXd measure(
+        const Eigen::VectorXd& state,
+        [[maybe_unused]] const lager::gncpy::measurements::MeasParams* params =
+            nullptr) const override {
+        numMeasure++;
+        return state.head(2);
+    }
+    Eigen::MatrixXd getMeasMat(
+        [[maybe_unused]] const Eigen::VectorXd& state,
+        [[maybe_unused]] const lager::gncpy::measurements::MeasParams* params =
+            nullptr) const override {
+        numMeasMat++;
+        return Eigen::MatrixXd::Identity(2, 4);
+    }
+
+    mutable int numMeasure = 0;
+    mutable int numMeasMat = 0;
+};
+
+}  // namespace
+
+TEST(InfoFilterTest, SetModels) {
+    lager::gncpy::filters::InformationFilter filt;
+    auto dynObj =
+        std::make_shared<lager::gncpy::dynamics::DoubleIntegrator>(1.0);
+    auto measObj =
+        std::make_shared<lager::gncpy::measurements::StateObservation>();
+
+    EXPECT_NO_THROW(filt.setStateModel(dynObj, Eigen::Matrix4d::Identity()));
+    EXPECT_THROW(filt.setStateModel(
+                     std::make_shared<
+                         lager::gncpy::dynamics::CurvilinearMotion>(),
+                     Eigen::Matrix4d::Identity()),
+                 lager::gncpy::exceptions::TypeError);
+    EXPECT_THROW(filt.setMeasurementModel(measObj, Eigen::Matrix2d::Zero()),
+                 lager::gncpy::exceptions::BadParams);
+
+    SUCCEED();
+}
+
+TEST(InfoFilterTest, MatchesCovarianceForm) {
+    auto dynObj =
+        std::make_shared<lager::gncpy::dynamics::DoubleIntegrator>(0.5);
+    auto measObj =
+        std::make_shared<lager::gncpy::measurements::StateObservation>();
+    Eigen::Matrix4d procNoise = 0.01 * Eigen::Matrix4d::Identity();
+    Eigen::Matrix2d measNoise{{0.2, 0.05}, {0.05, 0.3}};
+
+    lager::gncpy::filters::InformationFilter filt;
+    filt.setStateModel(dynObj, procNoise);
+    filt.setMeasurementModel(measObj, measNoise);
+    filt.getCov() = 2.0 * Eigen::Matrix4d::Identity();
+
+    lager::gncpy::filters::BayesPredictParams predParams;
+    lager::gncpy::filters::BayesCorrectParams corrParams;
+    corrParams.measParams =
+        std::make_shared<lager::gncpy::measurements::StateObservationParams>(
+            std::vector<uint8_t>{0, 1});
+
+    Eigen::VectorXd state = Eigen::Vector4d(0.0, 0.0, 1.0, -1.0);
+    Eigen::VectorXd expState = state;
+    Eigen::MatrixXd expCov = 2.0 * Eigen::Matrix4d::Identity();
+    Eigen::MatrixXd stateMat = dynObj->getStateMat(0.0);
+    Eigen::MatrixXd measMat =
+        measObj->getMeasMat(state, corrParams.measParams.get());
+
+    double prob;
+    for (int kk = 0; kk < 5; kk++) {
+        Eigen::Vector2d meas(0.5 * (kk + 1), -0.4 * (kk + 1));
+
+        state = filt.predict(0.5 * kk, state, std::nullopt, &predParams);
+        state = filt.correct(0.5 * (kk + 1), meas, state, prob, &corrParams);
+
+        expState = stateMat * expState;
+        expCov = stateMat * expCov * stateMat.transpose() + procNoise;
+        covUpdate(measMat, measNoise, meas - measMat * expState, expState,
+                  expCov);
+    }
+
+    for (uint8_t ii = 0; ii < 4; ii++) {
+        EXPECT_NEAR(expState(ii), state(ii), 1e-10);
+        for (uint8_t jj = 0; jj < 4; jj++) {
+            EXPECT_NEAR(expCov(ii, jj), filt.viewCov()(ii, jj), 1e-10);
+        }
+    }
+    Eigen::MatrixXd ident = filt.viewInfo() * filt.viewCov();
+    EXPECT_TRUE(ident.isIdentity(1e-10));
+
+    SUCCEED();
+}
+
+TEST(InfoFilterTest, AdditiveContributions) {
+    auto measObj =
+        std::make_shared<lager::gncpy::measurements::StateObservation>();
+    Eigen::Matrix2d measNoise = 0.1 * Eigen::Matrix2d::Identity();
+    Eigen::Matrix4d cov = Eigen::Vector4d(4.0, 3.0, 2.0, 1.0).asDiagonal();
+    Eigen::VectorXd state = Eigen::Vector4d(1.0, 2.0, 3.0, 4.0);
+
+    std::vector<lager::gncpy::filters::BayesCorrectParams> params(3);
+    std::vector<std::vector<uint8_t>> inds{{0, 1}, {2, 3}, {0, 2}};
+    std::vector<Eigen::VectorXd> meas{Eigen::Vector2d(1.2, 1.8),
+                                      Eigen::Vector2d(3.3, 3.9),
+                                      Eigen::Vector2d(0.9, 3.1)};
+    for (size_t ii = 0; ii < params.size(); ii++) {
+        params[ii].measParams = std::make_shared<
+            lager::gncpy::measurements::StateObservationParams>(inds[ii]);
+    }
+
+    lager::gncpy::filters::InformationFilter seq;
+    seq.setMeasurementModel(measObj, measNoise);
+    seq.getCov() = cov;
+    Eigen::VectorXd seqState = state;
+    double prob;
+    for (size_t ii = 0; ii < params.size(); ii++) {
+        seqState = seq.correct(0.0, meas[ii], seqState, prob, &params[ii]);
+    }
+
+    lager::gncpy::filters::InformationFilter batch;
+    batch.setMeasurementModel(measObj, measNoise);
+    batch.getCov() = cov;
+    lager::gncpy::filters::InfoContribution total;
+    for (size_t ii = params.size(); ii-- > 0;) {
+        total += batch.contribution(meas[ii], state, &params[ii]);
+    }
+    Eigen::VectorXd batchState = batch.fuse(state, total);
+
+    for (uint8_t ii = 0; ii < 4; ii++) {
+        EXPECT_NEAR(seqState(ii), batchState(ii), 1e-10);
+        for (uint8_t jj = 0; jj < 4; jj++) {
+            EXPECT_NEAR(seq.viewInfo()(ii, jj), batch.viewInfo()(ii, jj),
+                        1e-10);
+        }
+    }
+
+    SUCCEED();
+}
+
+TEST(InfoFilterTest, ExtendedCorrect) {
+    Eigen::Matrix2d measNoise{{0.01, 0.0}, {0.0, 1.0 * M_PI / 180}};
+    auto measObj =
+        std::make_shared<lager::gncpy::measurements::RangeAndBearing>();
+    lager::gncpy::filters::BayesCorrectParams corrParams;
+    corrParams.measParams =
+        std::make_shared<lager::gncpy::measurements::RangeAndBearingParams>(0,
+                                                                            1);
+
+    lager::gncpy::filters::ExtendedInformationFilter filt;
+    filt.setStateModel(
+        std::make_shared<lager::gncpy::dynamics::CurvilinearMotion>(),
+        0.01 * Eigen::Matrix4d::Identity());
+    filt.setMeasurementModel(measObj, measNoise);
+    filt.getCov() = Eigen::Matrix4d::Identity();
+
+    Eigen::VectorXd state = Eigen::Vector4d(2.0, 3.0, 1.0, 1.0);
+    Eigen::VectorXd meas = measObj->measure(Eigen::Vector4d(2.2, 2.9, 1.0, 1.0),
+                                            corrParams.measParams.get());
+
+    Eigen::VectorXd expState = state;
+    Eigen::MatrixXd expCov = Eigen::Matrix4d::Identity();
+    covUpdate(measObj->getMeasMat(state, corrParams.measParams.get()),
+              measNoise,
+              meas - measObj->measure(state, corrParams.measParams.get()),
+              expState, expCov);
+
+    double prob;
+    auto out = filt.correct(0.0, meas, state, prob, &corrParams);
+    for (uint8_t ii = 0; ii < 4; ii++) {
+        EXPECT_NEAR(expState(ii), out(ii), 1e-8);
+        for (uint8_t jj = 0; jj < 4; jj++) {
+            EXPECT_NEAR(expCov(ii, jj), filt.viewCov()(ii, jj), 1e-8);
+        }
+    }
+
+    SUCCEED();
+}
+
+TEST(InfoFilterTest, ExtendedPredictRebinds) {
+    auto nonLin =
+        std::make_shared<lager::gncpy::dynamics::CurvilinearMotion>(0.1);
+    auto lin = std::make_shared<lager::gncpy::dynamics::DoubleIntegrator>(0.5);
+    Eigen::Matrix4d procNoise = 0.01 * Eigen::Matrix4d::Identity();
+
+    lager::gncpy::filters::ExtendedInformationFilter filt;
+    filt.setStateModel(nonLin, procNoise);
+    filt.getCov() = Eigen::Matrix4d::Identity();
+
+    // the non-linear model is linearized about the current estimate
+    Eigen::VectorXd state = Eigen::Vector4d(2.0, 3.0, 1.0, 0.3);
+    Eigen::MatrixXd stateMat = nonLin->getStateMat(0.0, state);
+    Eigen::MatrixXd expCov =
+        stateMat * stateMat.transpose() + Eigen::MatrixXd(procNoise);
+    filt.predict(0.0, state, std::nullopt);
+    EXPECT_TRUE(expCov.isApprox(filt.viewCov(), 1e-10));
+
+    // swapping in a linear model must drop the cached non-linear view
+    filt.setStateModel(lin, procNoise);
+    stateMat = lin->getStateMat(0.0);
+    expCov = stateMat * expCov * stateMat.transpose() + procNoise;
+    filt.predict(0.0, state, std::nullopt);
+    EXPECT_TRUE(expCov.isApprox(filt.viewCov(), 1e-10));
+
+    SUCCEED();
+}
+
+TEST(InfoFilterTest, CorrectEvaluatesModelOnce) {
+    auto measObj = std::make_shared<CountingObservation>();
+    Eigen::Matrix2d measNoise{{0.2, 0.05}, {0.05, 0.3}};
+
+    lager::gncpy::filters::ExtendedInformationFilter filt;
+    filt.setStateModel(
+        std::make_shared<lager::gncpy::dynamics::DoubleIntegrator>(0.5),
+        0.01 * Eigen::Matrix4d::Identity());
+    filt.setMeasurementModel(measObj, measNoise);
+    filt.getCov() = Eigen::Matrix4d::Identity();
+
+    Eigen::VectorXd state = Eigen::Vector4d(1.0, 2.0, 0.5, -0.5);
+    Eigen::VectorXd expState = state;
+    Eigen::MatrixXd expCov = Eigen::Matrix4d::Identity();
+    Eigen::Vector2d meas(1.2, 1.9);
+    covUpdate(Eigen::MatrixXd::Identity(2, 4), measNoise,
+              meas - state.head(2), expState, expCov);
+
+    // the fit probability and the contribution share one linearization
+    double prob;
+    auto out = filt.correct(0.0, meas, state, prob);
+    EXPECT_EQ(1, measObj->numMeasure);
+    EXPECT_EQ(1, measObj->numMeasMat);
+    EXPECT_TRUE(expState.isApprox(out, 1e-10));
+    EXPECT_TRUE(expCov.isApprox(filt.viewCov(), 1e-10));
+
+    SUCCEED();
+}
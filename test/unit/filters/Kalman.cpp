@@ -4,6 +4,7 @@
 
 #include <Eigen/Dense>
 
+#include "gncpy/Exceptions.h"
 #include "gncpy/dynamics/DoubleIntegrator.h"
 #include "gncpy/dynamics/Parameters.h"
 #include "gncpy/filters/Parameters.h"
@@ -88,6 +89,29 @@ TEST(KFTest, FilterPredict) {
     SUCCEED();
 }
 
+TEST(KFTest, PredictWithoutParams) {
+    auto dynObj =
+        std::make_shared<lager::gncpy::dynamics::DoubleIntegrator>(1.0);
+    Eigen::Vector4d state({1.0, 2.0, 1.0, 1.0});
+    const Eigen::Vector4d exp({2.0, 3.0, 1.0, 1.0});
+
+    lager::gncpy::filters::Kalman filt;
+    filt.getCov() = Eigen::Matrix4d::Identity();
+
+    Eigen::VectorXd out;
+    EXPECT_THROW(out = filt.predict(0.0, state, std::nullopt),
+                 lager::gncpy::exceptions::TypeError);
+
+    filt.setStateModel(dynObj, 0.1 * Eigen::Matrix4d::Identity());
+    out = filt.predict(0.0, state, std::nullopt);
+
+    for (uint8_t ii = 0; ii < exp.size(); ii++) {
+        EXPECT_EQ(exp(ii), out(ii));
+    }
+
+    SUCCEED();
+}
+
 TEST(KFTest, FilterCorrect) {
     Eigen::Matrix4d noise({{0.01, 0.0, 0.0, 0.0},
                            {0.0, 0.01, 0.0, 0.0},
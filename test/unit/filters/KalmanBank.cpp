@@ -0,0 +1,238 @@
+#include "gncpy/filters/KalmanBank.h"
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+#include <memory>
+#include <vector>
+
+#include "gncpy/Exceptions.h"
+#include "gncpy/dynamics/CurvilinearMotion.h"
+#include "gncpy/dynamics/DoubleIntegrator.h"
+#include "gncpy/measurements/StateObservation.h"
+#include "gncpy/utilities/Allocation.h"
+
+GNCPY_COUNTING_ALLOCATOR
+
+namespace {
+
+// tracks start spread out with different covariances
+void initialTracks(Eigen::Index num, Eigen::MatrixXd& states,
+                   Eigen::MatrixXd& covs) {
+    states.resize(4, num);
+    covs.resize(4, 4 * num);
+    for (Eigen::Index ii = 0; ii < num; ii++) {
+        const double frac = static_cast<double>(ii) / static_cast<double>(num);
+        states.col(ii) = Eigen::Vector4d(10.0 * frac, -5.0 * frac, 1.0, -1.0);
+        covs.middleCols(4 * ii, 4) =
+            Eigen::Vector4d(2.0 + frac, 1.5, 1.0 + frac, 0.5).asDiagonal();
+    }
+}
+
+Eigen::MatrixXd measurements(Eigen::Index num, int kk) {
+    Eigen::MatrixXd out(2, num);
+    for (Eigen::Index ii = 0; ii < num; ii++) {
+        out.col(ii) =
+            Eigen::Vector2d(0.5 * (kk + 1) + 0.1 * static_cast<double>(ii),
+                            -0.4 * (kk + 1));
+    }
+    return out;
+}
+
+}  // namespace
+
+TEST(KalmanBankTest, SetModels) {
+    lager::gncpy::filters::KalmanBank<float> bank;
+    auto dynObj =
+        std::make_shared<lager::gncpy::dynamics::DoubleIntegrator>(1.0);
+    auto measObj =
+        std::make_shared<lager::gncpy::measurements::StateObservation>();
+
+    EXPECT_NO_THROW(bank.setStateModel(dynObj, Eigen::Matrix4d::Identity()));
+    EXPECT_THROW(bank.setStateModel(
+                     std::make_shared<
+                         lager::gncpy::dynamics::CurvilinearMotion>(),
+                     Eigen::Matrix4d::Identity()),
+                 lager::gncpy::exceptions::TypeError);
+    EXPECT_THROW(bank.setStateModel(dynObj, Eigen::Matrix2d::Identity()),
+                 lager::gncpy::exceptions::BadParams);
+    EXPECT_THROW(bank.setTracks(Eigen::MatrixXf::Zero(4, 3),
+                                Eigen::MatrixXf::Zero(4, 4)),
+                 lager::gncpy::exceptions::BadParams);
+
+    SUCCEED();
+}
+
+TEST(KalmanBankTest, MatchesSingleTrack) {
+    auto dynObj =
+        std::make_shared<lager::gncpy::dynamics::DoubleIntegrator>(0.5);
+    auto measObj =
+        std::make_shared<lager::gncpy::measurements::StateObservation>();
+    Eigen::Matrix4d procNoise = 0.01 * Eigen::Matrix4d::Identity();
+    Eigen::Matrix2d measNoise{{0.2, 0.05}, {0.05, 0.3}};
+    auto measParams =
+        std::make_shared<lager::gncpy::measurements::StateObservationParams>(
+            std::vector<uint8_t>{0, 1});
+
+    const Eigen::Index num = 7;
+    Eigen::MatrixXd states;
+    Eigen::MatrixXd covs;
+    initialTracks(num, states, covs);
+
+    lager::gncpy::filters::KalmanBank<double> bank;
+    bank.setStateModel(dynObj, procNoise);
+    bank.setMeasurementModel(measObj, measNoise);
+    bank.setTracks(states, covs);
+
+    Eigen::MatrixXd stateMat = dynObj->getStateMat(0.0);
+    Eigen::MatrixXd measMat =
+        measObj->getMeasMat(states.col(0), measParams.get());
+    for (int kk = 0; kk < 5; kk++) {
+        const Eigen::MatrixXd meas = measurements(num, kk);
+        bank.predict(0.5 * kk);
+        bank.correct(0.5 * (kk + 1), meas, measParams.get());
+
+        for (Eigen::Index ii = 0; ii < num; ii++) {
+            Eigen::VectorXd state = stateMat * states.col(ii);
+            Eigen::MatrixXd cov =
+                stateMat * covs.middleCols(4 * ii, 4) * stateMat.transpose() +
+                procNoise;
+            Eigen::MatrixXd inovCov =
+                measMat * cov * measMat.transpose() + measNoise;
+            Eigen::MatrixXd gain =
+                cov * measMat.transpose() * inovCov.inverse();
+            state += gain * (meas.col(ii) - measMat * state);
+            cov -= gain * measMat * cov;
+            states.col(ii) = state;
+            covs.middleCols(4 * ii, 4) = cov;
+        }
+    }
+
+    EXPECT_TRUE(bank.states().isApprox(states, 1e-12));
+    EXPECT_TRUE(bank.covs().isApprox(covs, 1e-12));
+    EXPECT_TRUE(bank.cov(3).isApprox(covs.middleCols(12, 4), 1e-12));
+
+    EXPECT_THROW(bank.correct(0.0, Eigen::MatrixXd::Zero(2, num - 1),
+                              measParams.get()),
+                 lager::gncpy::exceptions::BadParams);
+
+    SUCCEED();
+}
+
+TEST(KalmanBankTest, FailedCorrectLeavesBank) {
+    auto dynObj =
+        std::make_shared<lager::gncpy::dynamics::DoubleIntegrator>(0.5);
+    auto measObj =
+        std::make_shared<lager::gncpy::measurements::StateObservation>();
+    auto measParams =
+        std::make_shared<lager::gncpy::measurements::StateObservationParams>(
+            std::vector<uint8_t>{0, 1});
+
+    // only the last track has an innovation covariance that is not positive
+    // definite
+    const Eigen::Index num = 5;
+    Eigen::MatrixXd states;
+    Eigen::MatrixXd covs;
+    initialTracks(num, states, covs);
+    covs.middleCols(4 * (num - 1), 4) = -Eigen::Matrix4d::Identity();
+
+    lager::gncpy::filters::KalmanBank<double> bank;
+    bank.setStateModel(dynObj, 0.01 * Eigen::Matrix4d::Identity());
+    bank.setMeasurementModel(measObj, 0.2 * Eigen::Matrix2d::Identity());
+    bank.setTracks(states, covs);
+
+    EXPECT_THROW(bank.correct(0.0, measurements(num, 0), measParams.get()),
+                 lager::gncpy::exceptions::BadParams);
+    EXPECT_TRUE(bank.states() == states);
+    EXPECT_TRUE(bank.covs() == covs);
+
+    SUCCEED();
+}
+
+TEST(KalmanBankTest, FloatMatchesDouble) {
+    auto dynObj =
+        std::make_shared<lager::gncpy::dynamics::DoubleIntegrator>(0.5);
+    auto measObj =
+        std::make_shared<lager::gncpy::measurements::StateObservation>();
+    Eigen::Matrix4d procNoise = 0.01 * Eigen::Matrix4d::Identity();
+    Eigen::Matrix2d measNoise = 0.2 * Eigen::Matrix2d::Identity();
+    auto measParams =
+        std::make_shared<lager::gncpy::measurements::StateObservationParams>(
+            std::vector<uint8_t>{0, 1});
+
+    const Eigen::Index num = 64;
+    Eigen::MatrixXd states;
+    Eigen::MatrixXd covs;
+    initialTracks(num, states, covs);
+
+    lager::gncpy::filters::KalmanBank<double> exp;
+    exp.setStateModel(dynObj, procNoise);
+    exp.setMeasurementModel(measObj, measNoise);
+    exp.setTracks(states, covs);
+
+    lager::gncpy::filters::KalmanBank<float> res;
+    res.setStateModel(dynObj, procNoise);
+    res.setMeasurementModel(measObj, measNoise);
+    res.setTracks(states.cast<float>(), covs.cast<float>());
+
+    for (int kk = 0; kk < 20; kk++) {
+        const Eigen::MatrixXd meas = measurements(num, kk);
+        exp.predict(0.5 * kk);
+        exp.correct(0.5 * (kk + 1), meas, measParams.get());
+        res.predict(0.5 * kk);
+        res.correct(0.5 * (kk + 1), meas.cast<float>(), measParams.get());
+    }
+
+    const Eigen::MatrixXd stateErr = res.states().cast<double>() - exp.states();
+    EXPECT_LT(stateErr.cwiseAbs().maxCoeff(), 1e-4);
+    EXPECT_LT((res.covs().cast<double>() - exp.covs()).cwiseAbs().maxCoeff(),
+              1e-5);
+
+    SUCCEED();
+}
+
+TEST(KalmanBankTest, SteadyStateAllocations) {
+    auto dynObj =
+        std::make_shared<lager::gncpy::dynamics::DoubleIntegrator>(0.5);
+    auto measObj =
+        std::make_shared<lager::gncpy::measurements::StateObservation>();
+    auto measParams =
+        std::make_shared<lager::gncpy::measurements::StateObservationParams>(
+            std::vector<uint8_t>{0, 1});
+
+    const Eigen::Index num = 64;
+    Eigen::MatrixXd states;
+    Eigen::MatrixXd covs;
+    initialTracks(num, states, covs);
+    const Eigen::MatrixXf meas = measurements(num, 0).cast<float>();
+
+    lager::gncpy::filters::KalmanBank<float> bank;
+    bank.setStateModel(dynObj, 0.01 * Eigen::Matrix4d::Identity());
+    bank.setMeasurementModel(measObj, 0.2 * Eigen::Matrix2d::Identity());
+    bank.setTracks(states.cast<float>(), covs.cast<float>());
+
+    // the first step sizes the workspace
+    bank.predict(0.0);
+    bank.correct(0.5, meas, measParams.get());
+
+    // the models return their matrices by value, everything else reuses the
+    // workspace
+    const Eigen::VectorXd state = states.col(0);
+    uint64_t modelAllocs;
+    {
+        lager::gncpy::utilities::AllocCounter counter;
+        for (int kk = 0; kk < 10; kk++) {
+            dynObj->getStateMat(0.5 * kk);
+            measObj->getMeasMat(state, measParams.get());
+        }
+        modelAllocs = counter.allocations();
+    }
+    lager::gncpy::utilities::AllocCounter counter;
+    for (int kk = 0; kk < 10; kk++) {
+        bank.predict(0.5 * kk);
+        bank.correct(0.5 * (kk + 1), meas, measParams.get());
+    }
+    EXPECT_EQ(modelAllocs, counter.allocations());
+
+    SUCCEED();
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <Eigen/Dense>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "gncpy/dynamics/DoubleIntegrator.h"
+#include "gncpy/filters/Kalman.h"
+#include "gncpy/filters/Parameters.h"
+#include "gncpy/measurements/StateObservation.h"
+
+// Filters shared by the tests of the classes that wrap a Kalman filter
+namespace kalman_fixtures {
+
+// double integrator with unit time step, observed through StateObservation
+inline std::shared_ptr<lager::gncpy::filters::Kalman> makeKalman() {
+    auto dynObj =
+        std::make_shared<lager::gncpy::dynamics::DoubleIntegrator>(1.0);
+    auto measObj =
+        std::make_shared<lager::gncpy::measurements::StateObservation>();
+    auto filt = std::make_shared<lager::gncpy::filters::Kalman>();
+    filt->setStateModel(dynObj, 0.1 * Eigen::Matrix4d::Identity());
+    filt->setMeasurementModel(measObj, 0.01 * Eigen::Matrix2d::Identity());
+    filt->getCov() = 4.0 * Eigen::Matrix4d::Identity();
+    return filt;
+}
+
+// correction parameters observing the given state indices
+inline std::shared_ptr<lager::gncpy::filters::BayesCorrectParams> makeParams(
+    const std::vector<uint8_t>& inds) {
+    auto params = std::make_shared<lager::gncpy::filters::BayesCorrectParams>();
+    params->measParams =
+        std::make_shared<lager::gncpy::measurements::StateObservationParams>(
+            inds);
+    return params;
+}
+
+}  // namespace kalman_fixtures
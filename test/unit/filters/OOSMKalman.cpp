@@ -0,0 +1,206 @@
+#include "gncpy/filters/OOSMKalman.h"
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+#include <vector>
+
+#include "gncpy/Exceptions.h"
+#include "gncpy/filters/Kalman.h"
+#include "gncpy/filters/Parameters.h"
+#include "KalmanFixtures.h"
+
+namespace {
+
+using kalman_fixtures::makeKalman;
+using kalman_fixtures::makeParams;
+
+struct Scenario {
+    std::vector<Eigen::Vector2d> pos;
+    Eigen::Vector2d lateVel;
+};
+
+Scenario makeScenario() {
+    Scenario s;
+    s.pos = {Eigen::Vector2d(1.1, 0.4), Eigen::Vector2d(2.0, 1.1),
+             Eigen::Vector2d(2.9, 1.4)};
+    s.lateVel = Eigen::Vector2d(0.9, 0.6);
+    return s;
+}
+
+// processes every measurement in order and returns the final estimate
+Eigen::VectorXd inOrder(const Scenario& s, size_t lateStep,
+                        Eigen::MatrixXd& cov) {
+    auto posParams = makeParams({0, 1});
+    auto velParams = makeParams({2, 3});
+    lager::gncpy::filters::OOSMKalman filt(makeKalman());
+    filt.initialize(0.0, Eigen::Vector4d(0.0, 0.0, 1.0, 0.5));
+
+    double prob;
+    for (size_t kk = 0; kk < s.pos.size(); kk++) {
+        filt.predict(kk + 1.0);
+        filt.correct(kk + 1.0, s.pos[kk], prob, posParams);
+        if (kk + 1 == lateStep) {
+            filt.correct(kk + 1.0, s.lateVel, prob, velParams);
+        }
+    }
+    cov = filt.viewCov();
+    return filt.state();
+}
+
+}  // namespace
+
+TEST(OOSMKalmanTest, InSequence) {
+    auto posParams = makeParams({0, 1});
+    auto kf = makeKalman();
+    lager::gncpy::filters::OOSMKalman filt(kf);
+    filt.initialize(0.0, Eigen::Vector4d(0.0, 0.0, 1.0, 0.5));
+
+    lager::gncpy::filters::BayesPredictParams predParams;
+    auto ref = makeKalman();
+    Eigen::VectorXd refState = Eigen::Vector4d(0.0, 0.0, 1.0, 0.5);
+
+    auto s = makeScenario();
+    double prob;
+    double refProb;
+    for (size_t kk = 0; kk < s.pos.size(); kk++) {
+        filt.predict(kk + 1.0);
+        filt.correct(kk + 1.0, s.pos[kk], prob, posParams);
+
+        refState = ref->predict(kk, refState, std::nullopt, &predParams);
+        refState = ref->correct(kk + 1.0, s.pos[kk], refState, refProb,
+                                posParams.get());
+    }
+
+    for (uint8_t ii = 0; ii < 4; ii++) {
+        EXPECT_DOUBLE_EQ(refState(ii), filt.state()(ii));
+    }
+    EXPECT_DOUBLE_EQ(refProb, prob);
+    EXPECT_EQ(4, filt.historySize());
+
+    EXPECT_THROW(filt.correct(5.0, s.pos[0], prob, posParams),
+                 lager::gncpy::exceptions::BadParams);
+    EXPECT_THROW(filt.correct(2.5, s.pos[0], prob, posParams),
+                 lager::gncpy::exceptions::BadParams);
+
+    SUCCEED();
+}
+
+TEST(OOSMKalmanTest, Retrodiction) {
+    auto s = makeScenario();
+    Eigen::MatrixXd expCov;
+    Eigen::VectorXd exp = inOrder(s, 2, expCov);
+
+    auto posParams = makeParams({0, 1});
+    auto velParams = makeParams({2, 3});
+    lager::gncpy::filters::OOSMKalman filt(makeKalman());
+    filt.initialize(0.0, Eigen::Vector4d(0.0, 0.0, 1.0, 0.5));
+
+    double prob;
+    for (size_t kk = 0; kk < s.pos.size(); kk++) {
+        filt.predict(kk + 1.0);
+        filt.correct(kk + 1.0, s.pos[kk], prob, posParams);
+    }
+    filt.correct(2.0, s.lateVel, prob, velParams);
+
+    EXPECT_EQ(1, filt.numRetrodictions());
+    EXPECT_EQ(0, filt.numRollbacks());
+    for (uint8_t ii = 0; ii < 4; ii++) {
+        EXPECT_NEAR(exp(ii), filt.state()(ii), 1e-8);
+        for (uint8_t jj = 0; jj < 4; jj++) {
+            EXPECT_NEAR(expCov(ii, jj), filt.viewCov()(ii, jj), 1e-8);
+        }
+    }
+
+    SUCCEED();
+}
+
+TEST(OOSMKalmanTest, RepeatedLateStep) {
+    auto s = makeScenario();
+    const Eigen::VectorXd lateVelX = s.lateVel.head(1);
+    const Eigen::VectorXd lateVelY = s.lateVel.tail(1);
+    auto posParams = makeParams({0, 1});
+    auto velXParams = makeParams({2});
+    auto velYParams = makeParams({3});
+
+    lager::gncpy::filters::OOSMKalman exp(makeKalman());
+    exp.initialize(0.0, Eigen::Vector4d(0.0, 0.0, 1.0, 0.5));
+    lager::gncpy::filters::OOSMKalman filt(makeKalman());
+    filt.initialize(0.0, Eigen::Vector4d(0.0, 0.0, 1.0, 0.5));
+
+    double prob;
+    for (size_t kk = 0; kk < s.pos.size(); kk++) {
+        exp.predict(kk + 1.0);
+        exp.correct(kk + 1.0, s.pos[kk], prob, posParams);
+        if (kk == 1) {
+            exp.correct(kk + 1.0, lateVelX, prob, velXParams);
+            exp.correct(kk + 1.0, lateVelY, prob, velYParams);
+        }
+        filt.predict(kk + 1.0);
+        filt.correct(kk + 1.0, s.pos[kk], prob, posParams);
+    }
+
+    // the second measurement at the same step can not be retrodicted from
+    // a snapshot that misses the first, so it rolls back
+    filt.correct(2.0, lateVelX, prob, velXParams);
+    filt.correct(2.0, lateVelY, prob, velYParams);
+
+    EXPECT_EQ(1, filt.numRetrodictions());
+    EXPECT_EQ(1, filt.numRollbacks());
+    for (uint8_t ii = 0; ii < 4; ii++) {
+        EXPECT_NEAR(exp.state()(ii), filt.state()(ii), 1e-10);
+        for (uint8_t jj = 0; jj < 4; jj++) {
+            EXPECT_NEAR(exp.viewCov()(ii, jj), filt.viewCov()(ii, jj), 1e-10);
+        }
+    }
+
+    SUCCEED();
+}
+
+TEST(OOSMKalmanTest, Rollback) {
+    auto s = makeScenario();
+    Eigen::MatrixXd expCov;
+    Eigen::VectorXd exp = inOrder(s, 1, expCov);
+
+    auto posParams = makeParams({0, 1});
+    auto velParams = makeParams({2, 3});
+    lager::gncpy::filters::OOSMKalman filt(makeKalman());
+    filt.initialize(0.0, Eigen::Vector4d(0.0, 0.0, 1.0, 0.5));
+
+    double prob;
+    for (size_t kk = 0; kk < s.pos.size(); kk++) {
+        filt.predict(kk + 1.0);
+        filt.correct(kk + 1.0, s.pos[kk], prob, posParams);
+    }
+    filt.correct(1.0, s.lateVel, prob, velParams);
+
+    EXPECT_EQ(0, filt.numRetrodictions());
+    EXPECT_EQ(1, filt.numRollbacks());
+    for (uint8_t ii = 0; ii < 4; ii++) {
+        EXPECT_NEAR(exp(ii), filt.state()(ii), 1e-10);
+        for (uint8_t jj = 0; jj < 4; jj++) {
+            EXPECT_NEAR(expCov(ii, jj), filt.viewCov()(ii, jj), 1e-10);
+        }
+    }
+
+    SUCCEED();
+}
+
+TEST(OOSMKalmanTest, BoundedHistory) {
+    auto posParams = makeParams({0, 1});
+    lager::gncpy::filters::OOSMKalman filt(makeKalman(), 3);
+    filt.initialize(0.0, Eigen::Vector4d(0.0, 0.0, 1.0, 0.5));
+
+    double prob;
+    for (int kk = 1; kk <= 6; kk++) {
+        filt.predict(kk);
+    }
+    EXPECT_EQ(3, filt.historySize());
+    EXPECT_NO_THROW(filt.correct(4.0, Eigen::Vector2d(4.0, 2.0), prob,
+                                 posParams));
+    EXPECT_THROW(filt.correct(3.0, Eigen::Vector2d(3.0, 1.5), prob,
+                              posParams),
+                 lager::gncpy::exceptions::BadParams);
+
+    SUCCEED();
+}
@@ -0,0 +1,167 @@
+#include "gncpy/filters/SquareRootKalman.h"
+
+#include <gtest/gtest.h>
+#include <math.h>
+
+#include <Eigen/Dense>
+#include <vector>
+
+#include "gncpy/Exceptions.h"
+#include "gncpy/dynamics/CurvilinearMotion.h"
+#include "gncpy/dynamics/DoubleIntegrator.h"
+#include "gncpy/filters/Parameters.h"
+#include "gncpy/filters/SquareRootExtendedKalman.h"
+#include "gncpy/math/Math.h"
+#include "gncpy/measurements/RangeAndBearing.h"
+#include "gncpy/measurements/StateObservation.h"
+
+TEST(SRKFTest, SetModels) {
+    lager::gncpy::filters::SquareRootKalman filt;
+    auto dynObj =
+        std::make_shared<lager::gncpy::dynamics::DoubleIntegrator>(1.0);
+    auto measObj =
+        std::make_shared<lager::gncpy::measurements::StateObservation>();
+
+    // singular process noise is allowed
+    Eigen::Matrix4d procNoise = Eigen::Matrix4d::Zero();
+    procNoise(2, 2) = 0.1;
+    procNoise(3, 3) = 0.1;
+    EXPECT_NO_THROW(filt.setStateModel(dynObj, procNoise));
+    EXPECT_THROW(filt.setStateModel(dynObj, -1.0 * Eigen::Matrix4d::Identity()),
+                 lager::gncpy::exceptions::BadParams);
+    EXPECT_THROW(filt.setMeasurementModel(measObj, Eigen::Matrix2d::Zero()),
+                 lager::gncpy::exceptions::BadParams);
+
+    SUCCEED();
+}
+
+TEST(SRKFTest, MatchesCovarianceForm) {
+    auto dynObj =
+        std::make_shared<lager::gncpy::dynamics::DoubleIntegrator>(0.5);
+    auto measObj =
+        std::make_shared<lager::gncpy::measurements::StateObservation>();
+    Eigen::Matrix4d procNoise = Eigen::Matrix4d::Zero();
+    procNoise.bottomRightCorner(2, 2) = 0.05 * Eigen::Matrix2d::Identity();
+    Eigen::Matrix2d measNoise{{0.2, 0.05}, {0.05, 0.3}};
+
+    lager::gncpy::filters::SquareRootKalman filt;
+    filt.setStateModel(dynObj, procNoise);
+    filt.setMeasurementModel(measObj, measNoise);
+    filt.getCov() = 2.0 * Eigen::Matrix4d::Identity();
+
+    lager::gncpy::filters::BayesPredictParams predParams;
+    lager::gncpy::filters::BayesCorrectParams corrParams;
+    corrParams.measParams =
+        std::make_shared<lager::gncpy::measurements::StateObservationParams>(
+            std::vector<uint8_t>{0, 1});
+
+    Eigen::VectorXd state = Eigen::Vector4d(0.0, 0.0, 1.0, -1.0);
+    Eigen::VectorXd expState = state;
+    Eigen::MatrixXd expCov = 2.0 * Eigen::Matrix4d::Identity();
+    Eigen::MatrixXd stateMat = dynObj->getStateMat(0.0);
+    Eigen::MatrixXd measMat =
+        measObj->getMeasMat(state, corrParams.measParams.get());
+
+    double prob;
+    for (int kk = 0; kk < 5; kk++) {
+        Eigen::Vector2d meas(0.5 * (kk + 1), -0.4 * (kk + 1));
+
+        state = filt.predict(0.5 * kk, state, std::nullopt, &predParams);
+        state = filt.correct(0.5 * (kk + 1), meas, state, prob, &corrParams);
+
+        expState = stateMat * expState;
+        expCov = stateMat * expCov * stateMat.transpose() + procNoise;
+        Eigen::MatrixXd inovCov =
+            measMat * expCov * measMat.transpose() + measNoise;
+        Eigen::MatrixXd gain = expCov * measMat.transpose() * inovCov.inverse();
+        Eigen::VectorXd estMeas = measMat * expState;
+        double expProb =
+            lager::gncpy::math::calcGaussianPDF(meas, estMeas, inovCov);
+        expState += gain * (meas - estMeas);
+        expCov -= gain * measMat * expCov;
+
+        EXPECT_NEAR(expProb, prob, 1e-10);
+    }
+
+    for (uint8_t ii = 0; ii < 4; ii++) {
+        EXPECT_NEAR(expState(ii), state(ii), 1e-10);
+        for (uint8_t jj = 0; jj < 4; jj++) {
+            EXPECT_NEAR(expCov(ii, jj), filt.viewCov()(ii, jj), 1e-10);
+        }
+    }
+    Eigen::MatrixXd sqrtCov = filt.viewSqrtCov();
+    EXPECT_TRUE(sqrtCov.isLowerTriangular());
+
+    SUCCEED();
+}
+
+TEST(SRKFTest, ExtendedCorrect) {
+    Eigen::Matrix2d measNoise{{0.01, 0.0}, {0.0, 1.0 * M_PI / 180}};
+    auto measObj =
+        std::make_shared<lager::gncpy::measurements::RangeAndBearing>();
+    lager::gncpy::filters::BayesCorrectParams corrParams;
+    corrParams.measParams =
+        std::make_shared<lager::gncpy::measurements::RangeAndBearingParams>(0,
+                                                                            1);
+
+    lager::gncpy::filters::SquareRootExtendedKalman filt;
+    filt.setStateModel(
+        std::make_shared<lager::gncpy::dynamics::CurvilinearMotion>(),
+        0.01 * Eigen::Matrix4d::Identity());
+    filt.setMeasurementModel(measObj, measNoise);
+    filt.getCov() = Eigen::Matrix4d::Identity();
+
+    Eigen::VectorXd state = Eigen::Vector4d(2.0, 3.0, 1.0, 1.0);
+    Eigen::VectorXd meas = measObj->measure(Eigen::Vector4d(2.2, 2.9, 1.0, 1.0),
+                                            corrParams.measParams.get());
+
+    Eigen::MatrixXd measMat =
+        measObj->getMeasMat(state, corrParams.measParams.get());
+    Eigen::MatrixXd expCov = Eigen::Matrix4d::Identity();
+    Eigen::MatrixXd gain =
+        expCov * measMat.transpose() *
+        (measMat * expCov * measMat.transpose() + measNoise).inverse();
+    Eigen::VectorXd expState =
+        state + gain * (meas - measObj->measure(state,
+                                                corrParams.measParams.get()));
+    expCov -= gain * measMat * expCov;
+
+    double prob;
+    auto out = filt.correct(0.0, meas, state, prob, &corrParams);
+    for (uint8_t ii = 0; ii < 4; ii++) {
+        EXPECT_NEAR(expState(ii), out(ii), 1e-8);
+        for (uint8_t jj = 0; jj < 4; jj++) {
+            EXPECT_NEAR(expCov(ii, jj), filt.viewCov()(ii, jj), 1e-8);
+        }
+    }
+
+    SUCCEED();
+}
+
+TEST(SRKFTest, ExtendedPredictRebinds) {
+    auto nonLin =
+        std::make_shared<lager::gncpy::dynamics::CurvilinearMotion>(0.1);
+    auto lin = std::make_shared<lager::gncpy::dynamics::DoubleIntegrator>(0.5);
+    Eigen::Matrix4d procNoise = 0.01 * Eigen::Matrix4d::Identity();
+
+    lager::gncpy::filters::SquareRootExtendedKalman filt;
+    filt.setStateModel(nonLin, procNoise);
+    filt.getCov() = Eigen::Matrix4d::Identity();
+
+    // the non-linear model is linearized about the current estimate
+    Eigen::VectorXd state = Eigen::Vector4d(2.0, 3.0, 1.0, 0.3);
+    Eigen::MatrixXd stateMat = nonLin->getStateMat(0.0, state);
+    Eigen::MatrixXd expCov =
+        stateMat * stateMat.transpose() + Eigen::MatrixXd(procNoise);
+    filt.predict(0.0, state, std::nullopt);
+    EXPECT_TRUE(expCov.isApprox(filt.viewCov(), 1e-10));
+
+    // swapping in a linear model must drop the cached non-linear view
+    filt.setStateModel(lin, procNoise);
+    stateMat = lin->getStateMat(0.0);
+    expCov = stateMat * expCov * stateMat.transpose() + procNoise;
+    filt.predict(0.0, state, std::nullopt);
+    EXPECT_TRUE(expCov.isApprox(filt.viewCov(), 1e-10));
+
+    SUCCEED();
+}
@@ -5,6 +5,8 @@
 
 #include <Eigen/Dense>
 
+#include "gncpy/Exceptions.h"
+
 TEST(MathTest, GradientVec) {
     Eigen::Vector3d x;
     x << 3., 2.7, -6.25;
@@ -159,6 +161,43 @@ TEST(MathTest, GaussianPDFVec) {
     SUCCEED();
 }
 
+TEST(MathTest, ChiSquare) {
+    // closed form for 3 degrees of freedom
+    double exp = std::erf(1.0) - 2.0 / std::sqrt(M_PI) * std::exp(-1.0);
+    EXPECT_NEAR(exp, lager::gncpy::math::chiSquareCDF(2.0, 3.0), 1e-12);
+
+    EXPECT_NEAR(3.841458820694124,
+                lager::gncpy::math::chiSquareQuantile(0.95, 1.0), 1e-8);
+    EXPECT_NEAR(3.246972780236841,
+                lager::gncpy::math::chiSquareQuantile(0.025, 10.0), 1e-8);
+    EXPECT_NEAR(20.48317735080739,
+                lager::gncpy::math::chiSquareQuantile(0.975, 10.0), 1e-8);
+
+    // large degrees of freedom use the continued fraction
+    double q = lager::gncpy::math::chiSquareQuantile(0.975, 40000.0);
+    EXPECT_NEAR(0.975, lager::gncpy::math::chiSquareCDF(q, 40000.0), 1e-9);
+
+    SUCCEED();
+}
+
+TEST(MathTest, CheckJacobian) {
+    Eigen::Matrix2d numerical({{1.0, 2.0}, {3.0, 1000.0}});
+    Eigen::Matrix2d analytic = numerical;
+    analytic(0, 0) += 1e-3;
+    EXPECT_NO_THROW(
+        lager::gncpy::math::checkJacobian(analytic, numerical, "test"));
+
+    analytic(0, 0) = -1.0;
+    EXPECT_THROW(
+        lager::gncpy::math::checkJacobian(analytic, numerical, "test"),
+        lager::gncpy::exceptions::BadParams);
+    EXPECT_THROW(lager::gncpy::math::checkJacobian(
+                     Eigen::MatrixXd::Zero(2, 3), numerical, "test"),
+                 lager::gncpy::exceptions::BadParams);
+
+    SUCCEED();
+}
+
 TEST(MathTest, RungeKutta4) {
     Eigen::Vector2d x;
     x << 0.5, 3.4;
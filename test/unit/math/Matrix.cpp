@@ -0,0 +1,168 @@
+#include "gncpy/math/Matrix.h"
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+#include <functional>
+
+#include "gncpy/math/Exceptions.h"
+#include "gncpy/math/Math.h"
+#include "gncpy/math/Vector.h"
+
+namespace {
+
+using lager::gncpy::matrix::Matrix;
+using lager::gncpy::matrix::Vector;
+
+template <typename T, std::size_t Rows, std::size_t Cols>
+Eigen::Matrix<T, Rows, Cols> toEigen(const Matrix<T, Rows, Cols>& mat) {
+    Eigen::Matrix<T, Rows, Cols> out;
+    for (std::size_t r = 0; r < Rows; r++) {
+        for (std::size_t c = 0; c < Cols; c++) {
+            out(r, c) = mat(r, c);
+        }
+    }
+    return out;
+}
+
+// symmetric positive definite test matrix
+Matrix<double, 4, 4> spdMatrix() {
+    Matrix<double, 4, 4> base{{2.0, 0.3, -0.1, 0.5},
+                              {0.0, 1.5, 0.2, -0.4},
+                              {0.7, -0.2, 1.8, 0.1},
+                              {0.1, 0.6, 0.0, 1.2}};
+    return base * base.transpose() + 0.5 * Matrix<double, 4, 4>::identity();
+}
+
+}  // namespace
+
+TEST(MatrixTest, Arithmetic) {
+    Matrix<double, 2, 3> lhs{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}};
+    Matrix<double, 3, 2> rhs{{0.5, -1.0}, {2.0, 0.0}, {-3.0, 1.5}};
+    Eigen::Matrix<double, 2, 3> expLhs = toEigen(lhs);
+    Eigen::Matrix<double, 3, 2> expRhs = toEigen(rhs);
+
+    EXPECT_TRUE(toEigen(lhs * rhs).isApprox(expLhs * expRhs, 1e-15));
+    EXPECT_TRUE(toEigen(lhs.transpose()).isApprox(expLhs.transpose()));
+    EXPECT_TRUE(
+        toEigen(2.0 * lhs - lhs / 4.0).isApprox(1.75 * expLhs, 1e-15));
+    EXPECT_TRUE(toEigen(lhs + rhs.transpose())
+                    .isApprox(expLhs + expRhs.transpose(), 1e-15));
+    EXPECT_EQ(lhs, -(-lhs));
+
+    Matrix<double, 4, 4> spd = spdMatrix();
+    EXPECT_DOUBLE_EQ(toEigen(spd).trace(), spd.trace());
+    EXPECT_DOUBLE_EQ(toEigen(spd).norm(), spd.norm());
+
+    Matrix<double, 2, 4> proj{{1.0, 0.0, 0.5, 0.0}, {0.0, 1.0, 0.0, 0.5}};
+    Matrix<double, 2, 2> sym =
+        lager::gncpy::matrix::symmetricProduct(proj, spd);
+    EXPECT_EQ(sym(0, 1), sym(1, 0));
+    EXPECT_TRUE(toEigen(sym).isApprox(
+        toEigen(proj) * toEigen(spd) * toEigen(proj).transpose(), 1e-14));
+
+    Matrix<double, 2, 2> corner = spd.block<2, 2>(2, 2);
+    EXPECT_EQ(spd(3, 2), corner(1, 0));
+    spd.setBlock(0, 2, corner);
+    EXPECT_EQ(corner(1, 1), spd(1, 3));
+
+    SUCCEED();
+}
+
+TEST(MatrixTest, Indexing) {
+    Matrix<float, 2, 3> mat;
+    EXPECT_EQ(0.0f, mat.at(1, 2));
+    mat.at(1, 2) = 3.0f;
+    EXPECT_EQ(3.0f, mat(1, 2));
+
+    EXPECT_THROW(mat.at(2, 0), lager::gncpy::matrix::BadIndex);
+    EXPECT_THROW(mat.at(0, 3), lager::gncpy::matrix::BadIndex);
+    EXPECT_THROW((mat.block<2, 2>(0, 2)), lager::gncpy::matrix::BadIndex);
+    EXPECT_THROW((Matrix<float, 2, 2>{{1.0f, 2.0f}}),
+                 lager::gncpy::matrix::BadDimension);
+    EXPECT_THROW((Matrix<float, 2, 2>{{1.0f, 2.0f}, {3.0f}}),
+                 lager::gncpy::matrix::BadDimension);
+
+    Vector<float, 3> vec{1.0f, 2.0f, 3.0f};
+    EXPECT_EQ(2.0f, vec(1));
+    EXPECT_THROW(vec.at(3), lager::gncpy::matrix::BadIndex);
+    EXPECT_THROW((Vector<float, 3>{1.0f, 2.0f}),
+                 lager::gncpy::matrix::BadDimension);
+
+    SUCCEED();
+}
+
+TEST(MatrixTest, VectorProducts) {
+    Vector<double, 3> lhs{1.0, -2.0, 0.5};
+    Vector<double, 3> rhs{0.3, 4.0, -1.0};
+    Eigen::Vector3d expLhs = toEigen(lhs);
+    Eigen::Vector3d expRhs = toEigen(rhs);
+
+    EXPECT_DOUBLE_EQ(expLhs.dot(expRhs), lhs.dot(rhs));
+    EXPECT_TRUE(toEigen(lhs.cross(rhs)).isApprox(expLhs.cross(expRhs)));
+    EXPECT_TRUE(toEigen(lhs.outer(rhs))
+                    .isApprox(expLhs * expRhs.transpose(), 1e-15));
+    EXPECT_DOUBLE_EQ(expLhs.norm(), lhs.norm());
+
+    // matrix expressions convert back to vectors
+    Vector<double, 3> sum = lhs + 2.0 * rhs;
+    EXPECT_DOUBLE_EQ(lhs(2) + 2.0 * rhs(2), sum(2));
+
+    SUCCEED();
+}
+
+TEST(MatrixTest, CholeskySolve) {
+    const Matrix<double, 4, 4> spd = spdMatrix();
+    const Eigen::Matrix4d expSpd = toEigen(spd);
+
+    lager::gncpy::matrix::Cholesky<double, 4> chol(spd);
+    ASSERT_TRUE(chol.ok());
+    EXPECT_TRUE(
+        toEigen(chol.lower()).isApprox(Eigen::Matrix4d(expSpd.llt().matrixL()),
+                                       1e-14));
+    EXPECT_NEAR(expSpd.determinant(), chol.determinant(), 1e-12);
+
+    Matrix<double, 4, 2> rhs{{1.0, 0.0}, {2.0, -1.0}, {0.5, 3.0}, {0.0, 1.0}};
+    EXPECT_TRUE(toEigen(chol.solve(rhs))
+                    .isApprox(expSpd.llt().solve(toEigen(rhs)), 1e-13));
+
+    Matrix<double, 4, 4> gen = spd;
+    gen(0, 3) += 2.0;
+    gen(2, 1) -= 1.5;
+    Matrix<double, 4, 2> res;
+    ASSERT_TRUE(lager::gncpy::matrix::solve(gen, rhs, res));
+    EXPECT_TRUE(toEigen(res).isApprox(
+        toEigen(gen).partialPivLu().solve(toEigen(rhs)), 1e-13));
+
+    Matrix<double, 4, 4> inv;
+    ASSERT_TRUE(lager::gncpy::matrix::inverse(gen, inv));
+    EXPECT_TRUE(toEigen(gen * inv).isIdentity(1e-13));
+
+    // singular and indefinite matrices are reported without throwing
+    Matrix<double, 4, 4> singular = spd;
+    singular.setBlock(3, 0, spd.block<1, 4>(0, 0));
+    EXPECT_FALSE(lager::gncpy::matrix::inverse(singular, inv));
+    EXPECT_FALSE(chol.compute(-1.0 * spd));
+    EXPECT_FALSE(chol.ok());
+
+    SUCCEED();
+}
+
+TEST(MatrixTest, RungeKutta) {
+    // harmonic oscillator integrated with fixed size vectors
+    std::function<Vector<double, 2>(double, const Vector<double, 2>&)> fnc =
+        [](double, const Vector<double, 2>& x) {
+            return Vector<double, 2>{x(1), -x(0)};
+        };
+
+    Vector<double, 2> state{1.0, 0.0};
+    const double dt = 0.01;
+    for (int kk = 0; kk < 100; kk++) {
+        state = lager::gncpy::math::rungeKutta4<Vector<double, 2>>(
+            kk * dt, state, dt, fnc);
+    }
+    EXPECT_NEAR(std::cos(1.0), state(0), 1e-9);
+    EXPECT_NEAR(-std::sin(1.0), state(1), 1e-9);
+
+    SUCCEED();
+}
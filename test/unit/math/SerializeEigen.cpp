@@ -0,0 +1,68 @@
+#include "gncpy/math/SerializeEigen.h"
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+#include <sstream>
+
+TEST(SerializeEigenTest, JSONRoundTrip) {
+    Eigen::MatrixXd mat(2, 3);
+    mat << 1.0, 2.0, 3.0, 4.0, 5.0, 6.0;
+
+    std::stringstream ss;
+    {
+        cereal::JSONOutputArchive ar(ss);
+        ar(cereal::make_nvp("mat", mat));
+    }
+    // one flat row major array instead of a node per element
+    EXPECT_NE(std::string::npos, ss.str().find("\"data\""));
+    EXPECT_EQ(std::string::npos, ss.str().find("\"0,1\""));
+
+    Eigen::MatrixXd loaded;
+    {
+        cereal::JSONInputArchive ar(ss);
+        ar(cereal::make_nvp("mat", loaded));
+    }
+    ASSERT_EQ(mat.rows(), loaded.rows());
+    ASSERT_EQ(mat.cols(), loaded.cols());
+    for (Eigen::Index r = 0; r < mat.rows(); r++) {
+        for (Eigen::Index c = 0; c < mat.cols(); c++) {
+            EXPECT_EQ(mat(r, c), loaded(r, c));
+        }
+    }
+
+    SUCCEED();
+}
+
+TEST(SerializeEigenTest, LoadOldFormat) {
+    std::stringstream ss(
+        "{\"mat\": {\"rows\": 2, \"cols\": 2, \"0,0\": 1.0, \"0,1\": 2.0, "
+        "\"1,0\": 3.0, \"1,1\": 4.0}}");
+    Eigen::Matrix2d loaded;
+    {
+        cereal::JSONInputArchive ar(ss);
+        ar(cereal::make_nvp("mat", loaded));
+    }
+    EXPECT_EQ(1.0, loaded(0, 0));
+    EXPECT_EQ(2.0, loaded(0, 1));
+    EXPECT_EQ(3.0, loaded(1, 0));
+    EXPECT_EQ(4.0, loaded(1, 1));
+
+    // element indices outside the stored size are rejected before writing
+    std::stringstream late(
+        "{\"mat\": {\"rows\": 2, \"cols\": 2, \"2,0\": 1.0}}");
+    cereal::JSONInputArchive lateAr(late);
+    EXPECT_THROW(lateAr(cereal::make_nvp("mat", loaded)), std::runtime_error);
+
+    std::stringstream early(
+        "{\"mat\": {\"0,-1\": 1.0, \"rows\": 2, \"cols\": 2}}");
+    cereal::JSONInputArchive earlyAr(early);
+    EXPECT_THROW(earlyAr(cereal::make_nvp("mat", loaded)), std::runtime_error);
+
+    std::stringstream unsized("{\"mat\": {\"0,0\": 1.0}}");
+    cereal::JSONInputArchive unsizedAr(unsized);
+    EXPECT_THROW(unsizedAr(cereal::make_nvp("mat", loaded)),
+                 std::runtime_error);
+
+    SUCCEED();
+}
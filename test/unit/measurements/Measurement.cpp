@@ -2,6 +2,9 @@
 #include <math.h>
 
 #include <Eigen/Dense>
+#include <functional>
+#include <optional>
+#include <vector>
 
 #include "gncpy/Exceptions.h"
 #include "gncpy/math/Math.h"
@@ -100,4 +103,59 @@ TEST(MeasurementTest, RangeBearingMeasMat) {
     }
 
     SUCCEED();
-}
\ No newline at end of file
+}
+
+TEST(MeasurementTest, RangeBearingAnalyticMeasMat) {
+    lager::gncpy::measurements::RangeAndBearing sensor;
+    lager::gncpy::measurements::RangeAndBearingParams params(0, 2);
+
+    for (double ang : {0.3, 2.0, -1.2}) {
+        Eigen::Vector3d x(5.0 * cos(ang), 1.0, 5.0 * sin(ang));
+        auto res = sensor.getMeasMat(x, &params);
+        auto exp = sensor.getNumericalMeasMat(x, &params);
+        EXPECT_TRUE(res.isApprox(exp, 1e-6));
+    }
+
+    // no closed form at the origin, falls back to finite differences
+    Eigen::Vector3d origin = Eigen::Vector3d::Zero();
+    auto res = sensor.getMeasMat(origin, &params);
+    EXPECT_EQ(2, res.rows());
+    EXPECT_EQ(3, res.cols());
+
+    SUCCEED();
+}
+
+namespace {
+
+// analytic Jacobian with the wrong sign
+class BadJacobian final
+    : public lager::gncpy::measurements::INonLinearMeasModel {
+   protected:
+    std::vector<std::function<double(const Eigen::VectorXd&)>> getMeasFuncLst(
+        [[maybe_unused]] const lager::gncpy::measurements::MeasParams* params)
+        const override {
+        return {[](const Eigen::VectorXd& x) { return x(0) * x(1); }};
+    }
+
+    std::optional<Eigen::MatrixXd> analyticMeasMat(
+        const Eigen::VectorXd& x,
+        [[maybe_unused]] const lager::gncpy::measurements::MeasParams* params)
+        const override {
+        Eigen::MatrixXd out(1, 2);
+        out << -x(1), -x(0);
+        return out;
+    }
+};
+
+}  // namespace
+
+TEST(MeasurementTest, JacobianCheck) {
+#ifndef GNCPY_CHECK_JACOBIANS
+    GTEST_SKIP() << "Requires GNCPY_CHECK_JACOBIANS";
+#endif
+    BadJacobian model;
+    Eigen::Vector2d x(2.0, 3.0);
+    EXPECT_THROW(model.getMeasMat(x), lager::gncpy::exceptions::BadParams);
+
+    SUCCEED();
+}
@@ -0,0 +1,63 @@
+#include "gncpy/simulation/CatalogPropagator.h"
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+#include <cmath>
+
+#include "gncpy/dynamics/TwoBodyJ2.h"
+
+TEST(CatalogPropagatorTest, MatchesSerialBatch) {
+    using lager::gncpy::dynamics::TwoBodyJ2;
+    TwoBodyJ2 dyn(20.0);
+
+    const Eigen::Index num = 2000;
+    Eigen::MatrixXd states(num, 6);
+    for (Eigen::Index ii = 0; ii < num; ii++) {
+        const double radius = 6.8e6 + 1.0e3 * static_cast<double>(ii);
+        const double inc = 0.001 * static_cast<double>(ii);
+        const double speed = std::sqrt(TwoBodyJ2::EARTH_MU / radius);
+        states.row(ii) << radius, 0.0, 0.0, 0.0, speed * std::cos(inc),
+            speed * std::sin(inc);
+    }
+
+    const size_t numSteps = 5;
+    const Eigen::MatrixXd initial = states;
+    Eigen::MatrixXd exp = states;
+    for (size_t step = 0; step < numSteps; step++) {
+        dyn.propagateBatch(static_cast<double>(step) * dyn.dt(), exp);
+    }
+
+    lager::gncpy::simulation::CatalogPropagator prop(4);
+    EXPECT_EQ(4, prop.numThreads());
+    prop.propagate(dyn, 0.0, states, numSteps);
+
+    // every object is integrated by exactly one worker with the same kernel
+    EXPECT_EQ(exp, states);
+    EXPECT_GT((states - initial).rowwise().norm().minCoeff(), 0.0);
+
+    SUCCEED();
+}
+
+TEST(CatalogPropagatorTest, Keplerian) {
+    using lager::gncpy::dynamics::Keplerian;
+    Keplerian dyn(3600.0);
+
+    const Eigen::Index num = 1000;
+    Eigen::MatrixXd states(num, 6);
+    for (Eigen::Index ii = 0; ii < num; ii++) {
+        const double radius = 7.0e6 + 1.0e4 * static_cast<double>(ii);
+        const double speed = 1.1 * std::sqrt(Keplerian().mu() / radius);
+        states.row(ii) << radius, 0.0, 0.0, 0.0, speed, 0.0;
+    }
+
+    Eigen::MatrixXd exp = states;
+    dyn.propagateBatch(0.0, exp);
+    dyn.propagateBatch(dyn.dt(), exp);
+
+    lager::gncpy::simulation::CatalogPropagator prop(3);
+    prop.propagate(dyn, 0.0, states, 2);
+    EXPECT_EQ(exp, states);
+
+    SUCCEED();
+}
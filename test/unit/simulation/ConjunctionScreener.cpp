@@ -0,0 +1,184 @@
+#include "gncpy/simulation/ConjunctionScreener.h"
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+#include <cmath>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "gncpy/Exceptions.h"
+#include "gncpy/dynamics/ClohessyWiltshire.h"
+#include "gncpy/dynamics/Keplerian.h"
+#include "gncpy/simulation/Random.h"
+
+namespace {
+
+using lager::gncpy::dynamics::Keplerian;
+using lager::gncpy::dynamics::OrbitalElements;
+
+Eigen::RowVectorXd circularOrbit(double radius, double inc, double raan,
+                                 double nu) {
+    OrbitalElements elem;
+    elem.semiMajorAxis = radius;
+    elem.inclination = inc;
+    elem.raan = raan;
+    elem.trueAnomaly = nu;
+    return lager::gncpy::dynamics::elementsToCartesian(elem).transpose();
+}
+
+// circular orbits spaced 3 km apart in radius with random planes
+Eigen::MatrixXd background(Eigen::Index num) {
+    lager::gncpy::simulation::Philox rng(7, 0);
+    Eigen::MatrixXd out(num, 6);
+    for (Eigen::Index ii = 0; ii < num; ii++) {
+        out.row(ii) = circularOrbit(7.5e6 + 3.0e3 * static_cast<double>(ii),
+                                    M_PI * rng.uniform(),
+                                    2.0 * M_PI * rng.uniform(),
+                                    2.0 * M_PI * rng.uniform());
+    }
+    return out;
+}
+
+}  // namespace
+
+TEST(ConjunctionScreenerTest, FindsCrossing) {
+    const double radius = 7.0e6;
+    const double tca = 1003.0;
+    const double miss = 300.0;
+    const double meanMotion =
+        std::sqrt(Keplerian().mu() / std::pow(radius, 3));
+    const double meanMotionHigh =
+        std::sqrt(Keplerian().mu() / std::pow(radius + miss, 3));
+
+    // two objects reach the ascending node of the second at the same time
+    const Eigen::Index num = 400;
+    Eigen::MatrixXd states(num, 6);
+    states.topRows(num - 2) = background(num - 2);
+    states.row(num - 2) = circularOrbit(radius, 0.0, 0.0, -meanMotion * tca);
+    states.row(num - 1) =
+        circularOrbit(radius + miss, 1.0, 0.0, -meanMotionHigh * tca);
+
+    const double sliceDt = 10.0;
+    Keplerian dyn(sliceDt);
+    lager::gncpy::simulation::ConjunctionScreener screener(1.0e3, 4);
+    std::vector<lager::gncpy::simulation::Conjunction> found =
+        screener.screen(dyn, 0.0, sliceDt, states, 200);
+
+    ASSERT_EQ(1, found.size());
+    EXPECT_EQ(num - 2, found[0].first);
+    EXPECT_EQ(num - 1, found[0].second);
+    EXPECT_NEAR(tca, found[0].time, 1e-2);
+    EXPECT_NEAR(miss, found[0].distance, 1.0);
+    EXPECT_NEAR(2.0 * std::sqrt(Keplerian().mu() / radius) * std::sin(0.5),
+                found[0].relativeSpeed, 1.0);
+
+    EXPECT_THROW(screener.setThreshold(0.0),
+                 lager::gncpy::exceptions::BadParams);
+    Eigen::MatrixXd bad(2, 4);
+    EXPECT_THROW(screener.screen(dyn, 0.0, sliceDt, bad, 10),
+                 lager::gncpy::exceptions::BadParams);
+    EXPECT_THROW(screener.screen(dyn, 0.0, 2.0 * sliceDt, states, 10),
+                 lager::gncpy::exceptions::BadParams);
+    lager::gncpy::dynamics::ClohessyWiltshire cwh(sliceDt, meanMotion);
+    EXPECT_THROW(screener.screen(cwh, 0.0, 2.0 * sliceDt, states, 10),
+                 lager::gncpy::exceptions::BadParams);
+
+    SUCCEED();
+}
+
+TEST(ConjunctionScreenerTest, MatchesPairwise) {
+    const double sliceDt = 20.0;
+    const size_t numSlices = 180;
+    const double threshold = 1.0e5;
+    const Eigen::Index num = 150;
+
+    Keplerian dyn(sliceDt);
+    std::vector<Eigen::MatrixXd> ephemeris{background(num)};
+    for (size_t slice = 0; slice < numSlices; slice++) {
+        ephemeris.push_back(ephemeris.back());
+        dyn.propagateBatch(0.0, ephemeris.back());
+    }
+
+    lager::gncpy::simulation::ConjunctionScreener screener(threshold, 3);
+    std::vector<lager::gncpy::simulation::Conjunction> found =
+        screener.screenEphemeris(ephemeris, 0.0, sliceDt);
+    ASSERT_FALSE(found.empty());
+
+    std::set<std::pair<Eigen::Index, Eigen::Index>> pairs;
+    for (size_t ii = 0; ii < found.size(); ii++) {
+        EXPECT_LT(found[ii].first, found[ii].second);
+        EXPECT_LE(found[ii].distance, threshold);
+        if (ii > 0) {
+            EXPECT_LE(found[ii - 1].time, found[ii].time);
+        }
+        pairs.emplace(found[ii].first, found[ii].second);
+    }
+
+    // every pair that comes well inside the threshold at a slice boundary
+    // must be reported
+    for (Eigen::Index ii = 0; ii < num; ii++) {
+        for (Eigen::Index jj = ii + 1; jj < num; jj++) {
+            double closest = INFINITY;
+            for (const Eigen::MatrixXd& entry : ephemeris) {
+                closest = std::min(
+                    closest, (entry.row(ii) - entry.row(jj)).head<3>().norm());
+            }
+            if (closest < 0.9 * threshold) {
+                EXPECT_EQ(1, pairs.count({ii, jj}));
+            }
+        }
+    }
+
+    SUCCEED();
+}
+
+TEST(ConjunctionScreenerTest, FastPassInsideSlice) {
+    // the second object sweeps past the first between two slow endpoints,
+    // so the endpoint speeds alone would cull the pair
+    std::vector<Eigen::MatrixXd> ephemeris(2, Eigen::MatrixXd::Zero(2, 6));
+    ephemeris[0].row(1) << -1.0e3, 1.0, 0.0, 1.0, 0.0, 0.0;
+    ephemeris[1].row(1) << 1.0e3, 1.0, 0.0, 1.0, 0.0, 0.0;
+
+    lager::gncpy::simulation::ConjunctionScreener screener(10.0, 1);
+    std::vector<lager::gncpy::simulation::Conjunction> found =
+        screener.screenEphemeris(ephemeris, 0.0, 1.0);
+
+    ASSERT_EQ(1, found.size());
+    EXPECT_NEAR(0.5, found[0].time, 1e-6);
+    EXPECT_NEAR(1.0, found[0].distance, 1e-6);
+
+    SUCCEED();
+}
+
+TEST(ConjunctionScreenerTest, StreamingMatchesEphemeris) {
+    // the window is not a whole number of blocks
+    const double sliceDt = 20.0;
+    const size_t numSlices = 37;
+    const Eigen::Index num = 150;
+
+    Keplerian dyn(sliceDt);
+    std::vector<Eigen::MatrixXd> ephemeris{background(num)};
+    for (size_t slice = 0; slice < numSlices; slice++) {
+        ephemeris.push_back(ephemeris.back());
+        dyn.propagateBatch(0.0, ephemeris.back());
+    }
+
+    lager::gncpy::simulation::ConjunctionScreener screener(1.0e5, 2);
+    std::vector<lager::gncpy::simulation::Conjunction> expected =
+        screener.screenEphemeris(ephemeris, 0.0, sliceDt);
+    std::vector<lager::gncpy::simulation::Conjunction> found =
+        screener.screen(dyn, 0.0, sliceDt, ephemeris[0], numSlices);
+    ASSERT_FALSE(expected.empty());
+
+    ASSERT_EQ(expected.size(), found.size());
+    for (size_t ii = 0; ii < found.size(); ii++) {
+        EXPECT_EQ(expected[ii].first, found[ii].first);
+        EXPECT_EQ(expected[ii].second, found[ii].second);
+        EXPECT_DOUBLE_EQ(expected[ii].time, found[ii].time);
+        EXPECT_DOUBLE_EQ(expected[ii].distance, found[ii].distance);
+    }
+
+    SUCCEED();
+}
@@ -0,0 +1,81 @@
+#include "gncpy/simulation/Consistency.h"
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+
+#include "gncpy/Exceptions.h"
+#include "gncpy/simulation/Random.h"
+
+namespace {
+
+// random positive definite covariances and errors drawn from them
+void makeBatch(size_t dim, size_t num, Eigen::MatrixXd& vecs,
+               Eigen::MatrixXd& covs) {
+    lager::gncpy::simulation::Philox rng(99, 0);
+    vecs.resize(dim, num);
+    covs.resize(dim, dim * num);
+    Eigen::MatrixXd rand(dim, dim);
+    Eigen::VectorXd z(dim);
+    for (size_t ii = 0; ii < num; ii++) {
+        rng.fillNormal(rand.data(), dim * dim);
+        Eigen::MatrixXd cov = rand * rand.transpose() +
+                              Eigen::MatrixXd::Identity(dim, dim);
+        covs.middleCols(ii * dim, dim) = cov;
+        rng.fillNormal(z.data(), dim);
+        vecs.col(ii) = cov.llt().matrixL() * z;
+    }
+}
+
+}  // namespace
+
+TEST(ConsistencyTest, NormalizedSquares) {
+    const size_t dim = 3;
+    const size_t numSteps = 20;
+    const size_t numRuns = 100;
+    Eigen::MatrixXd vecs;
+    Eigen::MatrixXd covs;
+    makeBatch(dim, numSteps * numRuns, vecs, covs);
+
+    lager::gncpy::simulation::Consistency cons(3);
+    Eigen::MatrixXd nees = cons.nees(vecs, covs, numSteps);
+    ASSERT_EQ(numSteps, nees.rows());
+    ASSERT_EQ(numRuns, nees.cols());
+
+    for (size_t run : {0, 7, 99}) {
+        for (size_t step : {0, 11, 19}) {
+            size_t ii = run * numSteps + step;
+            Eigen::VectorXd v = vecs.col(ii);
+            double exp = v.dot(covs.middleCols(ii * dim, dim).inverse() * v);
+            EXPECT_NEAR(exp, nees(step, run), 1e-9);
+        }
+    }
+
+    auto stats = lager::gncpy::simulation::Consistency::evaluate(nees, dim);
+    EXPECT_TRUE(stats.consistent());
+    EXPECT_NEAR(3.0, stats.timeAverage, 0.15);
+    EXPECT_LT(stats.lower, 3.0);
+    EXPECT_GT(stats.upper, 3.0);
+    EXPECT_GT(stats.fractionInside, 0.8);
+
+    // errors twice as large as the covariance claims
+    Eigen::MatrixXd big = cons.nees(2.0 * vecs, covs, numSteps);
+    stats = lager::gncpy::simulation::Consistency::evaluate(big, dim);
+    EXPECT_FALSE(stats.consistent());
+    EXPECT_LT(stats.fractionInside, 0.1);
+
+    SUCCEED();
+}
+
+TEST(ConsistencyTest, BadInput) {
+    lager::gncpy::simulation::Consistency cons(1);
+    Eigen::MatrixXd vecs = Eigen::MatrixXd::Ones(2, 4);
+    Eigen::MatrixXd covs = Eigen::MatrixXd::Zero(2, 8);
+
+    EXPECT_THROW(cons.nis(vecs, covs.leftCols(6), 2),
+                 lager::gncpy::exceptions::BadParams);
+    EXPECT_THROW(cons.nis(vecs, covs, 3), lager::gncpy::exceptions::BadParams);
+    EXPECT_THROW(cons.nis(vecs, covs, 2), lager::gncpy::exceptions::BadParams);
+
+    SUCCEED();
+}
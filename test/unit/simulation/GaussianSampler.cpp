@@ -0,0 +1,74 @@
+#include "gncpy/simulation/GaussianSampler.h"
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+
+#include "gncpy/Exceptions.h"
+#include "gncpy/simulation/Random.h"
+
+TEST(GaussianSamplerTest, Moments) {
+    Eigen::Matrix3d cov({{4.0, 1.0, 0.5}, {1.0, 2.0, 0.3}, {0.5, 0.3, 1.0}});
+    Eigen::Vector3d mean(1.0, -2.0, 0.5);
+    lager::gncpy::simulation::GaussianSampler sampler(mean, cov);
+    EXPECT_EQ(3, sampler.dim());
+    EXPECT_TRUE(
+        (sampler.factor() * sampler.factor().transpose()).isApprox(cov));
+
+    lager::gncpy::simulation::Philox rng(5, 0);
+    const Eigen::Index num = 100000;
+    Eigen::MatrixXd samples = sampler.sample(rng, num);
+    ASSERT_EQ(3, samples.rows());
+    ASSERT_EQ(num, samples.cols());
+
+    Eigen::VectorXd sampleMean = samples.rowwise().mean();
+    Eigen::MatrixXd centered = samples.colwise() - sampleMean;
+    Eigen::MatrixXd sampleCov =
+        centered * centered.transpose() / static_cast<double>(num - 1);
+    for (Eigen::Index r = 0; r < 3; r++) {
+        EXPECT_NEAR(mean(r), sampleMean(r), 0.02);
+        for (Eigen::Index c = 0; c < 3; c++) {
+            EXPECT_NEAR(cov(r, c), sampleCov(r, c), 0.05);
+        }
+    }
+
+    SUCCEED();
+}
+
+TEST(GaussianSamplerTest, BatchMatchesSingle) {
+    Eigen::Matrix2d cov({{1.0, 0.2}, {0.2, 0.5}});
+    lager::gncpy::simulation::GaussianSampler sampler(cov);
+
+    lager::gncpy::simulation::Philox batchRng(8, 2);
+    Eigen::MatrixXd batch = sampler.sample(batchRng, 50);
+
+    lager::gncpy::simulation::Philox singleRng(8, 2);
+    for (Eigen::Index ii = 0; ii < batch.cols(); ii++) {
+        Eigen::VectorXd val = Eigen::VectorXd::Zero(2);
+        sampler.addNoise(singleRng, val);
+        EXPECT_TRUE(val.isApprox(batch.col(ii)));
+    }
+
+    SUCCEED();
+}
+
+TEST(GaussianSamplerTest, SemiDefinite) {
+    // only the first state is noisy
+    Eigen::Matrix2d cov({{2.0, 0.0}, {0.0, 0.0}});
+    lager::gncpy::simulation::GaussianSampler sampler(cov);
+    EXPECT_TRUE(
+        (sampler.factor() * sampler.factor().transpose()).isApprox(cov));
+
+    lager::gncpy::simulation::Philox rng(1, 1);
+    Eigen::MatrixXd samples = sampler.sample(rng, 10);
+    EXPECT_TRUE(samples.row(1).isZero());
+    EXPECT_FALSE(samples.row(0).isZero());
+
+    Eigen::Matrix2d bad({{1.0, 0.0}, {0.0, -1.0}});
+    EXPECT_THROW(sampler.setCovariance(bad),
+                 lager::gncpy::exceptions::BadParams);
+    EXPECT_THROW(sampler.setMean(Eigen::Vector3d::Zero()),
+                 lager::gncpy::exceptions::BadParams);
+
+    SUCCEED();
+}
@@ -0,0 +1,99 @@
+#include "gncpy/simulation/MonteCarlo.h"
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+#include <memory>
+#include <vector>
+
+#include "gncpy/Exceptions.h"
+#include "gncpy/dynamics/DoubleIntegrator.h"
+#include "gncpy/filters/InformationFilter.h"
+#include "gncpy/filters/Parameters.h"
+#include "gncpy/measurements/Parameters.h"
+#include "gncpy/measurements/StateObservation.h"
+
+namespace {
+
+// the filter's measurement noise is the truth noise times filtNoiseScale
+lager::gncpy::simulation::MonteCarloResult runExperiment(
+    size_t numThreads, double filtNoiseScale = 1.0) {
+    const double dt = 0.1;
+    auto dynObj =
+        std::make_shared<lager::gncpy::dynamics::DoubleIntegrator>(dt);
+    auto measObj =
+        std::make_shared<lager::gncpy::measurements::StateObservation>();
+    const Eigen::MatrixXd procNoise = 0.01 * Eigen::MatrixXd::Identity(4, 4);
+    const Eigen::MatrixXd measNoise = 0.25 * Eigen::MatrixXd::Identity(2, 2);
+
+    lager::gncpy::simulation::MonteCarlo mc(numThreads);
+    mc.setTruthModel(dynObj, procNoise);
+    mc.setMeasurementModel(measObj, measNoise);
+    mc.setFilterFactory([=]() {
+        auto filt =
+            std::make_unique<lager::gncpy::filters::InformationFilter>();
+        filt->setStateModel(dynObj, procNoise);
+        filt->setMeasurementModel(measObj, filtNoiseScale * measNoise);
+        return filt;
+    });
+    mc.setInitialConditions(Eigen::Vector4d(0.0, 0.0, 1.0, 0.5),
+                            Eigen::Vector4d(1.0, 1.0, 0.1, 0.1).asDiagonal());
+
+    std::vector<uint8_t> inds = {0, 1};
+    auto corrParams =
+        std::make_shared<lager::gncpy::filters::BayesCorrectParams>();
+    corrParams->measParams =
+        std::make_shared<lager::gncpy::measurements::StateObservationParams>(
+            inds);
+    mc.setCorrectParams(corrParams);
+
+    return mc.run(200, 50, dt, 1234);
+}
+
+}  // namespace
+
+TEST(MonteCarloTest, Reproducible) {
+    auto single = runExperiment(1);
+    auto multi = runExperiment(4);
+
+    ASSERT_EQ(200, multi.numRuns());
+    ASSERT_EQ(50, multi.numSteps());
+    EXPECT_TRUE(single.errors() == multi.errors());
+    EXPECT_TRUE(single.nees() == multi.nees());
+    EXPECT_TRUE(single.nis() == multi.nis());
+
+    SUCCEED();
+}
+
+TEST(MonteCarloTest, Consistent) {
+    auto res = runExperiment(2);
+
+    // a consistent filter has a mean NEES near the state size and a mean NIS
+    // near the measurement size
+    Eigen::VectorXd nees = res.meanNees();
+    Eigen::VectorXd nis = res.meanNis();
+    EXPECT_NEAR(4.0, nees.tail(40).mean(), 0.5);
+    EXPECT_NEAR(2.0, nis.tail(40).mean(), 0.25);
+
+    Eigen::VectorXd rmse = res.rmse(49);
+    EXPECT_LT(rmse(0), 1.0);
+    EXPECT_LT(rmse(1), 1.0);
+
+    SUCCEED();
+}
+
+TEST(MonteCarloTest, MismatchedNoise) {
+    // the NIS uses the filter's inflated noise, so it falls below the
+    // measurement size
+    auto res = runExperiment(2, 4.0);
+    EXPECT_LT(res.meanNis().tail(40).mean(), 1.0);
+
+    SUCCEED();
+}
+
+TEST(MonteCarloTest, MissingModels) {
+    lager::gncpy::simulation::MonteCarlo mc(1);
+    EXPECT_THROW(mc.run(1, 1, 0.1, 0), lager::gncpy::exceptions::TypeError);
+
+    SUCCEED();
+}
@@ -0,0 +1,103 @@
+#include "gncpy/utilities/Allocation.h"
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "gncpy/filters/Kalman.h"
+#include "gncpy/filters/Parameters.h"
+#include "gncpy/measurements/Parameters.h"
+#include "gncpy/measurements/StateObservation.h"
+
+GNCPY_COUNTING_ALLOCATOR
+
+TEST(AllocationTest, CountsAllocations) {
+    lager::gncpy::utilities::AllocCounter counter;
+
+    auto vec = std::make_unique<std::vector<double>>(10, 1.0);
+    Eigen::MatrixXd mat = Eigen::MatrixXd::Identity(8, 8);
+
+    EXPECT_GE(counter.allocations(), 3);
+    EXPECT_GE(counter.stats().bytes, 10 * sizeof(double) + 64 * sizeof(double));
+
+    vec.reset();
+    EXPECT_GE(counter.stats().deallocations, 2);
+
+    SUCCEED();
+}
+
+TEST(AllocationTest, SteadyStateGuard) {
+    std::vector<Eigen::Vector4d> states;
+    states.reserve(100);
+    Eigen::Matrix4d stateMat = Eigen::Matrix4d::Identity();
+    stateMat(0, 2) = 0.1;
+    stateMat(1, 3) = 0.1;
+    Eigen::Vector4d state(1.0, 2.0, 0.5, -0.5);
+
+    uint64_t before = lager::gncpy::utilities::threadAllocViolations();
+    {
+        lager::gncpy::utilities::NoAllocGuard guard;
+        lager::gncpy::utilities::AllocCounter counter;
+        for (int ii = 0; ii < 100; ii++) {
+            state = stateMat * state;
+            states.push_back(state);
+        }
+        EXPECT_EQ(0, counter.allocations());
+    }
+    EXPECT_EQ(before, lager::gncpy::utilities::threadAllocViolations());
+
+    // growing past the reserved size inside a guard is a violation
+    {
+        lager::gncpy::utilities::NoAllocGuard guard;
+        states.push_back(state);
+    }
+    EXPECT_EQ(before + 1, lager::gncpy::utilities::threadAllocViolations());
+
+    SUCCEED();
+}
+
+TEST(AllocationTest, SiteReport) {
+#ifndef GNCPY_ALLOC_TRACKING
+    GTEST_SKIP() << "Requires the GNCPY_ALLOC_TRACKING build option";
+#endif
+    Eigen::Matrix4d noise = 0.01 * Eigen::Matrix4d::Identity();
+    auto measObj =
+        std::make_shared<lager::gncpy::measurements::StateObservation>();
+    std::vector<uint8_t> inds = {0, 1};
+    auto corrParams = lager::gncpy::filters::BayesCorrectParams();
+    corrParams.measParams =
+        std::make_shared<lager::gncpy::measurements::StateObservationParams>(
+            inds);
+
+    lager::gncpy::filters::Kalman filt;
+    filt.getCov() = Eigen::Matrix4d::Identity();
+    filt.setMeasurementModel(measObj, noise);
+
+    lager::gncpy::utilities::resetAllocReport();
+    Eigen::Vector4d state(1.0, 2.0, 1.0, 1.0);
+    Eigen::Vector2d meas(2.0, 3.0);
+    double measFitProb;
+    for (int ii = 0; ii < 3; ii++) {
+        state = filt.correct(0.0, meas, state, measFitProb, &corrParams);
+    }
+
+    auto report = lager::gncpy::utilities::allocReport();
+    auto it = std::find_if(report.begin(), report.end(), [](const auto& s) {
+        return s.name == "Kalman::correct";
+    });
+    ASSERT_NE(report.end(), it);
+    EXPECT_EQ(3, it->calls);
+    EXPECT_GT(it->allocations, 0);
+
+    auto pdf = std::find_if(report.begin(), report.end(), [](const auto& s) {
+        return s.name == "math::calcGaussianPDF";
+    });
+    ASSERT_NE(report.end(), pdf);
+    EXPECT_EQ(3, pdf->calls);
+    EXPECT_LE(pdf->allocations, it->allocations);
+
+    SUCCEED();
+}
@@ -0,0 +1,167 @@
+#include "gncpy/utilities/Checkpoint.h"
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include "gncpy/Exceptions.h"
+#include "gncpy/dynamics/DoubleIntegrator.h"
+#include "gncpy/filters/Kalman.h"
+
+namespace {
+
+std::string tempPath(const char* name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+template <typename T>
+T readAt(const std::string& path, std::streamoff pos) {
+    T val;
+    std::ifstream is(path, std::ios::binary);
+    is.seekg(pos);
+    is.read(reinterpret_cast<char*>(&val), sizeof(T));
+    return val;
+}
+
+template <typename T>
+void writeAt(const std::string& path, std::streamoff pos, const T& val) {
+    std::fstream os(path, std::ios::binary | std::ios::in | std::ios::out);
+    os.seekp(pos);
+    os.write(reinterpret_cast<const char*>(&val), sizeof(T));
+}
+
+}  // namespace
+
+TEST(CheckpointTest, TrackBank) {
+    using lager::gncpy::utilities::CheckpointField;
+    const std::string path = tempPath("gncpy_checkpoint_test.bin");
+
+    std::vector<Eigen::VectorXd> states;
+    std::vector<Eigen::MatrixXd> covs;
+    for (int ii = 0; ii < 100; ii++) {
+        states.push_back(Eigen::VectorXd::Constant(4, ii));
+        covs.push_back(Eigen::MatrixXd::Random(4, 4));
+    }
+
+    auto dynObj =
+        std::make_shared<lager::gncpy::dynamics::DoubleIntegrator>(0.5);
+    lager::gncpy::filters::Kalman filt;
+    filt.setStateModel(dynObj, 0.1 * Eigen::Matrix4d::Identity());
+
+    lager::gncpy::utilities::CheckpointWriter writer;
+    for (uint64_t ii = 0; ii < states.size(); ii++) {
+        writer.addVector(ii, CheckpointField::State, states[ii]);
+        writer.addMatrix(ii, CheckpointField::Covariance, covs[ii]);
+    }
+    writer.addObject(1000, CheckpointField::Model, filt);
+    writer.write(path);
+
+    auto ckpt = lager::gncpy::utilities::Checkpoint::open(path);
+    EXPECT_EQ(lager::gncpy::utilities::Checkpoint::VERSION, ckpt.version());
+    EXPECT_EQ(201, ckpt.entries().size());
+
+    for (uint64_t ii = 0; ii < states.size(); ii++) {
+        auto state = ckpt.vector(ii, CheckpointField::State);
+        auto cov = ckpt.matrix(ii, CheckpointField::Covariance);
+        EXPECT_TRUE(state.isApprox(states[ii]));
+        EXPECT_TRUE(cov.isApprox(covs[ii]));
+    }
+    EXPECT_TRUE(ckpt.contains(1000, CheckpointField::Model));
+    EXPECT_FALSE(ckpt.contains(1000, CheckpointField::State));
+
+    auto loaded = ckpt.loadObject<lager::gncpy::filters::Kalman>(
+        1000, CheckpointField::Model);
+    EXPECT_TRUE(loaded.processNoise().isApprox(filt.processNoise()));
+
+    EXPECT_THROW(ckpt.matrix(5000, CheckpointField::State),
+                 lager::gncpy::exceptions::BadParams);
+    EXPECT_THROW(ckpt.matrix(1000, CheckpointField::Model),
+                 lager::gncpy::exceptions::TypeError);
+
+    std::filesystem::remove(path);
+
+    SUCCEED();
+}
+
+TEST(CheckpointTest, Duplicate) {
+    using lager::gncpy::utilities::CheckpointField;
+    Eigen::MatrixXd mat = Eigen::MatrixXd::Identity(2, 2);
+
+    lager::gncpy::utilities::CheckpointWriter writer;
+    writer.addMatrix(1, CheckpointField::Covariance, mat);
+    writer.addMatrix(1, CheckpointField::Covariance, mat);
+    EXPECT_THROW(writer.write(tempPath("gncpy_checkpoint_dup.bin")),
+                 lager::gncpy::exceptions::BadParams);
+
+    SUCCEED();
+}
+
+TEST(CheckpointTest, Corrupt) {
+    const std::string path = tempPath("gncpy_checkpoint_corrupt.bin");
+    {
+        std::ofstream os(path, std::ios::binary);
+        os << "not a checkpoint, but long enough to hold a full header ......";
+    }
+    EXPECT_THROW(lager::gncpy::utilities::Checkpoint::open(path),
+                 lager::gncpy::exceptions::IOError);
+    std::filesystem::remove(path);
+
+    EXPECT_THROW(lager::gncpy::utilities::Checkpoint::open(path),
+                 lager::gncpy::exceptions::IOError);
+
+    SUCCEED();
+}
+
+TEST(CheckpointTest, CorruptIndex) {
+    using lager::gncpy::utilities::Checkpoint;
+    using lager::gncpy::utilities::CheckpointEntry;
+    using lager::gncpy::utilities::CheckpointField;
+    const std::string path = tempPath("gncpy_checkpoint_index.bin");
+    const std::string copy = tempPath("gncpy_checkpoint_index_copy.bin");
+
+    lager::gncpy::utilities::CheckpointWriter writer;
+    Eigen::MatrixXd mat = Eigen::MatrixXd::Identity(2, 2);
+    writer.addMatrix(1, CheckpointField::Covariance, mat);
+    writer.addMatrix(2, CheckpointField::Covariance, mat);
+    writer.write(path);
+
+    // header stores the number of entries then the index offset
+    const auto indexOffset = readAt<uint64_t>(path, 24);
+    const auto first = readAt<CheckpointEntry>(path, indexOffset);
+    const auto second =
+        readAt<CheckpointEntry>(path, indexOffset + sizeof(CheckpointEntry));
+    const std::streamoff offsetPos =
+        indexOffset + offsetof(CheckpointEntry, offset);
+    const std::streamoff rowsPos =
+        indexOffset + offsetof(CheckpointEntry, rows);
+
+    auto expectCorrupt = [&](auto patch) {
+        std::filesystem::copy_file(
+            path, copy, std::filesystem::copy_options::overwrite_existing);
+        patch();
+        EXPECT_THROW(Checkpoint::open(copy),
+                     lager::gncpy::exceptions::IOError);
+    };
+
+    // entry count whose index size wraps around
+    expectCorrupt([&] { writeAt<uint64_t>(copy, 16, uint64_t(1) << 60); });
+    // rows * cols * 8 wraps around to a small size
+    expectCorrupt(
+        [&] { writeAt<uint64_t>(copy, rowsPos, (uint64_t(1) << 62) + 1); });
+    expectCorrupt(
+        [&] { writeAt<uint64_t>(copy, offsetPos, first.offset + 4); });
+    expectCorrupt([&] {
+        writeAt(copy, indexOffset, second);
+        writeAt(copy, indexOffset + sizeof(CheckpointEntry), first);
+    });
+
+    EXPECT_NO_THROW(Checkpoint::open(path));
+    std::filesystem::remove(path);
+    std::filesystem::remove(copy);
+
+    SUCCEED();
+}
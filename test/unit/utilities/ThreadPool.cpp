@@ -0,0 +1,89 @@
+#include "gncpy/utilities/ThreadPool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+TEST(ThreadPoolTest, RunsAllTasks) {
+    lager::gncpy::utilities::ThreadPool pool(4);
+    EXPECT_EQ(4, pool.size());
+
+    std::atomic<int> count = 0;
+    for (int ii = 0; ii < 1000; ii++) {
+        pool.submit([&count]() { count++; });
+    }
+    pool.wait();
+    EXPECT_EQ(1000, count);
+
+    // pool is reusable after waiting
+    pool.submit([&count]() { count++; });
+    pool.wait();
+    EXPECT_EQ(1001, count);
+
+    SUCCEED();
+}
+
+TEST(ThreadPoolTest, NestedSubmit) {
+    lager::gncpy::utilities::ThreadPool pool(3);
+
+    std::atomic<int> count = 0;
+    for (int ii = 0; ii < 10; ii++) {
+        pool.submit([&pool, &count]() {
+            for (int jj = 0; jj < 10; jj++) {
+                pool.submit([&count]() { count++; });
+            }
+        });
+    }
+    pool.wait();
+    EXPECT_EQ(100, count);
+
+    SUCCEED();
+}
+
+TEST(ThreadPoolTest, RethrowsTaskError) {
+    lager::gncpy::utilities::ThreadPool pool(2);
+
+    std::atomic<int> count = 0;
+    pool.submit([]() { throw std::runtime_error("task failed"); });
+    for (int ii = 0; ii < 10; ii++) {
+        pool.submit([&count]() { count++; });
+    }
+    EXPECT_THROW(pool.wait(), std::runtime_error);
+    EXPECT_EQ(10, count);
+
+    EXPECT_NO_THROW(pool.wait());
+
+    SUCCEED();
+}
+
+TEST(ThreadPoolTest, ParallelFor) {
+    lager::gncpy::utilities::ThreadPool pool(2);
+
+    // every item is visited exactly once, in at most four ranges per worker
+    std::vector<int> visits(1000, 0);
+    std::atomic<int> numRanges = 0;
+    pool.parallelFor(visits.size(), 10, [&](size_t start, size_t end) {
+        numRanges++;
+        for (size_t ii = start; ii < end; ii++) {
+            visits[ii]++;
+        }
+    });
+    EXPECT_EQ(std::vector<int>(1000, 1), visits);
+    EXPECT_EQ(8, numRanges);
+
+    // fewer items than the minimum chunk run as one range
+    numRanges = 0;
+    pool.parallelFor(5, 10, [&](size_t start, size_t end) {
+        numRanges++;
+        EXPECT_EQ(0, start);
+        EXPECT_EQ(5, end);
+    });
+    EXPECT_EQ(1, numRanges);
+
+    pool.parallelFor(0, 10, [&](size_t, size_t) { numRanges++; });
+    EXPECT_EQ(1, numRanges);
+
+    SUCCEED();
+}
@@ -0,0 +1,165 @@
+#include "gncpy/utilities/Trace.h"
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <memory>
+#include <sstream>
+
+#include "gncpy/dynamics/DoubleIntegrator.h"
+#include "gncpy/filters/InformationFilter.h"
+#include "gncpy/filters/Kalman.h"
+#include "gncpy/filters/Parameters.h"
+#include "gncpy/filters/SquareRootKalman.h"
+#include "gncpy/measurements/Parameters.h"
+#include "gncpy/measurements/StateObservation.h"
+
+TEST(TraceTest, StageHistogram) {
+    static lager::gncpy::utilities::TraceStage stage("TraceTest::stage");
+
+    stage.record(0);
+    stage.record(3);
+    stage.record(100);
+    stage.record(1000);
+
+    auto report = lager::gncpy::utilities::traceReport();
+    auto it = std::find_if(report.begin(), report.end(), [](const auto& s) {
+        return s.name == "TraceTest::stage";
+    });
+    ASSERT_NE(report.end(), it);
+    EXPECT_EQ(4, it->calls);
+    EXPECT_EQ(1103, it->totalNs);
+    EXPECT_EQ(1000, it->maxNs);
+    EXPECT_DOUBLE_EQ(1103.0 / 4.0, it->meanNs());
+
+    // 0 -> [0, 1), 3 -> [2, 4), 100 -> [64, 128), 1000 -> [512, 1024)
+    EXPECT_EQ(1, it->histogram[0]);
+    EXPECT_EQ(1, it->histogram[2]);
+    EXPECT_EQ(1, it->histogram[7]);
+    EXPECT_EQ(1, it->histogram[10]);
+    EXPECT_EQ(4, it->percentileNs(0.5));
+    EXPECT_EQ(1024, it->percentileNs(1.0));
+
+    std::stringstream ss;
+    ss.precision(3);
+    const std::ios_base::fmtflags flags = ss.flags();
+    lager::gncpy::utilities::writeTraceReport(ss);
+    EXPECT_NE(std::string::npos, ss.str().find("TraceTest::stage"));
+    // the caller's format is left as it was
+    EXPECT_EQ(flags, ss.flags());
+    EXPECT_EQ(3, ss.precision());
+
+    lager::gncpy::utilities::resetTraceReport();
+    EXPECT_EQ(0, stage.calls);
+    EXPECT_EQ(0, stage.histogram[10]);
+
+    SUCCEED();
+}
+
+TEST(TraceTest, Scope) {
+    static lager::gncpy::utilities::TraceStage stage("TraceTest::scope");
+    for (int ii = 0; ii < 5; ii++) {
+        lager::gncpy::utilities::TraceScope scope(stage);
+    }
+    EXPECT_EQ(5, stage.calls);
+
+    SUCCEED();
+}
+
+TEST(TraceTest, FilterStages) {
+#ifndef GNCPY_TRACING
+    GTEST_SKIP() << "Requires the GNCPY_TRACING build option";
+#endif
+    auto dynObj =
+        std::make_shared<lager::gncpy::dynamics::DoubleIntegrator>(1.0);
+    auto measObj =
+        std::make_shared<lager::gncpy::measurements::StateObservation>();
+    std::vector<uint8_t> inds = {0, 1};
+    auto predParams = lager::gncpy::filters::BayesPredictParams();
+    auto corrParams = lager::gncpy::filters::BayesCorrectParams();
+    corrParams.measParams =
+        std::make_shared<lager::gncpy::measurements::StateObservationParams>(
+            inds);
+
+    lager::gncpy::filters::Kalman filt;
+    filt.getCov() = Eigen::Matrix4d::Identity();
+    filt.setStateModel(dynObj, 0.01 * Eigen::Matrix4d::Identity());
+    filt.setMeasurementModel(measObj, 0.01 * Eigen::Matrix2d::Identity());
+
+    lager::gncpy::utilities::resetTraceReport();
+    Eigen::VectorXd state = Eigen::Vector4d(1.0, 2.0, 1.0, 1.0);
+    Eigen::Vector2d meas(2.0, 3.0);
+    double measFitProb;
+    for (int ii = 0; ii < 4; ii++) {
+        state = filt.predict(0.0, state, std::nullopt, &predParams);
+        state = filt.correct(0.0, meas, state, measFitProb, &corrParams);
+    }
+
+    auto report = lager::gncpy::utilities::traceReport();
+    for (const char* name :
+         {"Kalman::predict", "Kalman::predict/getStateMat", "Kalman::correct",
+          "Kalman::correct/inovInverse", "math::calcGaussianPDF"}) {
+        auto it =
+            std::find_if(report.begin(), report.end(),
+                         [name](const auto& s) { return s.name == name; });
+        ASSERT_NE(report.end(), it) << name;
+        EXPECT_EQ(4, it->calls) << name;
+    }
+
+    SUCCEED();
+}
+
+TEST(TraceTest, AlternateFilterStages) {
+#ifndef GNCPY_TRACING
+    GTEST_SKIP() << "Requires the GNCPY_TRACING build option";
+#endif
+    auto dynObj =
+        std::make_shared<lager::gncpy::dynamics::DoubleIntegrator>(1.0);
+    auto measObj =
+        std::make_shared<lager::gncpy::measurements::StateObservation>();
+    auto predParams = lager::gncpy::filters::BayesPredictParams();
+    auto corrParams = lager::gncpy::filters::BayesCorrectParams();
+    corrParams.measParams =
+        std::make_shared<lager::gncpy::measurements::StateObservationParams>(
+            std::vector<uint8_t>{0, 1});
+
+    lager::gncpy::filters::SquareRootKalman sqrtFilt;
+    lager::gncpy::filters::InformationFilter infoFilt;
+    for (lager::gncpy::filters::IBayesFilter* filt :
+         std::initializer_list<lager::gncpy::filters::IBayesFilter*>{
+             &sqrtFilt, &infoFilt}) {
+        filt->setStateModel(dynObj, 0.01 * Eigen::Matrix4d::Identity());
+        filt->setMeasurementModel(measObj,
+                                  0.01 * Eigen::Matrix2d::Identity());
+        filt->getCov() = Eigen::Matrix4d::Identity();
+    }
+
+    lager::gncpy::utilities::resetTraceReport();
+    Eigen::VectorXd sqrtState = Eigen::Vector4d(1.0, 2.0, 1.0, 1.0);
+    Eigen::VectorXd infoState = sqrtState;
+    Eigen::Vector2d meas(2.0, 3.0);
+    double measFitProb;
+    for (int ii = 0; ii < 4; ii++) {
+        sqrtState = sqrtFilt.predict(0.0, sqrtState, std::nullopt, &predParams);
+        sqrtState =
+            sqrtFilt.correct(0.0, meas, sqrtState, measFitProb, &corrParams);
+        infoState = infoFilt.predict(0.0, infoState, std::nullopt, &predParams);
+        infoState =
+            infoFilt.correct(0.0, meas, infoState, measFitProb, &corrParams);
+    }
+
+    auto report = lager::gncpy::utilities::traceReport();
+    for (const char* name :
+         {"SquareRootKalman::predict", "SquareRootKalman::predict/getStateMat",
+          "SquareRootKalman::correct", "InformationFilter::predict",
+          "InformationFilter::correct", "InformationFilter::fuse"}) {
+        auto it =
+            std::find_if(report.begin(), report.end(),
+                         [name](const auto& s) { return s.name == name; });
+        ASSERT_NE(report.end(), it) << name;
+        EXPECT_EQ(4, it->calls) << name;
+    }
+
+    SUCCEED();
+}
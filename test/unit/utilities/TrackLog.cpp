@@ -0,0 +1,130 @@
+#include "gncpy/utilities/TrackLog.h"
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+#include <filesystem>
+#include <fstream>
+
+#include "gncpy/Exceptions.h"
+
+namespace {
+
+std::string tempPath(const char* name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+Eigen::VectorXd makeState(uint64_t id, int step) {
+    return Eigen::Vector4d(id, step, 0.5 * step, -1.0);
+}
+
+Eigen::MatrixXd makeCov(uint64_t id, int step) {
+    return (1.0 + id + 0.01 * step) * Eigen::Matrix4d::Identity();
+}
+
+}  // namespace
+
+TEST(TrackLogTest, WriteAndQuery) {
+    const std::string path = tempPath("gncpy_track_log_test.bin");
+    {
+        lager::gncpy::utilities::TrackLogWriter writer(path, 64, 4096);
+        for (int step = 0; step < 500; step++) {
+            for (uint64_t id = 0; id < 3; id++) {
+                writer.append(id, 0.1 * step, makeState(id, step),
+                              makeCov(id, step));
+            }
+        }
+        EXPECT_EQ(1500, writer.numRecords());
+
+        // readable before the writer is closed
+        writer.flush();
+        auto partial = lager::gncpy::utilities::TrackLogReader::open(path);
+        EXPECT_EQ(1500, partial.size());
+        EXPECT_EQ(500, partial.query(2).size());
+    }
+
+    auto reader = lager::gncpy::utilities::TrackLogReader::open(path);
+    EXPECT_EQ(1500, reader.size());
+
+    auto recs = reader.query(1, 1.0 - 1e-9, 2.0 + 1e-9);
+    ASSERT_EQ(11, recs.size());
+    for (std::size_t ii = 0; ii < recs.size(); ii++) {
+        int step = 10 + static_cast<int>(ii);
+        EXPECT_EQ(1, recs[ii].trackId);
+        EXPECT_NEAR(0.1 * step, recs[ii].time, 1e-12);
+        EXPECT_TRUE(recs[ii].state.isApprox(makeState(1, step)));
+        EXPECT_TRUE(recs[ii].cov.isApprox(makeCov(1, step)));
+    }
+
+    auto all = reader.queryTime(5.0 - 1e-9, 5.0 + 1e-9);
+    ASSERT_EQ(3, all.size());
+    EXPECT_TRUE(reader.query(7).empty());
+
+    std::filesystem::remove(path);
+
+    SUCCEED();
+}
+
+TEST(TrackLogTest, Truncated) {
+    const std::string path = tempPath("gncpy_track_log_trunc.bin");
+    {
+        lager::gncpy::utilities::TrackLogWriter writer(path, 1000);
+        for (int step = 0; step < 10; step++) {
+            writer.append(4, step, makeState(4, step), Eigen::MatrixXd());
+        }
+    }
+    // lose the final index block and part of the last record
+    auto size = std::filesystem::file_size(path);
+    std::filesystem::resize_file(path, size - 48 - 24 * 10 - 8);
+
+    auto reader = lager::gncpy::utilities::TrackLogReader::open(path);
+    auto recs = reader.query(4);
+    ASSERT_EQ(9, recs.size());
+    EXPECT_EQ(0, recs[0].cov.size());
+    EXPECT_TRUE(recs[8].state.isApprox(makeState(4, 8)));
+
+    std::filesystem::remove(path);
+
+    SUCCEED();
+}
+
+TEST(TrackLogTest, CorruptRecord) {
+    const std::string path = tempPath("gncpy_track_log_corrupt.bin");
+    {
+        lager::gncpy::utilities::TrackLogWriter writer(path, 4);
+        for (int step = 0; step < 8; step++) {
+            writer.append(step % 2, step, makeState(step % 2, step),
+                          makeCov(step % 2, step));
+        }
+    }
+    // the first record follows the 64 byte file header, give it a block
+    // size that no longer matches its dimensions
+    {
+        std::fstream os(path, std::ios::binary | std::ios::in | std::ios::out);
+        os.seekp(64 + 8);
+        const uint64_t size = 16;
+        os.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    }
+
+    // opening does not touch indexed records, only the query reaching it
+    auto reader = lager::gncpy::utilities::TrackLogReader::open(path);
+    EXPECT_EQ(8, reader.size());
+    EXPECT_EQ(4, reader.query(1).size());
+    EXPECT_THROW(reader.query(0), lager::gncpy::exceptions::IOError);
+
+    std::filesystem::remove(path);
+
+    SUCCEED();
+}
+
+TEST(TrackLogTest, BadCovariance) {
+    const std::string path = tempPath("gncpy_track_log_bad.bin");
+    lager::gncpy::utilities::TrackLogWriter writer(path);
+    EXPECT_THROW(writer.append(0, 0.0, Eigen::Vector2d::Zero(),
+                               Eigen::Matrix3d::Identity()),
+                 lager::gncpy::exceptions::BadParams);
+    writer.close();
+    std::filesystem::remove(path);
+
+    SUCCEED();
+}